@@ -1,11 +1,34 @@
 /*
  * Shimport benchmarks for comparison
+ *
+ * node --expose-gc bench/index.js [options]
+ *
+ *   --runs <n>            timed runs per sample (default 50)
+ *   --warmup <n>          untimed runs per sample first (default 5)
+ *   --json                print the results as JSON instead of text
+ *   --save <file>         also write the JSON results to a file
+ *   --baseline <file>     compare with saved results, exiting with 1 when
+ *                         a p50 regressed by more than the threshold
+ *   --threshold <pct>     regression threshold (default 5)
+ *
+ * BENCH=js|wasm|native selects one build.
  */
 
 import fs from 'fs';
 import c from 'kleur';
 
-const n = 25;
+const args = process.argv.slice(2);
+function option (name, fallback) {
+	const index = args.indexOf(`--${name}`);
+	return index === -1 ? fallback : args[index + 1];
+}
+
+const runs = Number(option('runs', 50));
+const warmup = Number(option('warmup', 5));
+const json = args.includes('--json');
+const save = option('save');
+const baseline = option('baseline');
+const threshold = Number(option('threshold', 5));
 
 const files = fs.readdirSync('test/samples')
 	.map(f => `test/samples/${f}`)
@@ -19,76 +42,189 @@ const files = fs.readdirSync('test/samples')
 		};
 	});
 
-Promise.resolve().then(async () => {
-	function timeRun (code) {
-		const start = process.hrtime.bigint();
-		const parsed = parse(code);
-		const end = process.hrtime.bigint();
-		return Math.round(Number(end - start) / 1e6);
+const encoder = new TextEncoder();
+
+const log = json ? () => {} : console.log;
+
+function percentile (sorted, p) {
+	return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+function ms (ns) {
+	return `${(ns / 1e6).toFixed(3)}ms`;
+}
+
+function kib (bytes) {
+	return `${bytes < 0 ? '-' : '+'}${Math.round(Math.abs(bytes) / 1024)} KiB`;
+}
+
+function time (fn) {
+	const start = process.hrtime.bigint();
+	fn();
+	return Number(process.hrtime.bigint() - start);
+}
+
+// Timings in ns of every run of parse over code, and the median growth of
+// the heap while its result is alive
+function measure (parse, code) {
+	const cold = time(() => parse(code));
+	for (let i = 0; i < warmup; i++)
+		parse(code);
+	const times = [], heap = [];
+	for (let i = 0; i < runs; i++) {
+		gc();
+		const heapStart = process.memoryUsage().heapUsed;
+		let result;
+		times.push(time(() => result = parse(code)));
+		heap.push(process.memoryUsage().heapUsed - heapStart);
+		if (!result)
+			throw new Error('No result');
 	}
+	times.sort((a, b) => a - b);
+	heap.sort((a, b) => a - b);
+	return {
+		cold,
+		p50: percentile(times, 0.5),
+		p95: percentile(times, 0.95),
+		p99: percentile(times, 0.99),
+		mean: Math.round(times.reduce((a, b) => a + b, 0) / runs),
+		heap: percentile(heap, 0.5)
+	};
+}
 
-	if (!process.env.BENCH || process.env.BENCH === 'js') {
-		console.log('--- JS Build ---');
-		console.log('Module load time');
-		{
-			const start = process.hrtime.bigint();
-			var { parse } = await import('../dist/lexer.asm.js');
-			console.log(`> ${c.bold.green(Math.round(Number(process.hrtime.bigint() - start) / 1e6) + 'ms')}`);
+// The copy in and lex phases of the wasm build, timed on a separate instance
+// of its module in the same way as src/lexer.ts, and how much its memory grew
+function phases (module, code) {
+	const { exports: wasm } = new WebAssembly.Instance(module);
+	const memoryStart = wasm.memory.buffer.byteLength;
+	const copy = [], lex = [];
+	for (let i = 0; i < warmup + runs; i++) {
+		let len;
+		const copyTime = time(() => {
+			const capacity = code.length * 3;
+			const addr = wasm.sa(capacity);
+			len = encoder.encodeInto(code, new Uint8Array(wasm.memory.buffer, addr, capacity)).written;
+		});
+		const lexTime = time(() => wasm.parse(len, false, false));
+		if (i >= warmup) {
+			copy.push(copyTime);
+			lex.push(lexTime);
 		}
-	
-		doRun();
 	}
-	
-	if (!process.env.BENCH || process.env.BENCH === 'wasm') {
-		console.log('--- Wasm Build ---');
-		console.log('Module load time');
-		{
-			const start = process.hrtime.bigint();
-			var { parse, init } = await import('../dist/lexer.js');
-			await init;
-			console.log(`> ${c.bold.green(Math.round(Number(process.hrtime.bigint() - start) / 1e6) + 'ms')}`);
+	copy.sort((a, b) => a - b);
+	lex.sort((a, b) => a - b);
+	return {
+		copy: percentile(copy, 0.5),
+		lex: percentile(lex, 0.5),
+		memory: wasm.memory.buffer.byteLength - memoryStart
+	};
+}
+
+async function bench (name, load) {
+	log(c.bold(`--- ${name} ---`));
+	let parse, wasmModule;
+	const start = process.hrtime.bigint();
+	({ parse, wasmModule } = await load());
+	const loadTime = Number(process.hrtime.bigint() - start);
+	log(`Module load time\n> ${c.bold.green(ms(loadTime))}`);
+
+	const samples = {};
+	let total = 0, totalSize = 0;
+	for (const { file, code, size } of files) {
+		const result = samples[file.slice('test/samples/'.length)] = { size, ...measure(parse, code) };
+		total += result.p50;
+		totalSize += size;
+
+		log(c.bold.cyan(`${file} (${Math.round(size / 1e3)} KiB)`));
+		log(`> p50 ${c.bold.green(ms(result.p50))} (${Math.round(size / result.p50 * 1e3)} MB/s), p95 ${ms(result.p95)}, p99 ${ms(result.p99)}, cold ${ms(result.cold)}, heap ${kib(result.heap)}`);
+
+		if (wasmModule) {
+			const { copy, lex, memory } = phases(wasmModule, code);
+			result.phases = { copy, lex, read: Math.max(0, result.p50 - copy - lex) };
+			result.memory = memory;
+			log(`  copy in ${ms(copy)}, lex ${ms(lex)}, read out ${ms(result.phases.read)}, wasm memory ${kib(memory)}`);
 		}
-	
-		doRun();
 	}
+	log(c.bold.cyan(`test/samples/*.js (${Math.round(totalSize / 1e3)} KiB)`));
+	log(`> p50 total ${c.bold.green(ms(total))}\n`);
 
-	function doRun () {
-		console.log('Cold Run, All Samples');
-		let totalSize = 0;
-		{
-			let total = 0;
-			files.forEach(({ code, size }) => {
-				totalSize += size;
-				total += timeRun(code);
-			});
-			console.log(c.bold.cyan(`test/samples/*.js (${Math.round(totalSize / 1e3)} KiB)`));
-			console.log(`> ${c.bold.green(total + 'ms')}`);
-			gc();
-		}
-	
-		console.log(`\nWarm Runs (average of ${n} runs)`);
-		files.forEach(({ file, code, size }) => {
-			console.log(c.bold.cyan(`${file} (${Math.round(size / 1e3)} KiB)`));
-	
-			let total = 0;
-			for (let i = 0; i < n; i++) {
-				total += timeRun(code);
-				gc();
+	return { load: loadTime, samples };
+}
+
+function compare (results, base) {
+	const regressions = [];
+	for (const [build, { samples }] of Object.entries(results.builds)) {
+		const baseSamples = base.builds[build]?.samples;
+		if (!baseSamples)
+			continue;
+		for (const [file, { p50 }] of Object.entries(samples)) {
+			if (!baseSamples[file])
+				continue;
+			const change = (p50 / baseSamples[file].p50 - 1) * 100;
+			const line = `${build} ${file}: ${ms(baseSamples[file].p50)} -> ${ms(p50)} (${change >= 0 ? '+' : ''}${change.toFixed(1)}%)`;
+			if (change > threshold) {
+				regressions.push({ build, file, base: baseSamples[file].p50, p50, change });
+				log(c.bold.red(line));
 			}
-	
-			console.log(`> ${c.bold.green((total / n) + 'ms')}`);
-		});
-	
-		console.log(`\nWarm Runs, All Samples (average of ${n} runs)`);
-		{
-			let total = 0;
-			for (let i = 0; i < n; i++) {
-				files.forEach(({ code }) => {
-					total += timeRun(code);
-				});
+			else {
+				log(change < -threshold ? c.green(line) : line);
 			}
-			console.log(c.bold.cyan(`test/samples/*.js (${Math.round(totalSize / 1e3)} KiB)`));
-			console.log(`> ${c.bold.green((total / n) + 'ms')}`);
 		}
 	}
-});
+	return regressions;
+}
+
+const results = {
+	node: process.version,
+	runs,
+	warmup,
+	builds: {}
+};
+
+if (!process.env.BENCH || process.env.BENCH === 'js')
+	results.builds.js = await bench('JS Build', () => import('../dist/lexer.asm.js'));
+
+if (!process.env.BENCH || process.env.BENCH === 'wasm') {
+	results.builds.wasm = await bench('Wasm Build (SIMD)', async () => {
+		const m = await import('../dist/lexer.js');
+		await m.init;
+		return m;
+	});
+
+	// a second instance, failing the SIMD probe so that it loads the scalar binary
+	results.builds['wasm-scalar'] = await bench('Wasm Build (scalar)', async () => {
+		const validate = WebAssembly.validate;
+		WebAssembly.validate = () => false;
+		let m;
+		try {
+			m = await import('../dist/lexer.js?scalar');
+		}
+		finally {
+			WebAssembly.validate = validate;
+		}
+		await m.init;
+		return m;
+	});
+}
+
+if (!process.env.BENCH || process.env.BENCH === 'native') {
+	results.builds.native = await bench('Native Build', async () => {
+		const m = await import('../dist/native.js');
+		await m.init;
+		if (!m.native)
+			log(c.yellow('Native addon not built, running the wasm fallback'));
+		return { parse: m.parse };
+	});
+}
+
+if (baseline) {
+	log(c.bold(`--- Compared to ${baseline} (threshold ${threshold}%) ---`));
+	results.regressions = compare(results, JSON.parse(fs.readFileSync(baseline, 'utf8')));
+	if (results.regressions.length)
+		process.exitCode = 1;
+}
+
+if (save)
+	fs.writeFileSync(save, JSON.stringify(results, null, 2) + '\n');
+if (json)
+	console.log(JSON.stringify(results, null, 2));
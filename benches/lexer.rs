@@ -0,0 +1,248 @@
+//! Throughput of the native lexer over `test/samples` and over generated
+//! corpora for the hard cases, with the allocations it makes through the
+//! alloc callback.
+//!
+//! Run with `cargo bench`, or `cargo bench -- <filter>` for the corpora whose
+//! name contains the filter. `ES_MODULE_LEXER_BUNDLE_MB` sets the size of the
+//! generated bundle, 256 by default.
+
+use es_module_lexer::{lex, Lexer};
+use std::{
+  ffi::c_void,
+  fmt::Write,
+  hint::black_box,
+  time::{Duration, Instant},
+};
+
+// Each corpus is lexed for at least this long, and at least MIN_RUNS times
+const TARGET_TIME: Duration = Duration::from_secs(1);
+const MIN_RUNS: usize = 3;
+
+// parse() from src/lexer.h, called directly to count its allocations
+#[repr(C)]
+struct ParseResult {
+  first_import: *const c_void,
+  first_export: *const c_void,
+  parse_error: u32,
+  facade: bool,
+  line_starts: *const u32,
+  line_count: u32,
+  #[cfg(feature = "stats")]
+  stats: es_module_lexer::LexStats,
+}
+
+type Allocate = unsafe extern "C" fn(bytes: u32, user_data: *mut c_void) -> *mut c_void;
+extern "C" {
+  fn parse(ptr: *const u8, len: u32, alloc: Allocate, user_data: *mut c_void, result: *mut ParseResult) -> bool;
+}
+
+#[derive(Default)]
+struct Allocations {
+  count: u64,
+  bytes: u64,
+  blocks: Vec<Box<[u64]>>,
+}
+
+unsafe extern "C" fn counting_alloc(bytes: u32, user_data: *mut c_void) -> *mut c_void {
+  let allocations = &mut *(user_data as *mut Allocations);
+  allocations.count += 1;
+  allocations.bytes += bytes as u64;
+  let mut block = vec![0u64; (bytes as usize + 7) / 8].into_boxed_slice();
+  let ptr = block.as_mut_ptr() as *mut c_void;
+  allocations.blocks.push(block);
+  ptr
+}
+
+fn count_allocations(code: &str) -> (u64, u64) {
+  let mut allocations = Allocations::default();
+  let mut result = ParseResult {
+    first_import: std::ptr::null(),
+    first_export: std::ptr::null(),
+    parse_error: 0,
+    facade: false,
+    line_starts: std::ptr::null(),
+    line_count: 0,
+    #[cfg(feature = "stats")]
+    stats: Default::default(),
+  };
+  unsafe {
+    parse(
+      code.as_ptr(),
+      code.len() as u32,
+      counting_alloc,
+      &mut allocations as *mut Allocations as *mut c_void,
+      &mut result,
+    );
+  }
+  (allocations.count, allocations.bytes)
+}
+
+fn bench(name: &str, code: &str) {
+  let (imports, exports) = match lex(code) {
+    Ok(result) => (result.imports().count(), result.exports().count()),
+    Err(err) => {
+      println!("{:<28} parse error at {}", name, err);
+      return;
+    }
+  };
+  let (allocations, allocated) = count_allocations(code);
+
+  let mut lexer = Lexer::new();
+  black_box(lexer.lex(code).is_ok());
+  let mut runs = Vec::new();
+  let start = Instant::now();
+  while runs.len() < MIN_RUNS || start.elapsed() < TARGET_TIME {
+    let run = Instant::now();
+    black_box(lexer.lex(black_box(code)).is_ok());
+    runs.push(run.elapsed());
+  }
+  runs.sort();
+  let median = runs[runs.len() / 2];
+
+  let mb_per_sec = code.len() as f64 / 1e6 / median.as_secs_f64();
+  let ns_per_import = if imports == 0 {
+    "-".to_string()
+  } else {
+    format!("{:.1}", median.as_nanos() as f64 / imports as f64)
+  };
+  println!(
+    "{:<28} {:>10} {:>10.1} {:>9} {:>9} {:>12} {:>10} {:>14}",
+    name,
+    format_bytes(code.len()),
+    mb_per_sec,
+    imports,
+    exports,
+    ns_per_import,
+    allocations,
+    format_bytes(allocated as usize),
+  );
+}
+
+fn format_bytes(bytes: usize) -> String {
+  if bytes >= 1 << 20 {
+    format!("{:.1} MiB", bytes as f64 / (1 << 20) as f64)
+  } else {
+    format!("{:.1} KiB", bytes as f64 / 1024.0)
+  }
+}
+
+/// `({a:[` nested `depth` times around a literal.
+fn deep_nesting(depth: usize) -> String {
+  let mut code = String::from("x = ");
+  code.push_str(&"({a:[".repeat(depth));
+  code.push('0');
+  code.push_str(&"]})".repeat(depth));
+  code.push_str(";\n");
+  code
+}
+
+fn many_imports(count: usize) -> String {
+  let mut code = String::new();
+  for i in 0..count {
+    writeln!(code, "import {{ a{i} as b{i} }} from './module-{i}.js';").unwrap();
+  }
+  code.push_str("export const dynamic = import('./dynamic.js');\n");
+  code
+}
+
+/// One template literal of about `bytes`, with nested substitutions.
+fn huge_template(bytes: usize) -> String {
+  let line = "  text ${a + `inner ${b} and ${`deep ${c}`}`} \\` more text\n";
+  let mut code = String::from("export const t = `\n");
+  while code.len() < bytes {
+    code.push_str(line);
+  }
+  code.push_str("`;\n");
+  code
+}
+
+/// Regular expressions and divisions in every position the lexer has to
+/// tell apart.
+fn regex_division(bytes: usize) -> String {
+  let block = r#"function f(a, b, c, s, n, m, ok) {
+  x = a / b / c;
+  y = /[/\]]+\/(?:x)/g.exec(s) / 2;
+  z = (a) / (b) / /c/.source.length;
+  if (ok) /abc/i.test(s);
+  w = n++ / 2 + m-- / 3;
+  v = [1] / 2, u = {} / 3;
+  q = typeof /re/ === 'object' ? a /b/ c : /x/;
+  for (const r of [/a/, /b/g]) s = s.replace(r, '/');
+  return /re/g;
+}
+"#;
+  block.repeat(bytes / block.len() + 1)
+}
+
+fn non_ascii(bytes: usize) -> String {
+  let mut code = String::new();
+  let mut i = 0;
+  while code.len() < bytes {
+    writeln!(
+      code,
+      "import {{ ñandú{i} }} from './ü{i}.js';\nconst 变量{i} = 'π ≈ 3.14 𝑥';\nexport {{ 变量{i} as ναι{i} }};"
+    )
+    .unwrap();
+    i += 1;
+  }
+  code
+}
+
+/// The samples concatenated up to `bytes`.
+fn bundle(samples: &[(String, String)], bytes: usize) -> String {
+  let mut code = String::with_capacity(bytes + (1 << 20));
+  while code.len() < bytes {
+    for (_, source) in samples {
+      code.push_str(source);
+      code.push_str("\n;\n");
+    }
+  }
+  code
+}
+
+fn main() {
+  let filter: Option<String> = std::env::args().skip(1).find(|arg| !arg.starts_with("--"));
+  let selected = |name: &str| filter.as_ref().map_or(true, |filter| name.contains(filter.as_str()));
+  let bundle_mb: usize = std::env::var("ES_MODULE_LEXER_BUNDLE_MB")
+    .ok()
+    .and_then(|mb| mb.parse().ok())
+    .unwrap_or(256);
+
+  let dir = concat!(env!("CARGO_MANIFEST_DIR"), "/test/samples");
+  let mut samples: Vec<(String, String)> = std::fs::read_dir(dir)
+    .expect("test/samples")
+    .filter_map(|entry| {
+      let path = entry.ok()?.path();
+      if path.extension()? != "js" {
+        return None;
+      }
+      let name = path.file_name()?.to_str()?.to_string();
+      Some((name, std::fs::read_to_string(&path).ok()?))
+    })
+    .collect();
+  samples.sort();
+
+  println!(
+    "{:<28} {:>10} {:>10} {:>9} {:>9} {:>12} {:>10} {:>14}",
+    "corpus", "size", "MB/s", "imports", "exports", "ns/import", "allocs", "alloc bytes"
+  );
+  for (name, source) in &samples {
+    if selected(name) {
+      bench(name, source);
+    }
+  }
+
+  let generated: [(&str, &dyn Fn() -> String); 6] = [
+    ("deep-nesting", &|| deep_nesting(100_000)),
+    ("imports-100k", &|| many_imports(100_000)),
+    ("huge-template", &|| huge_template(32 << 20)),
+    ("regex-division", &|| regex_division(16 << 20)),
+    ("non-ascii", &|| non_ascii(16 << 20)),
+    ("bundle", &|| bundle(&samples, bundle_mb << 20)),
+  ];
+  for (name, generate) in generated {
+    if selected(name) {
+      bench(name, &generate());
+    }
+  }
+}
@@ -0,0 +1,181 @@
+//! Checks that lexing time grows linearly with the input, for each construct
+//! the lexer scans ahead over or backtracks through. Every generated input is
+//! lexed at 1x, 2x, 4x and 8x its base size, timing the median of `RUNS`
+//! runs after `WARMUP` untimed ones, and the check fails when the 8x input
+//! takes more than `MAX_GROWTH` times as long as the 1x input, where a
+//! quadratic path takes about 64 times as long. A construct over the limit is
+//! measured again, up to `ATTEMPTS` times in all, and fails when it is over
+//! each time.
+//!
+//! Run with `cargo bench --bench linear`, or `cargo bench --bench linear --
+//! <filter>` for the constructs whose name contains the filter.
+
+use es_module_lexer::{LexStream, Lexer};
+use std::{
+  hint::black_box,
+  process::ExitCode,
+  time::{Duration, Instant},
+};
+
+const BASE: usize = 20_000;
+const SCALES: [usize; 4] = [1, 2, 4, 8];
+// allows for noise and cache effects at the larger sizes
+const MAX_GROWTH: f64 = 10.0;
+const WARMUP: usize = 3;
+const RUNS: usize = 15;
+// so that a burst of noise on a shared machine does not fail the check
+const ATTEMPTS: usize = 5;
+
+/// `unit` repeated `n` times between `prefix` and `suffix`.
+fn repeat(prefix: &str, unit: &str, n: usize, suffix: &str) -> String {
+  let mut code = String::with_capacity(prefix.len() + unit.len() * n + suffix.len());
+  code.push_str(prefix);
+  for _ in 0..n {
+    code.push_str(unit);
+  }
+  code.push_str(suffix);
+  code
+}
+
+/// `open` repeated `n` times, `middle`, then `close` repeated `n` times.
+fn nest(open: &str, middle: &str, close: &str, n: usize) -> String {
+  let mut code = open.repeat(n);
+  code.push_str(middle);
+  code.push_str(&close.repeat(n));
+  code
+}
+
+fn generated(n: usize) -> Vec<(&'static str, String)> {
+  vec![
+    // an operand at each level as in real code, as with one byte a level the
+    // paren stack dominated the memory traffic and read as 11-15x at 8x
+    ("nested-parens", nest("(a", "", ")", n)),
+    ("nested-dynamic-imports", nest("import(", "'x'", ")", n)),
+    ("nested-assert-braces", nest("import 'a' assert {", "", "}", n)),
+    ("nested-templates", repeat("`", "x${`y${z}`}", n, "`")),
+    ("imports", repeat("", "import a from 'a';\n", n, "")),
+    ("import-meta", repeat("", "import.meta;\n", n, "")),
+    ("import-keywords", repeat("", "import ", n, "x;")),
+    ("import-comments", repeat("import ", "/* c */ ", n, "x;")),
+    ("import-list", repeat("import { ", "a, ", n, "} from 'x';")),
+    ("import-default-whitespace", repeat("import a, ", " ", n, ";")),
+    ("import-call-blocks", repeat("", "import(a){}", n, "")),
+    ("import-asserts", repeat("import 'a' assert { ", "type: 'json', ", n, "};")),
+    ("import-assert-backtracks", repeat("", "import 'a' assert { type: x };\n", n, "")),
+    ("exports-renamed", repeat("export { ", "a as b, ", n, "c } from 'x';")),
+    ("exports-unterminated", repeat("export { ", "a, ", n, "}")),
+    ("export-stars", repeat("", "export * from 'a';", n, "")),
+    ("export-keywords", repeat("", "export ", n, "x;")),
+    ("export-whitespace", repeat("export ", " ", n, "x;")),
+    ("requires", repeat("", "require", n, "")),
+    ("divisions", repeat("", "a = b / c / /re/g.x / d;\n", n, "")),
+    ("division-after-blocks", repeat("", "{}/1/", n, "")),
+    ("division-after-words", repeat("x = ", "aaaaaaaaaaaaaaaaaaaaaaaaaa ", n, "/ 2;")),
+    ("division-after-whitespace", repeat("x = a", " ", n, "/ 2;")),
+    ("division-after-identifier", repeat("x = ", "a", n, " / 2;")),
+  ]
+}
+
+/// Long tokens fed to `LexStream` a byte at a time.
+fn streamed(n: usize) -> Vec<(&'static str, String)> {
+  vec![
+    ("stream-string", repeat("x = '", "a", n, "';")),
+    ("stream-block-comment", repeat("/*", "a", n, "*/")),
+    ("stream-line-comment", repeat("// ", "a", n, "\n")),
+    ("stream-template", repeat("x = `", "a", n, "`;")),
+    ("stream-regex", repeat("x = /", "a", n, "/;")),
+  ]
+}
+
+fn lex_streamed(code: &str) {
+  let mut stream = LexStream::new();
+  for byte in code.as_bytes().chunks(1) {
+    if stream.feed(byte).is_err() {
+      return;
+    }
+  }
+  black_box(stream.finish().is_ok());
+}
+
+/// The median of `RUNS` times, which unlike the fastest run is not skewed
+/// towards the smaller inputs, that more often run entirely in a quiet moment
+/// of the machine or with their memory still cached.
+fn median(mut run: impl FnMut()) -> Duration {
+  for _ in 0..WARMUP {
+    run();
+  }
+  let mut times: Vec<Duration> = (0..RUNS)
+    .map(|_| {
+      let start = Instant::now();
+      run();
+      start.elapsed()
+    })
+    .collect();
+  times.sort();
+  times[RUNS / 2]
+}
+
+fn main() -> ExitCode {
+  let filter: Option<String> = std::env::args().skip(1).find(|arg| !arg.starts_with("--"));
+  let selected = |name: &str| filter.as_ref().map_or(true, |filter| name.contains(filter.as_str()));
+
+  println!("{:<28} {:>10} {:>8} {:>8} {:>8}", "construct", "1x", "2x", "4x", "8x");
+  let mut failed = Vec::new();
+  // keeps its arena across runs, so that the timings leave out first touches
+  // of memory
+  let mut lexer = Lexer::with_retain_limit(usize::MAX);
+  let generators: [(bool, fn(usize) -> Vec<(&'static str, String)>); 2] = [(false, generated), (true, streamed)];
+  for (streaming, generate) in generators {
+    // the constructs at each scale
+    let scales: Vec<_> = SCALES.iter().map(|scale| generate(BASE * scale)).collect();
+    for (i, &(name, _)) in scales[0].iter().enumerate() {
+      if !selected(name) {
+        continue;
+      }
+      let mut measure = || -> Vec<Duration> {
+        scales
+          .iter()
+          .map(|constructs| {
+            let code = &constructs[i].1;
+            if streaming {
+              median(|| lex_streamed(black_box(code)))
+            } else {
+              median(|| {
+                black_box(lexer.lex(black_box(code)).is_ok());
+              })
+            }
+          })
+          .collect()
+      };
+      let growth_of = |times: &[Duration]| -> Vec<f64> {
+        times.iter().map(|time| time.as_secs_f64() / times[0].as_secs_f64()).collect()
+      };
+      let mut times = measure();
+      let mut growth = growth_of(&times);
+      for _ in 1..ATTEMPTS {
+        if growth[3] <= MAX_GROWTH {
+          break;
+        }
+        times = measure();
+        growth = growth_of(&times);
+      }
+      println!(
+        "{:<28} {:>8.3}ms {:>7.2}x {:>7.2}x {:>7.2}x",
+        name,
+        times[0].as_secs_f64() * 1e3,
+        growth[1],
+        growth[2],
+        growth[3],
+      );
+      if growth[3] > MAX_GROWTH {
+        failed.push(name);
+      }
+    }
+  }
+
+  if failed.is_empty() {
+    return ExitCode::SUCCESS;
+  }
+  println!("superlinear at 8x (more than {}x the time): {}", MAX_GROWTH, failed.join(", "));
+  ExitCode::FAILURE
+}
@@ -0,0 +1,12 @@
+{
+  "targets": [
+    {
+      "target_name": "es_module_lexer",
+      "sources": ["src/binding.c"],
+      "cflags": ["-O3", "-Wno-parentheses"],
+      "xcode_settings": {
+        "OTHER_CFLAGS": ["-O3", "-Wno-parentheses", "-Wno-logical-op-parentheses"]
+      }
+    }
+  ]
+}
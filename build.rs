@@ -1,9 +1,12 @@
 fn main() {
   println!("cargo:rerun-if-changed=src/lexer.h");
   println!("cargo:rerun-if-changed=src/lexer.c");
-  cc::Build::new()
-    .warnings(false)
-    .flag_if_supported("-std=c99")
-    .file("src/lexer.c")
-    .compile("lexer.a");
+  println!("cargo:rerun-if-changed=src/keywords.h");
+  println!("cargo:rerun-if-changed=src/identifiers.h");
+  let mut build = cc::Build::new();
+  build.warnings(false).flag_if_supported("-std=c99").file("src/lexer.c");
+  if std::env::var_os("CARGO_FEATURE_STATS").is_some() {
+    build.define("LEXER_STATS", None);
+  }
+  build.compile("lexer.a");
 }
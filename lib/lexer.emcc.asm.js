@@ -1,9 +1,10104 @@
-Module["asm"]=(/** @suppress {uselessCode} */ function(global,env,buffer) {
-"use asm";var a=new global.Int8Array(buffer),b=new global.Int16Array(buffer),c=new global.Int32Array(buffer),d=new global.Uint8Array(buffer),e=new global.Uint16Array(buffer),f=env.g|0,g=env.h|0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0.0,p=env.a,q=env.b,r=env.c,s=env.d,t=env.e,u=env.f,v=1024,w=4998992,x=0.0;
-// EMSCRIPTEN_START_FUNCS
-function y(a){a=a|0;var b=0,d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,w=0,x=0;x=v;v=v+16|0;n=x;do if(a>>>0<245){k=a>>>0<11?16:a+11&-8;a=k>>>3;m=c[73]|0;d=m>>>a;if(d&3|0){e=(d&1^1)+a|0;f=332+(e<<1<<2)|0;b=f+8|0;a=c[b>>2]|0;g=a+8|0;d=c[g>>2]|0;if((d|0)==(f|0))c[73]=m&~(1<<e);else{c[d+12>>2]=f;c[b>>2]=d}w=e<<3;c[a+4>>2]=w|3;w=a+w+4|0;c[w>>2]=c[w>>2]|1;w=g;v=x;return w|0}l=c[75]|0;if(k>>>0>l>>>0){if(d|0){i=2<<a;d=d<<a&(i|0-i);d=(d&0-d)+-1|0;i=d>>>12&16;d=d>>>i;a=d>>>5&8;d=d>>>a;g=d>>>2&4;d=d>>>g;b=d>>>1&2;d=d>>>b;e=d>>>1&1;e=(a|i|g|b|e)+(d>>>e)|0;d=332+(e<<1<<2)|0;b=d+8|0;g=c[b>>2]|0;i=g+8|0;a=c[i>>2]|0;if((a|0)==(d|0)){a=m&~(1<<e);c[73]=a}else{c[a+12>>2]=d;c[b>>2]=a;a=m}w=e<<3;h=w-k|0;c[g+4>>2]=k|3;f=g+k|0;c[f+4>>2]=h|1;c[g+w>>2]=h;if(l|0){e=c[78]|0;b=l>>>3;d=332+(b<<1<<2)|0;b=1<<b;if(!(a&b)){c[73]=a|b;b=d+8|0;a=d}else{a=d+8|0;b=a;a=c[a>>2]|0}c[b>>2]=e;c[a+12>>2]=e;c[e+8>>2]=a;c[e+12>>2]=d}c[75]=h;c[78]=f;w=i;v=x;return w|0}g=c[74]|0;if(g){i=(g&0-g)+-1|0;f=i>>>12&16;i=i>>>f;e=i>>>5&8;i=i>>>e;h=i>>>2&4;i=i>>>h;d=i>>>1&2;i=i>>>d;j=i>>>1&1;j=c[596+((e|f|h|d|j)+(i>>>j)<<2)>>2]|0;i=(c[j+4>>2]&-8)-k|0;d=j;while(1){a=c[d+16>>2]|0;if(!a){a=c[d+20>>2]|0;if(!a)break}d=(c[a+4>>2]&-8)-k|0;h=d>>>0<i>>>0;i=h?d:i;d=a;j=h?a:j}h=j+k|0;if(h>>>0>j>>>0){f=c[j+24>>2]|0;b=c[j+12>>2]|0;do if((b|0)==(j|0)){a=j+20|0;b=c[a>>2]|0;if(!b){a=j+16|0;b=c[a>>2]|0;if(!b){d=0;break}}while(1){e=b+20|0;d=c[e>>2]|0;if(!d){e=b+16|0;d=c[e>>2]|0;if(!d)break;else{b=d;a=e}}else{b=d;a=e}}c[a>>2]=0;d=b}else{d=c[j+8>>2]|0;c[d+12>>2]=b;c[b+8>>2]=d;d=b}while(0);do if(f|0){b=c[j+28>>2]|0;a=596+(b<<2)|0;if((j|0)==(c[a>>2]|0)){c[a>>2]=d;if(!d){c[74]=g&~(1<<b);break}}else{w=f+16|0;c[((c[w>>2]|0)==(j|0)?w:f+20|0)>>2]=d;if(!d)break}c[d+24>>2]=f;b=c[j+16>>2]|0;if(b|0){c[d+16>>2]=b;c[b+24>>2]=d}b=c[j+20>>2]|0;if(b|0){c[d+20>>2]=b;c[b+24>>2]=d}}while(0);if(i>>>0<16){w=i+k|0;c[j+4>>2]=w|3;w=j+w+4|0;c[w>>2]=c[w>>2]|1}else{c[j+4>>2]=k|3;c[h+4>>2]=i|1;c[h+i>>2]=i;if(l|0){e=c[78]|0;b=l>>>3;d=332+(b<<1<<2)|0;b=1<<b;if(!(b&m)){c[73]=b|m;b=d+8|0;a=d}else{a=d+8|0;b=a;a=c[a>>2]|0}c[b>>2]=e;c[a+12>>2]=e;c[e+8>>2]=a;c[e+12>>2]=d}c[75]=i;c[78]=h}w=j+8|0;v=x;return w|0}else m=k}else m=k}else m=k}else if(a>>>0<=4294967231){a=a+11|0;k=a&-8;e=c[74]|0;if(e){d=0-k|0;a=a>>>8;if(a)if(k>>>0>16777215)j=31;else{m=(a+1048320|0)>>>16&8;q=a<<m;i=(q+520192|0)>>>16&4;q=q<<i;j=(q+245760|0)>>>16&2;j=14-(i|m|j)+(q<<j>>>15)|0;j=k>>>(j+7|0)&1|j<<1}else j=0;a=c[596+(j<<2)>>2]|0;a:do if(!a){f=0;a=0;q=61}else{f=0;h=k<<((j|0)==31?0:25-(j>>>1)|0);i=a;a=0;while(1){g=(c[i+4>>2]&-8)-k|0;if(g>>>0<d>>>0)if(!g){d=0;f=i;a=i;q=65;break a}else{d=g;a=i}q=c[i+20>>2]|0;i=c[i+16+(h>>>31<<2)>>2]|0;f=(q|0)==0|(q|0)==(i|0)?f:q;if(!i){q=61;break}else h=h<<1}}while(0);if((q|0)==61){if((f|0)==0&(a|0)==0){a=2<<j;a=(a|0-a)&e;if(!a){m=k;break}a=(a&0-a)+-1|0;i=a>>>12&16;a=a>>>i;h=a>>>5&8;a=a>>>h;j=a>>>2&4;a=a>>>j;m=a>>>1&2;a=a>>>m;f=a>>>1&1;f=c[596+((h|i|j|m|f)+(a>>>f)<<2)>>2]|0;a=0}if(!f){i=d;g=a}else q=65}if((q|0)==65)while(1){m=(c[f+4>>2]&-8)-k|0;g=m>>>0<d>>>0;d=g?m:d;g=g?f:a;a=c[f+16>>2]|0;if(!a)a=c[f+20>>2]|0;if(!a){i=d;break}else{f=a;a=g}}if(((g|0)!=0?i>>>0<((c[75]|0)-k|0)>>>0:0)?(l=g+k|0,l>>>0>g>>>0):0){h=c[g+24>>2]|0;b=c[g+12>>2]|0;do if((b|0)==(g|0)){a=g+20|0;b=c[a>>2]|0;if(!b){a=g+16|0;b=c[a>>2]|0;if(!b){b=0;break}}while(1){f=b+20|0;d=c[f>>2]|0;if(!d){f=b+16|0;d=c[f>>2]|0;if(!d)break;else{b=d;a=f}}else{b=d;a=f}}c[a>>2]=0}else{w=c[g+8>>2]|0;c[w+12>>2]=b;c[b+8>>2]=w}while(0);do if(h){a=c[g+28>>2]|0;d=596+(a<<2)|0;if((g|0)==(c[d>>2]|0)){c[d>>2]=b;if(!b){e=e&~(1<<a);c[74]=e;break}}else{w=h+16|0;c[((c[w>>2]|0)==(g|0)?w:h+20|0)>>2]=b;if(!b)break}c[b+24>>2]=h;a=c[g+16>>2]|0;if(a|0){c[b+16>>2]=a;c[a+24>>2]=b}a=c[g+20>>2]|0;if(a){c[b+20>>2]=a;c[a+24>>2]=b}}while(0);b:do if(i>>>0<16){w=i+k|0;c[g+4>>2]=w|3;w=g+w+4|0;c[w>>2]=c[w>>2]|1}else{c[g+4>>2]=k|3;c[l+4>>2]=i|1;c[l+i>>2]=i;b=i>>>3;if(i>>>0<256){d=332+(b<<1<<2)|0;a=c[73]|0;b=1<<b;if(!(a&b)){c[73]=a|b;b=d+8|0;a=d}else{a=d+8|0;b=a;a=c[a>>2]|0}c[b>>2]=l;c[a+12>>2]=l;c[l+8>>2]=a;c[l+12>>2]=d;break}b=i>>>8;if(b)if(i>>>0>16777215)d=31;else{u=(b+1048320|0)>>>16&8;w=b<<u;t=(w+520192|0)>>>16&4;w=w<<t;d=(w+245760|0)>>>16&2;d=14-(t|u|d)+(w<<d>>>15)|0;d=i>>>(d+7|0)&1|d<<1}else d=0;b=596+(d<<2)|0;c[l+28>>2]=d;a=l+16|0;c[a+4>>2]=0;c[a>>2]=0;a=1<<d;if(!(e&a)){c[74]=e|a;c[b>>2]=l;c[l+24>>2]=b;c[l+12>>2]=l;c[l+8>>2]=l;break}b=c[b>>2]|0;c:do if((c[b+4>>2]&-8|0)!=(i|0)){e=i<<((d|0)==31?0:25-(d>>>1)|0);while(1){d=b+16+(e>>>31<<2)|0;a=c[d>>2]|0;if(!a)break;if((c[a+4>>2]&-8|0)==(i|0)){b=a;break c}else{e=e<<1;b=a}}c[d>>2]=l;c[l+24>>2]=b;c[l+12>>2]=l;c[l+8>>2]=l;break b}while(0);u=b+8|0;w=c[u>>2]|0;c[w+12>>2]=l;c[u>>2]=l;c[l+8>>2]=w;c[l+12>>2]=b;c[l+24>>2]=0}while(0);w=g+8|0;v=x;return w|0}else m=k}else m=k}else m=-1;while(0);d=c[75]|0;if(d>>>0>=m>>>0){a=d-m|0;b=c[78]|0;if(a>>>0>15){w=b+m|0;c[78]=w;c[75]=a;c[w+4>>2]=a|1;c[b+d>>2]=a;c[b+4>>2]=m|3}else{c[75]=0;c[78]=0;c[b+4>>2]=d|3;w=b+d+4|0;c[w>>2]=c[w>>2]|1}w=b+8|0;v=x;return w|0}h=c[76]|0;if(h>>>0>m>>>0){t=h-m|0;c[76]=t;w=c[79]|0;u=w+m|0;c[79]=u;c[u+4>>2]=t|1;c[w+4>>2]=m|3;w=w+8|0;v=x;return w|0}if(!(c[191]|0)){c[193]=4096;c[192]=4096;c[194]=-1;c[195]=-1;c[196]=0;c[184]=0;c[191]=n&-16^1431655768;a=4096}else a=c[193]|0;i=m+48|0;j=m+47|0;g=a+j|0;e=0-a|0;k=g&e;if(k>>>0<=m>>>0){w=0;v=x;return w|0}a=c[183]|0;if(a|0?(l=c[181]|0,n=l+k|0,n>>>0<=l>>>0|n>>>0>a>>>0):0){w=0;v=x;return w|0}d:do if(!(c[184]&4)){d=c[79]|0;e:do if(d){f=740;while(1){n=c[f>>2]|0;if(n>>>0<=d>>>0?(n+(c[f+4>>2]|0)|0)>>>0>d>>>0:0)break;a=c[f+8>>2]|0;if(!a){q=128;break e}else f=a}b=g-h&e;if(b>>>0<2147483647){a=R(b)|0;if((a|0)==((c[f>>2]|0)+(c[f+4>>2]|0)|0)){if((a|0)!=(-1|0)){h=a;g=b;q=145;break d}}else{e=a;q=136}}else b=0}else q=128;while(0);do if((q|0)==128){d=R(0)|0;if((d|0)!=(-1|0)?(b=d,o=c[192]|0,p=o+-1|0,b=((p&b|0)==0?0:(p+b&0-o)-b|0)+k|0,o=c[181]|0,p=b+o|0,b>>>0>m>>>0&b>>>0<2147483647):0){n=c[183]|0;if(n|0?p>>>0<=o>>>0|p>>>0>n>>>0:0){b=0;break}a=R(b)|0;if((a|0)==(d|0)){h=d;g=b;q=145;break d}else{e=a;q=136}}else b=0}while(0);do if((q|0)==136){d=0-b|0;if(!(i>>>0>b>>>0&(b>>>0<2147483647&(e|0)!=(-1|0))))if((e|0)==(-1|0)){b=0;break}else{h=e;g=b;q=145;break d}a=c[193]|0;a=j-b+a&0-a;if(a>>>0>=2147483647){h=e;g=b;q=145;break d}if((R(a)|0)==(-1|0)){R(d)|0;b=0;break}else{h=e;g=a+b|0;q=145;break d}}while(0);c[184]=c[184]|4;q=143}else{b=0;q=143}while(0);if(((q|0)==143?k>>>0<2147483647:0)?(r=R(k)|0,p=R(0)|0,t=p-r|0,s=t>>>0>(m+40|0)>>>0,!((r|0)==(-1|0)|s^1|r>>>0<p>>>0&((r|0)!=(-1|0)&(p|0)!=(-1|0))^1)):0){h=r;g=s?t:b;q=145}if((q|0)==145){b=(c[181]|0)+g|0;c[181]=b;if(b>>>0>(c[182]|0)>>>0)c[182]=b;j=c[79]|0;f:do if(j){e=740;while(1){b=c[e>>2]|0;a=c[e+4>>2]|0;if((h|0)==(b+a|0)){q=154;break}d=c[e+8>>2]|0;if(!d)break;else e=d}if(((q|0)==154?(u=e+4|0,(c[e+12>>2]&8|0)==0):0)?h>>>0>j>>>0&b>>>0<=j>>>0:0){c[u>>2]=a+g;w=(c[76]|0)+g|0;t=j+8|0;t=(t&7|0)==0?0:0-t&7;u=j+t|0;t=w-t|0;c[79]=u;c[76]=t;c[u+4>>2]=t|1;c[j+w+4>>2]=40;c[80]=c[195];break}if(h>>>0<(c[77]|0)>>>0)c[77]=h;d=h+g|0;a=740;while(1){if((c[a>>2]|0)==(d|0)){q=162;break}b=c[a+8>>2]|0;if(!b)break;else a=b}if((q|0)==162?(c[a+12>>2]&8|0)==0:0){c[a>>2]=h;l=a+4|0;c[l>>2]=(c[l>>2]|0)+g;l=h+8|0;l=h+((l&7|0)==0?0:0-l&7)|0;b=d+8|0;b=d+((b&7|0)==0?0:0-b&7)|0;k=l+m|0;i=b-l-m|0;c[l+4>>2]=m|3;g:do if((j|0)==(b|0)){w=(c[76]|0)+i|0;c[76]=w;c[79]=k;c[k+4>>2]=w|1}else{if((c[78]|0)==(b|0)){w=(c[75]|0)+i|0;c[75]=w;c[78]=k;c[k+4>>2]=w|1;c[k+w>>2]=w;break}a=c[b+4>>2]|0;if((a&3|0)==1){h=a&-8;e=a>>>3;h:do if(a>>>0<256){a=c[b+8>>2]|0;d=c[b+12>>2]|0;if((d|0)==(a|0)){c[73]=c[73]&~(1<<e);break}else{c[a+12>>2]=d;c[d+8>>2]=a;break}}else{g=c[b+24>>2]|0;a=c[b+12>>2]|0;do if((a|0)==(b|0)){e=b+16|0;d=e+4|0;a=c[d>>2]|0;if(!a){a=c[e>>2]|0;if(!a){a=0;break}else d=e}while(1){f=a+20|0;e=c[f>>2]|0;if(!e){f=a+16|0;e=c[f>>2]|0;if(!e)break;else{a=e;d=f}}else{a=e;d=f}}c[d>>2]=0}else{w=c[b+8>>2]|0;c[w+12>>2]=a;c[a+8>>2]=w}while(0);if(!g)break;d=c[b+28>>2]|0;e=596+(d<<2)|0;do if((c[e>>2]|0)!=(b|0)){w=g+16|0;c[((c[w>>2]|0)==(b|0)?w:g+20|0)>>2]=a;if(!a)break h}else{c[e>>2]=a;if(a|0)break;c[74]=c[74]&~(1<<d);break h}while(0);c[a+24>>2]=g;e=b+16|0;d=c[e>>2]|0;if(d|0){c[a+16>>2]=d;c[d+24>>2]=a}d=c[e+4>>2]|0;if(!d)break;c[a+20>>2]=d;c[d+24>>2]=a}while(0);b=b+h|0;f=h+i|0}else f=i;b=b+4|0;c[b>>2]=c[b>>2]&-2;c[k+4>>2]=f|1;c[k+f>>2]=f;b=f>>>3;if(f>>>0<256){d=332+(b<<1<<2)|0;a=c[73]|0;b=1<<b;if(!(a&b)){c[73]=a|b;b=d+8|0;a=d}else{a=d+8|0;b=a;a=c[a>>2]|0}c[b>>2]=k;c[a+12>>2]=k;c[k+8>>2]=a;c[k+12>>2]=d;break}b=f>>>8;do if(!b)e=0;else{if(f>>>0>16777215){e=31;break}u=(b+1048320|0)>>>16&8;w=b<<u;t=(w+520192|0)>>>16&4;w=w<<t;e=(w+245760|0)>>>16&2;e=14-(t|u|e)+(w<<e>>>15)|0;e=f>>>(e+7|0)&1|e<<1}while(0);a=596+(e<<2)|0;c[k+28>>2]=e;b=k+16|0;c[b+4>>2]=0;c[b>>2]=0;b=c[74]|0;d=1<<e;if(!(b&d)){c[74]=b|d;c[a>>2]=k;c[k+24>>2]=a;c[k+12>>2]=k;c[k+8>>2]=k;break}b=c[a>>2]|0;i:do if((c[b+4>>2]&-8|0)!=(f|0)){e=f<<((e|0)==31?0:25-(e>>>1)|0);while(1){d=b+16+(e>>>31<<2)|0;a=c[d>>2]|0;if(!a)break;if((c[a+4>>2]&-8|0)==(f|0)){b=a;break i}else{e=e<<1;b=a}}c[d>>2]=k;c[k+24>>2]=b;c[k+12>>2]=k;c[k+8>>2]=k;break g}while(0);u=b+8|0;w=c[u>>2]|0;c[w+12>>2]=k;c[u>>2]=k;c[k+8>>2]=w;c[k+12>>2]=b;c[k+24>>2]=0}while(0);w=l+8|0;v=x;return w|0}a=740;while(1){b=c[a>>2]|0;if(b>>>0<=j>>>0?(w=b+(c[a+4>>2]|0)|0,w>>>0>j>>>0):0)break;a=c[a+8>>2]|0}f=w+-47|0;a=f+8|0;a=f+((a&7|0)==0?0:0-a&7)|0;f=j+16|0;a=a>>>0<f>>>0?j:a;b=a+8|0;d=g+-40|0;t=h+8|0;t=(t&7|0)==0?0:0-t&7;u=h+t|0;t=d-t|0;c[79]=u;c[76]=t;c[u+4>>2]=t|1;c[h+d+4>>2]=40;c[80]=c[195];d=a+4|0;c[d>>2]=27;c[b>>2]=c[185];c[b+4>>2]=c[186];c[b+8>>2]=c[187];c[b+12>>2]=c[188];c[185]=h;c[186]=g;c[188]=0;c[187]=b;b=a+24|0;do{u=b;b=b+4|0;c[b>>2]=7}while((u+8|0)>>>0<w>>>0);if((a|0)!=(j|0)){g=a-j|0;c[d>>2]=c[d>>2]&-2;c[j+4>>2]=g|1;c[a>>2]=g;b=g>>>3;if(g>>>0<256){d=332+(b<<1<<2)|0;a=c[73]|0;b=1<<b;if(!(a&b)){c[73]=a|b;b=d+8|0;a=d}else{a=d+8|0;b=a;a=c[a>>2]|0}c[b>>2]=j;c[a+12>>2]=j;c[j+8>>2]=a;c[j+12>>2]=d;break}b=g>>>8;if(b)if(g>>>0>16777215)e=31;else{u=(b+1048320|0)>>>16&8;w=b<<u;t=(w+520192|0)>>>16&4;w=w<<t;e=(w+245760|0)>>>16&2;e=14-(t|u|e)+(w<<e>>>15)|0;e=g>>>(e+7|0)&1|e<<1}else e=0;d=596+(e<<2)|0;c[j+28>>2]=e;c[j+20>>2]=0;c[f>>2]=0;b=c[74]|0;a=1<<e;if(!(b&a)){c[74]=b|a;c[d>>2]=j;c[j+24>>2]=d;c[j+12>>2]=j;c[j+8>>2]=j;break}b=c[d>>2]|0;j:do if((c[b+4>>2]&-8|0)!=(g|0)){e=g<<((e|0)==31?0:25-(e>>>1)|0);while(1){d=b+16+(e>>>31<<2)|0;a=c[d>>2]|0;if(!a)break;if((c[a+4>>2]&-8|0)==(g|0)){b=a;break j}else{e=e<<1;b=a}}c[d>>2]=j;c[j+24>>2]=b;c[j+12>>2]=j;c[j+8>>2]=j;break f}while(0);u=b+8|0;w=c[u>>2]|0;c[w+12>>2]=j;c[u>>2]=j;c[j+8>>2]=w;c[j+12>>2]=b;c[j+24>>2]=0}}else{w=c[77]|0;if((w|0)==0|h>>>0<w>>>0)c[77]=h;c[185]=h;c[186]=g;c[188]=0;c[82]=c[191];c[81]=-1;c[86]=332;c[85]=332;c[88]=340;c[87]=340;c[90]=348;c[89]=348;c[92]=356;c[91]=356;c[94]=364;c[93]=364;c[96]=372;c[95]=372;c[98]=380;c[97]=380;c[100]=388;c[99]=388;c[102]=396;c[101]=396;c[104]=404;c[103]=404;c[106]=412;c[105]=412;c[108]=420;c[107]=420;c[110]=428;c[109]=428;c[112]=436;c[111]=436;c[114]=444;c[113]=444;c[116]=452;c[115]=452;c[118]=460;c[117]=460;c[120]=468;c[119]=468;c[122]=476;c[121]=476;c[124]=484;c[123]=484;c[126]=492;c[125]=492;c[128]=500;c[127]=500;c[130]=508;c[129]=508;c[132]=516;c[131]=516;c[134]=524;c[133]=524;c[136]=532;c[135]=532;c[138]=540;c[137]=540;c[140]=548;c[139]=548;c[142]=556;c[141]=556;c[144]=564;c[143]=564;c[146]=572;c[145]=572;c[148]=580;c[147]=580;w=g+-40|0;t=h+8|0;t=(t&7|0)==0?0:0-t&7;u=h+t|0;t=w-t|0;c[79]=u;c[76]=t;c[u+4>>2]=t|1;c[h+w+4>>2]=40;c[80]=c[195]}while(0);b=c[76]|0;if(b>>>0>m>>>0){t=b-m|0;c[76]=t;w=c[79]|0;u=w+m|0;c[79]=u;c[u+4>>2]=t|1;c[w+4>>2]=m|3;w=w+8|0;v=x;return w|0}}c[(Ba()|0)>>2]=48;w=0;v=x;return w|0}function z(){var d=0,f=0,g=0,h=0,i=0,j=0,k=0;k=v;v=v+10240|0;a[795]=1;b[395]=0;b[396]=0;c[67]=c[2];a[796]=0;c[66]=0;a[794]=0;c[68]=k+2048;c[69]=k;a[797]=0;d=(c[3]|0)+-2|0;c[70]=d;f=d+(c[64]<<1)|0;c[71]=f;a:while(1){g=d+2|0;c[70]=g;if(d>>>0>=f>>>0){i=18;break}b:do switch(b[g>>1]|0){case 9:case 10:case 11:case 12:case 13:case 32:break;case 101:{if((((b[396]|0)==0?da(g)|0:0)?(Q(d+4|0,16,10)|0)==0:0)?(B(),(a[795]|0)==0):0){i=9;break a}else i=17;break}case 105:{if(da(g)|0?(Q(d+4|0,26,10)|0)==0:0){C();i=17}else i=17;break}case 59:{i=17;break}case 47:switch(b[d+4>>1]|0){case 47:{_();break b}case 42:{P(1);break b}default:{i=16;break a}}default:{i=16;break a}}while(0);if((i|0)==17){i=0;c[67]=c[70]}d=c[70]|0;f=c[71]|0}if((i|0)==9){d=c[70]|0;c[67]=d;i=19}else if((i|0)==16){a[795]=0;c[70]=d;i=19}else if((i|0)==18)if(!(a[794]|0)){d=g;i=19}else d=0;do if((i|0)==19){c:while(1){f=d+2|0;c[70]=f;h=f;if(d>>>0>=(c[71]|0)>>>0){i=82;break}d:do switch(b[f>>1]|0){case 9:case 10:case 11:case 12:case 13:case 32:break;case 101:{if(((b[396]|0)==0?da(f)|0:0)?(Q(d+4|0,16,10)|0)==0:0){B();i=81}else i=81;break}case 105:{if(da(f)|0?(Q(d+4|0,26,10)|0)==0:0){C();i=81}else i=81;break}case 99:{if((da(f)|0?(Q(d+4|0,36,8)|0)==0:0)?na(b[d+12>>1]|0)|0:0){a[797]=1;i=81}else i=81;break}case 40:{h=c[68]|0;f=b[396]|0;i=f&65535;c[h+(i<<3)>>2]=1;g=c[67]|0;b[396]=f+1<<16>>16;c[h+(i<<3)+4>>2]=g;i=81;break}case 41:{f=b[396]|0;if(!(f<<16>>16)){i=36;break c}f=f+-1<<16>>16;b[396]=f;g=b[395]|0;if(g<<16>>16!=0?(j=c[(c[69]|0)+((g&65535)+-1<<2)>>2]|0,(c[j+20>>2]|0)==(c[(c[68]|0)+((f&65535)<<3)+4>>2]|0)):0){f=j+4|0;if(!(c[f>>2]|0))c[f>>2]=h;c[j+12>>2]=d+4;b[395]=g+-1<<16>>16;i=81}else i=81;break}case 123:{i=c[67]|0;h=c[61]|0;d=i;do if((b[i>>1]|0)==41&(h|0)!=0?(c[h+4>>2]|0)==(i|0):0){f=c[62]|0;c[61]=f;if(!f){c[57]=0;break}else{c[f+28>>2]=0;break}}while(0);h=c[68]|0;g=b[396]|0;i=g&65535;c[h+(i<<3)>>2]=(a[797]|0)==0?2:6;b[396]=g+1<<16>>16;c[h+(i<<3)+4>>2]=d;a[797]=0;i=81;break}case 125:{d=b[396]|0;if(!(d<<16>>16)){i=49;break c}h=c[68]|0;i=d+-1<<16>>16;b[396]=i;if((c[h+((i&65535)<<3)>>2]|0)==4){H();i=81}else i=81;break}case 39:{J(39);i=81;break}case 34:{J(34);i=81;break}case 47:switch(b[d+4>>1]|0){case 47:{_();break d}case 42:{P(1);break d}default:{d=c[67]|0;h=b[d>>1]|0;e:do if(!(T(h)|0)){switch(h<<16>>16){case 41:if(ba(c[(c[68]|0)+(e[396]<<3)+4>>2]|0)|0){i=69;break e}else{i=66;break e}case 125:break;default:{i=66;break e}}f=c[68]|0;g=e[396]|0;if(!(O(c[f+(g<<3)+4>>2]|0)|0)?(c[f+(g<<3)>>2]|0)!=6:0)i=66;else i=69}else switch(h<<16>>16){case 46:if(((b[d+-2>>1]|0)+-48&65535)<10){i=66;break e}else{i=69;break e}case 43:if((b[d+-2>>1]|0)==43){i=66;break e}else{i=69;break e}case 45:if((b[d+-2>>1]|0)==45){i=66;break e}else{i=69;break e}default:{i=69;break e}}while(0);f:do if((i|0)==66){i=0;if(!(D(d)|0)){switch(h<<16>>16){case 0:{i=69;break f}case 47:{if(a[796]|0){i=69;break f}break}default:{}}g=c[3]|0;f=h;do{if(d>>>0<=g>>>0)break;d=d+-2|0;c[67]=d;f=b[d>>1]|0}while(!(Z(f)|0));if(ca(f)|0){do{if(d>>>0<=g>>>0)break;d=d+-2|0;c[67]=d}while(ca(b[d>>1]|0)|0);if(X(d)|0){N();a[796]=0;i=81;break d}else d=1}else d=1}else i=69}while(0);if((i|0)==69){N();d=0}a[796]=d;i=81;break d}}case 96:{h=c[68]|0;g=b[396]|0;i=g&65535;c[h+(i<<3)+4>>2]=c[67];b[396]=g+1<<16>>16;c[h+(i<<3)>>2]=3;H();i=81;break}default:i=81}while(0);if((i|0)==81){i=0;c[67]=c[70]}d=c[70]|0}if((i|0)==36){ma();d=0;break}else if((i|0)==49){ma();d=0;break}else if((i|0)==82){d=(a[794]|0)==0?(b[395]|b[396])<<16>>16==0:0;break}}while(0);v=k;return d|0}function A(a){a=a|0;var b=0,d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0;if(!a)return;d=a+-8|0;e=c[77]|0;a=c[a+-4>>2]|0;b=a&-8;k=d+b|0;do if(!(a&1)){f=c[d>>2]|0;if(!(a&3))return;g=d+(0-f)|0;h=f+b|0;if(g>>>0<e>>>0)return;if((c[78]|0)==(g|0)){b=k+4|0;a=c[b>>2]|0;if((a&3|0)!=3){i=g;j=g;b=h;break}c[75]=h;c[b>>2]=a&-2;c[g+4>>2]=h|1;c[g+h>>2]=h;return}d=f>>>3;if(f>>>0<256){a=c[g+8>>2]|0;b=c[g+12>>2]|0;if((b|0)==(a|0)){c[73]=c[73]&~(1<<d);i=g;j=g;b=h;break}else{c[a+12>>2]=b;c[b+8>>2]=a;i=g;j=g;b=h;break}}f=c[g+24>>2]|0;a=c[g+12>>2]|0;do if((a|0)==(g|0)){d=g+16|0;b=d+4|0;a=c[b>>2]|0;if(!a){a=c[d>>2]|0;if(!a){d=0;break}else b=d}while(1){e=a+20|0;d=c[e>>2]|0;if(!d){e=a+16|0;d=c[e>>2]|0;if(!d)break;else{a=d;b=e}}else{a=d;b=e}}c[b>>2]=0;d=a}else{d=c[g+8>>2]|0;c[d+12>>2]=a;c[a+8>>2]=d;d=a}while(0);if(f){a=c[g+28>>2]|0;b=596+(a<<2)|0;if((c[b>>2]|0)==(g|0)){c[b>>2]=d;if(!d){c[74]=c[74]&~(1<<a);i=g;j=g;b=h;break}}else{j=f+16|0;c[((c[j>>2]|0)==(g|0)?j:f+20|0)>>2]=d;if(!d){i=g;j=g;b=h;break}}c[d+24>>2]=f;b=g+16|0;a=c[b>>2]|0;if(a|0){c[d+16>>2]=a;c[a+24>>2]=d}a=c[b+4>>2]|0;if(a){c[d+20>>2]=a;c[a+24>>2]=d;i=g;j=g;b=h}else{i=g;j=g;b=h}}else{i=g;j=g;b=h}}else{i=d;j=d}while(0);if(i>>>0>=k>>>0)return;a=k+4|0;d=c[a>>2]|0;if(!(d&1))return;if(!(d&2)){if((c[79]|0)==(k|0)){k=(c[76]|0)+b|0;c[76]=k;c[79]=j;c[j+4>>2]=k|1;if((j|0)!=(c[78]|0))return;c[78]=0;c[75]=0;return}if((c[78]|0)==(k|0)){k=(c[75]|0)+b|0;c[75]=k;c[78]=i;c[j+4>>2]=k|1;c[i+k>>2]=k;return}f=(d&-8)+b|0;e=d>>>3;do if(d>>>0<256){b=c[k+8>>2]|0;a=c[k+12>>2]|0;if((a|0)==(b|0)){c[73]=c[73]&~(1<<e);break}else{c[b+12>>2]=a;c[a+8>>2]=b;break}}else{g=c[k+24>>2]|0;a=c[k+12>>2]|0;do if((a|0)==(k|0)){d=k+16|0;b=d+4|0;a=c[b>>2]|0;if(!a){a=c[d>>2]|0;if(!a){d=0;break}else b=d}while(1){e=a+20|0;d=c[e>>2]|0;if(!d){e=a+16|0;d=c[e>>2]|0;if(!d)break;else{a=d;b=e}}else{a=d;b=e}}c[b>>2]=0;d=a}else{d=c[k+8>>2]|0;c[d+12>>2]=a;c[a+8>>2]=d;d=a}while(0);if(g|0){a=c[k+28>>2]|0;b=596+(a<<2)|0;if((c[b>>2]|0)==(k|0)){c[b>>2]=d;if(!d){c[74]=c[74]&~(1<<a);break}}else{h=g+16|0;c[((c[h>>2]|0)==(k|0)?h:g+20|0)>>2]=d;if(!d)break}c[d+24>>2]=g;b=k+16|0;a=c[b>>2]|0;if(a|0){c[d+16>>2]=a;c[a+24>>2]=d}a=c[b+4>>2]|0;if(a|0){c[d+20>>2]=a;c[a+24>>2]=d}}}while(0);c[j+4>>2]=f|1;c[i+f>>2]=f;if((j|0)==(c[78]|0)){c[75]=f;return}}else{c[a>>2]=d&-2;c[j+4>>2]=b|1;c[i+b>>2]=b;f=b}a=f>>>3;if(f>>>0<256){d=332+(a<<1<<2)|0;b=c[73]|0;a=1<<a;if(!(b&a)){c[73]=b|a;a=d+8|0;b=d}else{b=d+8|0;a=b;b=c[b>>2]|0}c[a>>2]=j;c[b+12>>2]=j;c[j+8>>2]=b;c[j+12>>2]=d;return}a=f>>>8;if(a)if(f>>>0>16777215)e=31;else{i=(a+1048320|0)>>>16&8;k=a<<i;h=(k+520192|0)>>>16&4;k=k<<h;e=(k+245760|0)>>>16&2;e=14-(h|i|e)+(k<<e>>>15)|0;e=f>>>(e+7|0)&1|e<<1}else e=0;b=596+(e<<2)|0;c[j+28>>2]=e;c[j+20>>2]=0;c[j+16>>2]=0;a=c[74]|0;d=1<<e;a:do if(!(a&d)){c[74]=a|d;c[b>>2]=j;c[j+24>>2]=b;c[j+12>>2]=j;c[j+8>>2]=j}else{a=c[b>>2]|0;b:do if((c[a+4>>2]&-8|0)!=(f|0)){e=f<<((e|0)==31?0:25-(e>>>1)|0);while(1){d=a+16+(e>>>31<<2)|0;b=c[d>>2]|0;if(!b)break;if((c[b+4>>2]&-8|0)==(f|0)){a=b;break b}else{e=e<<1;a=b}}c[d>>2]=j;c[j+24>>2]=a;c[j+12>>2]=j;c[j+8>>2]=j;break a}while(0);i=a+8|0;k=c[i>>2]|0;c[k+12>>2]=j;c[i>>2]=j;c[j+8>>2]=k;c[j+12>>2]=a;c[j+24>>2]=0}while(0);k=(c[81]|0)+-1|0;c[81]=k;if(k|0)return;a=748;while(1){a=c[a>>2]|0;if(!a)break;else a=a+8|0}c[81]=-1;return}function B(){var d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0;h=c[70]|0;i=c[63]|0;l=h+12|0;c[70]=l;f=I(1)|0;d=c[70]|0;if(!((d|0)==(l|0)?!(S(f)|0):0))k=3;a:do if((k|0)==3){b:do switch(f<<16>>16){case 123:{c[70]=d+2;d=I(1)|0;f=c[70]|0;while(1){if(oa(d)|0){J(d);d=(c[70]|0)+2|0;c[70]=d}else{$(d)|0;d=c[70]|0}I(1)|0;d=K(f,d)|0;if(d<<16>>16==44){c[70]=(c[70]|0)+2;d=I(1)|0}e=f;f=c[70]|0;if(d<<16>>16==125){k=15;break}if((f|0)==(e|0)){k=12;break}if(f>>>0>(c[71]|0)>>>0){k=14;break}}if((k|0)==12){ma();break a}else if((k|0)==14){ma();break a}else if((k|0)==15){c[70]=f+2;break b}break}case 42:{c[70]=d+2;I(1)|0;l=c[70]|0;K(l,l)|0;break}default:{a[795]=0;switch(f<<16>>16){case 100:{h=d+14|0;c[70]=h;e=I(1)|0;if(e<<16>>16==97){e=c[70]|0;if((da(e)|0?(Q(e+2|0,58,8)|0)==0:0)?(g=e+10|0,ca(b[g>>1]|0)|0):0){c[70]=g;e=I(0)|0;k=23}else{e=97;k=32}}else k=23;c:do if((k|0)==23){if(e<<16>>16==102){e=c[70]|0;if(!(da(e)|0)){e=102;k=32;break}if(Q(e+2|0,66,14)|0){e=102;k=32;break}f=e+16|0;e=b[f>>1]|0;if(!(na(e)|0))switch(e<<16>>16){case 40:case 42:break;default:{e=102;k=32;break c}}c[70]=f;e=I(1)|0;if(e<<16>>16==42){c[70]=(c[70]|0)+2;e=I(1)|0}if(e<<16>>16==40){W(d,h,0,0);c[70]=d+12;break a}else g=1}else g=0;f=c[70]|0;do if(e<<16>>16==99)if((da(f)|0?(Q(f+2|0,36,8)|0)==0:0)?(j=f+10|0,l=b[j>>1]|0,na(l)|0|l<<16>>16==123):0){c[70]=j;e=I(1)|0;if(e<<16>>16==123){W(d,h,0,0);c[70]=d+12;break a}else{f=c[70]|0;$(e)|0;break}}else{e=99;k=40}else k=40;while(0);if((k|0)==40){$(e)|0;if(!g){k=43;break}}e=c[70]|0;if(e>>>0>f>>>0){W(d,h,f,e);d=(c[70]|0)+-2|0}else k=43}while(0);if((k|0)==32){$(e)|0;k=43}if((k|0)==43){W(d,h,0,0);d=d+12|0}c[70]=d;break a}case 97:{c[70]=d+10;I(1)|0;d=c[70]|0;k=46;break}case 102:{k=46;break}case 99:{if((Q(d+2|0,36,8)|0)==0?(e=d+10|0,Z(b[e>>1]|0)|0):0){c[70]=e;l=I(1)|0;k=c[70]|0;$(l)|0;l=c[70]|0;W(k,l,k,l);c[70]=(c[70]|0)+-2;break a}d=d+4|0;c[70]=d;break}case 108:case 118:break;default:break a}if((k|0)==46){c[70]=d+16;d=I(1)|0;if(d<<16>>16==42){c[70]=(c[70]|0)+2;d=I(1)|0}k=c[70]|0;$(d)|0;l=c[70]|0;W(k,l,k,l);c[70]=(c[70]|0)+-2;break a}d=d+4|0;c[70]=d;a[795]=0;d:while(1){c[70]=d+2;l=I(1)|0;d=c[70]|0;switch(($(l)|0)<<16>>16){case 91:case 123:break d;default:{}}e=c[70]|0;if((e|0)==(d|0))break a;W(d,e,d,e);if((I(1)|0)<<16>>16!=44)break;d=c[70]|0}c[70]=(c[70]|0)+-2;break a}}while(0);l=(I(1)|0)<<16>>16==102;d=c[70]|0;if(l?(Q(d+2|0,52,6)|0)==0:0){c[70]=d+8;E(h,I(1)|0);d=(i|0)==0?232:i+16|0;while(1){d=c[d>>2]|0;if(!d)break a;c[d+12>>2]=0;c[d+8>>2]=0;d=d+16|0}}c[70]=d+-2}while(0);return}function C(){var d=0,e=0,f=0,g=0,h=0,i=0;h=c[70]|0;e=h+12|0;c[70]=e;a:do switch((I(1)|0)<<16>>16){case 40:{e=c[68]|0;i=b[396]|0;f=i&65535;c[e+(f<<3)>>2]=5;d=c[70]|0;b[396]=i+1<<16>>16;c[e+(f<<3)+4>>2]=d;if((b[c[67]>>1]|0)!=46){c[70]=d+2;i=I(1)|0;L(h,c[70]|0,0,d);e=c[61]|0;f=c[69]|0;h=b[395]|0;b[395]=h+1<<16>>16;c[f+((h&65535)<<2)>>2]=e;switch(i<<16>>16){case 39:{J(39);break}case 34:{J(34);break}default:{c[70]=(c[70]|0)+-2;break a}}d=(c[70]|0)+2|0;c[70]=d;switch((I(1)|0)<<16>>16){case 44:{c[70]=(c[70]|0)+2;I(1)|0;h=c[61]|0;c[h+4>>2]=d;i=c[70]|0;c[h+16>>2]=i;a[h+24>>0]=1;c[70]=i+-2;break a}case 41:{b[396]=(b[396]|0)+-1<<16>>16;i=c[61]|0;c[i+4>>2]=d;c[i+12>>2]=(c[70]|0)+2;a[i+24>>0]=1;b[395]=(b[395]|0)+-1<<16>>16;break a}default:{c[70]=(c[70]|0)+-2;break a}}}break}case 46:{c[70]=(c[70]|0)+2;if(((I(1)|0)<<16>>16==109?(d=c[70]|0,(Q(d+2|0,44,6)|0)==0):0)?(b[c[67]>>1]|0)!=46:0)L(h,h,d+8|0,2);break}case 42:case 39:case 34:{g=17;break}case 123:{d=c[70]|0;if(b[396]|0){c[70]=d+-2;break a}while(1){if(d>>>0>=(c[71]|0)>>>0)break;d=I(1)|0;if(!(oa(d)|0)){if(d<<16>>16==125){g=32;break}}else J(d);d=(c[70]|0)+2|0;c[70]=d}if((g|0)==32)c[70]=(c[70]|0)+2;I(1)|0;d=c[70]|0;if(Q(d,50,8)|0){ma();break a}c[70]=d+8;d=I(1)|0;if(oa(d)|0){E(h,d);break a}else{ma();break a}}default:if((c[70]|0)==(e|0))c[70]=h+10;else g=17}while(0);do if((g|0)==17){if(b[396]|0){c[70]=(c[70]|0)+-2;break}d=c[71]|0;e=c[70]|0;while(1){if(e>>>0>=d>>>0){g=24;break}f=b[e>>1]|0;if(oa(f)|0){g=22;break}i=e+2|0;c[70]=i;e=i}if((g|0)==22){E(h,f);break}else if((g|0)==24){ma();break}}while(0);return}function D(a){a=a|0;a:do switch(b[a>>1]|0){case 100:switch(b[a+-2>>1]|0){case 105:{a=V(a+-4|0,90,2)|0;break a}case 108:{a=V(a+-4|0,94,3)|0;break a}default:{a=0;break a}}case 101:switch(b[a+-2>>1]|0){case 115:switch(b[a+-4>>1]|0){case 108:{a=Y(a+-6|0,101)|0;break a}case 97:{a=Y(a+-6|0,99)|0;break a}default:{a=0;break a}}case 116:{a=V(a+-4|0,100,4)|0;break a}case 117:{a=V(a+-4|0,108,6)|0;break a}default:{a=0;break a}}case 102:{if((b[a+-2>>1]|0)==111?(b[a+-4>>1]|0)==101:0)switch(b[a+-6>>1]|0){case 99:{a=V(a+-8|0,120,6)|0;break a}case 112:{a=V(a+-8|0,132,2)|0;break a}default:{a=0;break a}}else a=0;break}case 107:{a=V(a+-2|0,136,4)|0;break}case 110:{a=a+-2|0;if(Y(a,105)|0)a=1;else a=V(a,144,5)|0;break}case 111:{a=Y(a+-2|0,100)|0;break}case 114:{a=V(a+-2|0,154,7)|0;break}case 116:{a=V(a+-2|0,168,4)|0;break}case 119:switch(b[a+-2>>1]|0){case 101:{a=Y(a+-4|0,110)|0;break a}case 111:{a=V(a+-4|0,176,3)|0;break a}default:{a=0;break a}}default:a=0}while(0);return a|0}function E(a,b){a=a|0;b=b|0;var d=0,e=0;d=(c[70]|0)+2|0;switch(b<<16>>16){case 39:{J(39);e=5;break}case 34:{J(34);e=5;break}default:ma()}do if((e|0)==5){L(a,d,c[70]|0,1);c[70]=(c[70]|0)+2;e=(I(0)|0)<<16>>16==97;b=c[70]|0;if(e?(Q(b+2|0,80,10)|0)==0:0){c[70]=b+12;if((I(1)|0)<<16>>16!=123){c[70]=b;break}a=c[70]|0;d=a;a:while(1){c[70]=d+2;d=I(1)|0;switch(d<<16>>16){case 39:{J(39);c[70]=(c[70]|0)+2;d=I(1)|0;break}case 34:{J(34);c[70]=(c[70]|0)+2;d=I(1)|0;break}default:d=$(d)|0}if(d<<16>>16!=58){e=16;break}c[70]=(c[70]|0)+2;switch((I(1)|0)<<16>>16){case 39:{J(39);break}case 34:{J(34);break}default:{e=20;break a}}c[70]=(c[70]|0)+2;switch((I(1)|0)<<16>>16){case 125:{e=25;break a}case 44:break;default:{e=24;break a}}c[70]=(c[70]|0)+2;if((I(1)|0)<<16>>16==125){e=25;break}d=c[70]|0}if((e|0)==16){c[70]=b;break}else if((e|0)==20){c[70]=b;break}else if((e|0)==24){c[70]=b;break}else if((e|0)==25){e=c[61]|0;c[e+16>>2]=a;c[e+12>>2]=(c[70]|0)+2;break}}c[70]=b+-2}while(0);return}function F(b,d,e){b=b|0;d=d|0;e=e|0;var f=0,g=0,h=0;if((e|0)>=512){t(b|0,d|0,e|0)|0;return b|0}h=b|0;g=b+e|0;if((b&3)==(d&3)){while(b&3){if(!e)return h|0;a[b>>0]=a[d>>0]|0;b=b+1|0;d=d+1|0;e=e-1|0}e=g&-4|0;f=e-64|0;while((b|0)<=(f|0)){c[b>>2]=c[d>>2];c[b+4>>2]=c[d+4>>2];c[b+8>>2]=c[d+8>>2];c[b+12>>2]=c[d+12>>2];c[b+16>>2]=c[d+16>>2];c[b+20>>2]=c[d+20>>2];c[b+24>>2]=c[d+24>>2];c[b+28>>2]=c[d+28>>2];c[b+32>>2]=c[d+32>>2];c[b+36>>2]=c[d+36>>2];c[b+40>>2]=c[d+40>>2];c[b+44>>2]=c[d+44>>2];c[b+48>>2]=c[d+48>>2];c[b+52>>2]=c[d+52>>2];c[b+56>>2]=c[d+56>>2];c[b+60>>2]=c[d+60>>2];b=b+64|0;d=d+64|0}while((b|0)<(e|0)){c[b>>2]=c[d>>2];b=b+4|0;d=d+4|0}}else{e=g-4|0;while((b|0)<(e|0)){a[b>>0]=a[d>>0]|0;a[b+1>>0]=a[d+1>>0]|0;a[b+2>>0]=a[d+2>>0]|0;a[b+3>>0]=a[d+3>>0]|0;b=b+4|0;d=d+4|0}}while((b|0)<(g|0)){a[b>>0]=a[d>>0]|0;b=b+1|0;d=d+1|0}return h|0}function G(b,d,e){b=b|0;d=d|0;e=e|0;var f=0,g=0,h=0,i=0;h=b+e|0;d=d&255;if((e|0)>=67){while(b&3){a[b>>0]=d;b=b+1|0}f=h&-4|0;i=d|d<<8|d<<16|d<<24;g=f-64|0;while((b|0)<=(g|0)){c[b>>2]=i;c[b+4>>2]=i;c[b+8>>2]=i;c[b+12>>2]=i;c[b+16>>2]=i;c[b+20>>2]=i;c[b+24>>2]=i;c[b+28>>2]=i;c[b+32>>2]=i;c[b+36>>2]=i;c[b+40>>2]=i;c[b+44>>2]=i;c[b+48>>2]=i;c[b+52>>2]=i;c[b+56>>2]=i;c[b+60>>2]=i;b=b+64|0}while((b|0)<(f|0)){c[b>>2]=i;b=b+4|0}}while((b|0)<(h|0)){a[b>>0]=d;b=b+1|0}return h-e|0}function H(){var a=0,d=0,e=0,f=0;d=c[71]|0;e=c[70]|0;a:while(1){a=e+2|0;if(e>>>0>=d>>>0){d=10;break}switch(b[a>>1]|0){case 96:{d=7;break a}case 36:{if((b[e+4>>1]|0)==123){d=6;break a}break}case 92:{a=e+4|0;break}default:{}}e=a}if((d|0)==6){a=e+4|0;c[70]=a;d=c[68]|0;f=b[396]|0;e=f&65535;c[d+(e<<3)>>2]=4;b[396]=f+1<<16>>16;c[d+(e<<3)+4>>2]=a}else if((d|0)==7){c[70]=a;e=c[68]|0;f=(b[396]|0)+-1<<16>>16;b[396]=f;if((c[e+((f&65535)<<3)>>2]|0)!=3)ma()}else if((d|0)==10){c[70]=a;ma()}return}function I(a){a=a|0;var d=0,e=0,f=0;e=c[70]|0;a:do{d=b[e>>1]|0;b:do if(d<<16>>16!=47)if(a)if(na(d)|0)break;else break a;else if(ca(d)|0)break;else break a;else switch(b[e+2>>1]|0){case 47:{_();break b}case 42:{P(a);break b}default:{d=47;break a}}while(0);f=c[70]|0;e=f+2|0;c[70]=e}while(f>>>0<(c[71]|0)>>>0);return d|0}function J(a){a=a|0;var d=0,e=0,f=0,g=0;g=c[71]|0;d=c[70]|0;while(1){f=d+2|0;if(d>>>0>=g>>>0){d=9;break}e=b[f>>1]|0;if(e<<16>>16==a<<16>>16){d=10;break}if(e<<16>>16==92){e=d+4|0;if((b[e>>1]|0)==13){d=d+6|0;d=(b[d>>1]|0)==10?d:e}else d=e}else if(ra(e)|0){d=9;break}else d=f}if((d|0)==9){c[70]=f;ma()}else if((d|0)==10)c[70]=f;return}function K(a,d){a=a|0;d=d|0;var e=0,f=0,g=0,h=0;e=c[70]|0;f=b[e>>1]|0;h=(a|0)==(d|0);g=h?0:a;h=h?0:d;if(f<<16>>16==97){c[70]=e+4;e=I(1)|0;a=c[70]|0;if(oa(e)|0){J(e);d=(c[70]|0)+2|0;c[70]=d}else{$(e)|0;d=c[70]|0}f=I(1)|0;e=c[70]|0}if((e|0)!=(a|0))W(a,d,g,h);return f|0}function L(b,d,e,f){b=b|0;d=d|0;e=e|0;f=f|0;var g=0,h=0;g=c[65]|0;c[65]=g+32;h=c[61]|0;c[((h|0)==0?228:h+28|0)>>2]=g;c[62]=h;c[61]=g;c[g+8>>2]=b;if(2==(f|0))b=e;else b=1==(f|0)?e+2|0:0;c[g+12>>2]=b;c[g>>2]=d;c[g+4>>2]=e;c[g+16>>2]=0;c[g+20>>2]=f;a[g+24>>0]=1==(f|0)&1;c[g+28>>2]=0;return}function M(){var a=0,d=0,e=0;e=c[71]|0;d=c[70]|0;a:while(1){a=d+2|0;if(d>>>0>=e>>>0){d=6;break}switch(b[a>>1]|0){case 13:case 10:{d=6;break a}case 93:{d=7;break a}case 92:{a=d+4|0;break}default:{}}d=a}if((d|0)==6){c[70]=a;ma();a=0}else if((d|0)==7){c[70]=a;a=93}return a|0}function N(){var a=0,d=0,e=0;a:while(1){a=c[70]|0;d=a+2|0;c[70]=d;if(a>>>0>=(c[71]|0)>>>0){e=7;break}switch(b[d>>1]|0){case 13:case 10:{e=7;break a}case 47:break a;case 91:{M()|0;break}case 92:{c[70]=a+4;break}default:{}}}if((e|0)==7)ma();return}function O(a){a=a|0;switch(b[a>>1]|0){case 62:{a=(b[a+-2>>1]|0)==61;break}case 41:case 59:{a=1;break}case 104:{a=V(a+-2|0,202,4)|0;break}case 121:{a=V(a+-2|0,210,6)|0;break}case 101:{a=V(a+-2|0,222,3)|0;break}default:a=0}return a|0}function P(a){a=a|0;var d=0,e=0,f=0,g=0,h=0;g=(c[70]|0)+2|0;c[70]=g;e=c[71]|0;while(1){d=g+2|0;if(g>>>0>=e>>>0)break;f=b[d>>1]|0;if(!a?ra(f)|0:0)break;if(f<<16>>16==42?(b[g+4>>1]|0)==47:0){h=8;break}g=d}if((h|0)==8){c[70]=d;d=g+4|0}c[70]=d;return}function Q(b,c,d){b=b|0;c=c|0;d=d|0;var e=0,f=0;a:do if(!d)b=0;else{while(1){e=a[b>>0]|0;f=a[c>>0]|0;if(e<<24>>24!=f<<24>>24)break;d=d+-1|0;if(!d){b=0;break a}else{b=b+1|0;c=c+1|0}}b=(e&255)-(f&255)|0}while(0);return b|0}function R(a){a=a|0;var b=0,d=0,e=0;e=a+3&-4;d=za()|0;a=c[d>>2]|0;b=a+e|0;do if((e|0)<1|b>>>0>a>>>0){if(b>>>0>(s()|0)>>>0?(u(b|0)|0)==0:0)break;c[d>>2]=b;e=a;return e|0}while(0);c[(Ba()|0)>>2]=48;e=-1;return e|0}function S(a){a=a|0;a:do switch(a<<16>>16){case 38:case 37:case 33:{a=1;break}default:if((a&-8)<<16>>16==40|(a+-58&65535)<6)a=1;else{switch(a<<16>>16){case 91:case 93:case 94:{a=1;break a}default:{}}a=(a+-123&65535)<4}}while(0);return a|0}function T(a){a=a|0;a:do switch(a<<16>>16){case 38:case 37:case 33:break;default:if(!((a+-58&65535)<6|(a+-40&65535)<7&a<<16>>16!=41)){switch(a<<16>>16){case 91:case 94:break a;default:{}}return a<<16>>16!=125&(a+-123&65535)<4|0}}while(0);return 1}function U(a){a=a|0;var d=0,e=0,f=0,g=0;e=v;v=v+16|0;f=e;c[f>>2]=0;c[64]=a;d=c[3]|0;g=d+(a<<1)|0;a=g+2|0;b[g>>1]=0;c[f>>2]=a;c[65]=a;c[57]=0;c[61]=0;c[59]=0;c[58]=0;c[63]=0;c[60]=0;v=e;return d|0}function V(a,d,e){a=a|0;d=d|0;e=e|0;var f=0,g=0;f=a+(0-e<<1)|0;g=f+2|0;a=c[3]|0;if(g>>>0>=a>>>0?(Q(g,d,e<<1)|0)==0:0)if((g|0)==(a|0))a=1;else a=Z(b[f>>1]|0)|0;else a=0;return a|0}function W(a,b,d,e){a=a|0;b=b|0;d=d|0;e=e|0;var f=0,g=0;f=c[65]|0;c[65]=f+20;g=c[63]|0;c[((g|0)==0?232:g+16|0)>>2]=f;c[63]=f;c[f>>2]=a;c[f+4>>2]=b;c[f+8>>2]=d;c[f+12>>2]=e;c[f+16>>2]=0;return}function X(a){a=a|0;switch(b[a>>1]|0){case 107:{a=V(a+-2|0,136,4)|0;break}case 101:{if((b[a+-2>>1]|0)==117)a=V(a+-4|0,108,6)|0;else a=0;break}default:a=0}return a|0}function Y(a,d){a=a|0;d=d|0;var e=0;e=c[3]|0;if(e>>>0<=a>>>0?(b[a>>1]|0)==d<<16>>16:0)if((e|0)==(a|0))e=1;else e=Z(b[a+-2>>1]|0)|0;else e=0;return e|0}function Z(a){a=a|0;a:do if((a+-9&65535)<5)a=1;else{switch(a<<16>>16){case 32:case 160:{a=1;break a}default:{}}a=a<<16>>16!=46&(S(a)|0)}while(0);return a|0}function _(){var a=0,d=0,e=0;a=c[71]|0;e=c[70]|0;a:while(1){d=e+2|0;if(e>>>0>=a>>>0)break;switch(b[d>>1]|0){case 13:case 10:break a;default:e=d}}c[70]=d;return}function $(a){a=a|0;while(1){if(na(a)|0)break;if(S(a)|0)break;a=(c[70]|0)+2|0;c[70]=a;a=b[a>>1]|0;if(!(a<<16>>16)){a=0;break}}return a|0}function aa(){var a=0;a=c[(c[59]|0)+20>>2]|0;switch(a|0){case 1:{a=-1;break}case 2:{a=-2;break}default:a=a-(c[3]|0)>>1}return a|0}function ba(a){a=a|0;if(!(V(a,182,5)|0)?!(V(a,192,3)|0):0)a=V(a,198,2)|0;else a=1;return a|0}function ca(a){a=a|0;switch(a<<16>>16){case 160:case 32:case 12:case 11:case 9:{a=1;break}default:a=0}return a|0}function da(a){a=a|0;if((c[3]|0)==(a|0))a=1;else a=Z(b[a+-2>>1]|0)|0;return a|0}function ea(){var a=0;a=c[(c[60]|0)+12>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function fa(){var a=0;a=c[(c[59]|0)+12>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ga(){var a=0;a=c[(c[60]|0)+8>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ha(){var a=0;a=c[(c[59]|0)+16>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ia(){var a=0;a=c[(c[59]|0)+4>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ja(){var a=0;a=c[59]|0;a=c[((a|0)==0?228:a+28|0)>>2]|0;c[59]=a;return (a|0)!=0|0}function ka(){var a=0;a=c[60]|0;a=c[((a|0)==0?232:a+16|0)>>2]|0;c[60]=a;return (a|0)!=0|0}function la(a){a=a|0;var b=0;b=v;v=v+a|0;v=v+15&-16;return b|0}function ma(){a[794]=1;c[66]=(c[70]|0)-(c[3]|0)>>1;c[70]=(c[71]|0)+2;return}function na(a){a=a|0;return (a|128)<<16>>16==160|(a+-9&65535)<5|0}function oa(a){a=a|0;return a<<16>>16==39|a<<16>>16==34|0}function pa(){return (c[(c[59]|0)+8>>2]|0)-(c[3]|0)>>1|0}function qa(){return (c[(c[60]|0)+4>>2]|0)-(c[3]|0)>>1|0}function ra(a){a=a|0;return a<<16>>16==13|a<<16>>16==10|0}function sa(){return (c[c[59]>>2]|0)-(c[3]|0)>>1|0}function ta(){return (c[c[60]>>2]|0)-(c[3]|0)>>1|0}function ua(){return d[(c[59]|0)+24>>0]|0|0}function va(a){a=a|0;c[3]=a;return}function wa(){c[3]=g}function xa(a){a=a|0;v=a}function ya(){return (a[795]|0)!=0|0}function za(){return 816}function Aa(){return v|0}function Ba(){return 288}function Ca(){return c[66]|0}
-
-// EMSCRIPTEN_END_FUNCS
-return{___errno_location:Ba,__apply_relocations:wa,_ai:ha,_e:Ca,_ee:qa,_ele:ea,_els:ga,_emscripten_get_sbrk_ptr:za,_es:ta,_f:ya,_free:A,_id:aa,_ie:ia,_ip:ua,_is:sa,_malloc:y,_memcpy:F,_memset:G,_parse:z,_re:ka,_ri:ja,_sa:U,_se:fa,_setSource:va,_ss:pa,stackAlloc:la,stackRestore:xa,stackSave:Aa}})
-
+function asmFunc(imports) {
+ var buffer = new ArrayBuffer(65536);
+ var HEAP8 = new Int8Array(buffer);
+ var HEAP16 = new Int16Array(buffer);
+ var HEAP32 = new Int32Array(buffer);
+ var HEAPU8 = new Uint8Array(buffer);
+ var HEAPU16 = new Uint16Array(buffer);
+ var HEAPU32 = new Uint32Array(buffer);
+ var Math_imul = Math.imul;
+ var Math_clz32 = Math.clz32;
+ var i64toi32_i32$HIGH_BITS = 0;
+ var global$0 = 22464;
+ function $0(l0, l1, l2, l3, l4) {
+  var l5 = 0, l6 = 0, l7 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+  label$1 : {
+   label$2 : {
+    s0 = l0;
+    s0 = HEAPU8[s0 + 88 | 0];
+    s1 = 1;
+    s0 = s0 & s1;
+    s0 = !s0 | 0;
+    if (s0) { break label$2; }
+    label$3 : {
+     label$4 : {
+      s0 = 0;
+      s0 = HEAP32[(s0 + 8948 | 0) >> 2];
+      s1 = l4;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$4; }
+      s0 = 0;
+      s0 = HEAP32[(s0 + 8952 | 0) >> 2];
+      s1 = l4;
+      s0 = (s0 | 0) != (s1 | 0) | 0;
+      if (s0) { break label$3; }
+     }
+     s0 = l0;
+     s1 = 100;
+     s0 = s0 + s1 | 0;
+     l5 = s0;
+     break label$1;
+    }
+    s0 = 32;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 4 | 0) >> 2];
+    s2 = l0;
+    s2 = HEAP32[s2 >> 2];
+    s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+    l5 = s0;
+    break label$1;
+   }
+   s0 = 32;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 4 | 0) >> 2];
+   s2 = l0;
+   s2 = HEAP32[s2 >> 2];
+   s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+   l5 = s0;
+   label$5 : {
+    label$6 : {
+     s0 = l0;
+     s0 = HEAP32[(s0 + 12 | 0) >> 2];
+     l6 = s0;
+     if (s0) { break label$6; }
+     s0 = l0;
+     s0 = HEAP32[(s0 + 8 | 0) >> 2];
+     l7 = s0;
+     break label$5;
+    }
+    s0 = l6;
+    s1 = 28;
+    s0 = s0 + s1 | 0;
+    l7 = s0;
+   }
+   s0 = l7;
+   s1 = l5;
+   HEAP32[s0 >> 2] = s1;
+   s0 = l0;
+   s1 = l5;
+   HEAP32[(s0 + 12 | 0) >> 2] = s1;
+   s0 = l0;
+   s1 = l6;
+   HEAP32[(s0 + 16 | 0) >> 2] = s1;
+   s0 = l0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 72 | 0) >> 2];
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 72 | 0) >> 2] = s1;
+  }
+  label$7 : {
+   s0 = 0;
+   s0 = HEAP32[(s0 + 8948 | 0) >> 2];
+   l6 = s0;
+   s1 = l4;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   if (s0) { break label$7; }
+   s0 = l0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 96 | 0) >> 2];
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 96 | 0) >> 2] = s1;
+  }
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8952 | 0) >> 2];
+  l0 = s0;
+  s0 = l5;
+  s1 = l2;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l5;
+  s1 = l1;
+  HEAP32[(s0 + 8 | 0) >> 2] = s1;
+  s0 = l5;
+  s1 = l4;
+  HEAP32[(s0 + 20 | 0) >> 2] = s1;
+  s0 = l5;
+  s1 = 0;
+  HEAP32[(s0 + 16 | 0) >> 2] = s1;
+  s0 = l5;
+  s1 = l3;
+  HEAP32[(s0 + 4 | 0) >> 2] = s1;
+  s0 = l5;
+  s1 = 0;
+  HEAP32[(s0 + 28 | 0) >> 2] = s1;
+  s0 = l5;
+  s1 = 0;
+  HEAP8[s0 + 25 | 0] = s1;
+  s0 = l5;
+  s1 = l3;
+  s2 = l3;
+  s3 = 1;
+  s2 = s2 + s3 | 0;
+  s3 = 0;
+  s4 = l6;
+  s5 = l4;
+  s4 = (s4 | 0) == (s5 | 0) | 0;
+  s2 = s4 ? s2 : s3;
+  s3 = l0;
+  s4 = l4;
+  s3 = (s3 | 0) == (s4 | 0) | 0;
+  s1 = s3 ? s1 : s2;
+  HEAP32[(s0 + 12 | 0) >> 2] = s1;
+  s0 = l5;
+  s1 = 0;
+  s1 = HEAP32[(s1 + 8948 | 0) >> 2];
+  s2 = l4;
+  s1 = (s1 | 0) == (s2 | 0) | 0;
+  HEAP8[s0 + 24 | 0] = s1;
+  s0 = l5;
+  return s0;
+ }
+ function $1(l0, l1, l2, l3, l4) {
+  var l5 = 0, l6 = 0, s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   s0 = l0;
+   s0 = HEAPU8[s0 + 88 | 0];
+   s1 = 2;
+   s0 = s0 & s1;
+   if (s0) { break label$1; }
+   s0 = 24;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 4 | 0) >> 2];
+   s2 = l0;
+   s2 = HEAP32[s2 >> 2];
+   s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+   l5 = s0;
+   label$2 : {
+    label$3 : {
+     s0 = l0;
+     s0 = HEAP32[(s0 + 20 | 0) >> 2];
+     l6 = s0;
+     if (s0) { break label$3; }
+     s0 = l0;
+     s0 = HEAP32[(s0 + 8 | 0) >> 2];
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     l6 = s0;
+     break label$2;
+    }
+    s0 = l6;
+    s1 = 20;
+    s0 = s0 + s1 | 0;
+    l6 = s0;
+   }
+   s0 = l6;
+   s1 = l5;
+   HEAP32[s0 >> 2] = s1;
+   s0 = l0;
+   s1 = l5;
+   HEAP32[(s0 + 20 | 0) >> 2] = s1;
+   s0 = l5;
+   s1 = l4;
+   HEAP32[(s0 + 12 | 0) >> 2] = s1;
+   s0 = l5;
+   s1 = l3;
+   HEAP32[(s0 + 8 | 0) >> 2] = s1;
+   s0 = l5;
+   s1 = l2;
+   HEAP32[(s0 + 4 | 0) >> 2] = s1;
+   s0 = l5;
+   s1 = l1;
+   HEAP32[s0 >> 2] = s1;
+   s0 = l0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 76 | 0) >> 2];
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 76 | 0) >> 2] = s1;
+   s0 = l5;
+   s1 = l1;
+   s2 = l2;
+   s1 = $2(s1, s2) | 0;
+   HEAP8[s0 + 16 | 0] = s1;
+   s0 = 0;
+   l0 = s0;
+   label$4 : {
+    s0 = l3;
+    s0 = !s0 | 0;
+    if (s0) { break label$4; }
+    s0 = l3;
+    s1 = l4;
+    s0 = $2(s0, s1) | 0;
+    l0 = s0;
+   }
+   s0 = l5;
+   s1 = 0;
+   HEAP32[(s0 + 20 | 0) >> 2] = s1;
+   s0 = l5;
+   s1 = l0;
+   HEAP8[s0 + 17 | 0] = s1;
+  }
+ }
+ function $2(l0, l1) {
+  var l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0;
+  s0 = 0;
+  l2 = s0;
+  label$1 : {
+   s0 = l1;
+   s1 = l0;
+   s0 = s0 - s1 | 0;
+   s1 = 2;
+   s0 = (s0 | 0) < (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   label$2 : {
+    s0 = l0;
+    s0 = HEAPU8[s0];
+    l3 = s0;
+    s1 = 39;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$2; }
+    s0 = l3;
+    s1 = 34;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$1; }
+   }
+   s0 = l0;
+   s1 = 1;
+   s0 = s0 + s1 | 0;
+   s1 = l1;
+   s2 = -1;
+   s1 = s1 + s2 | 0;
+   s2 = 0;
+   s0 = $3(s0, s1, s2) | 0;
+   l2 = s0;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function $3(l0, l1, l2) {
+  var s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0;
+  s0 = l0;
+  s1 = l1;
+  s2 = 92;
+  s3 = 13;
+  s4 = 92;
+  s5 = l2;
+  s3 = s5 ? s3 : s4;
+  s4 = 92;
+  s5 = 92;
+  s6 = 92;
+  s0 = $42(s0, s1, s2, s3, s4, s5, s6) | 0;
+  s1 = l1;
+  s0 = (s0 | 0) != (s1 | 0) | 0;
+  return s0;
+ }
+ function $4(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     s0 = l0;
+     s0 = HEAP32[(s0 + 28 | 0) >> 2];
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 52 | 0) >> 2];
+     l1 = s1;
+     s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     s0 = l1;
+     s1 = 1;
+     s0 = s0 << s1;
+     l2 = s0;
+     s1 = 536870911;
+     s0 = s0 >>> 0 > s1 >>> 0 | 0;
+     if (s0) { break label$2; }
+     s0 = l1;
+     s1 = 4;
+     s0 = s0 << s1;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 4 | 0) >> 2];
+     s2 = l0;
+     s2 = HEAP32[s2 >> 2];
+     s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+     l1 = s0;
+     s0 = !s0 | 0;
+     if (s0) { break label$2; }
+     s0 = l1;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 48 | 0) >> 2];
+     s2 = l0;
+     s2 = HEAP32[(s2 + 52 | 0) >> 2];
+     s3 = 3;
+     s2 = s2 << s3;
+     s0 = $63(s0, s1, s2) | 0;
+     l1 = s0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 52 | 0) >> 2];
+     l3 = s1;
+     s2 = 3;
+     s1 = s1 << s2;
+     s0 = s0 + s1 | 0;
+     s1 = 0;
+     s2 = l2;
+     s3 = l3;
+     s2 = s2 - s3 | 0;
+     s3 = 3;
+     s2 = s2 << s3;
+     s0 = $65(s0, s1, s2) | 0;
+     s0 = l0;
+     s1 = l2;
+     HEAP32[(s0 + 52 | 0) >> 2] = s1;
+     s0 = l0;
+     s1 = l1;
+     HEAP32[(s0 + 48 | 0) >> 2] = s1;
+    }
+    s0 = 1;
+    l1 = s0;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 56 | 0) >> 2];
+    s1 = 4;
+    s0 = s0 + s1 | 0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 60 | 0) >> 2];
+    l2 = s1;
+    s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+    if (s0) { break label$1; }
+    s0 = l2;
+    s1 = 1;
+    s0 = s0 << s1;
+    l1 = s0;
+    s1 = 1073741823;
+    s0 = s0 >>> 0 > s1 >>> 0 | 0;
+    if (s0) { break label$2; }
+    s0 = l2;
+    s1 = 3;
+    s0 = s0 << s1;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 4 | 0) >> 2];
+    s2 = l0;
+    s2 = HEAP32[s2 >> 2];
+    s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+    l2 = s0;
+    s0 = !s0 | 0;
+    if (s0) { break label$2; }
+    s0 = l2;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 64 | 0) >> 2];
+    s2 = l0;
+    s2 = HEAP32[(s2 + 60 | 0) >> 2];
+    s3 = 2;
+    s2 = s2 << s3;
+    s0 = $63(s0, s1, s2) | 0;
+    l2 = s0;
+    s0 = l0;
+    s1 = l1;
+    HEAP32[(s0 + 60 | 0) >> 2] = s1;
+    s0 = l0;
+    s1 = l2;
+    HEAP32[(s0 + 64 | 0) >> 2] = s1;
+    s0 = 1;
+    return s0;
+   }
+   s0 = l0;
+   $5(s0);
+   s0 = 0;
+   l1 = s0;
+  }
+  s0 = l1;
+  return s0;
+ }
+ function $5(l0) {
+  var l1 = 0, s0 = 0, s1 = 0, s2 = 0;
+  s0 = l0;
+  s1 = 1;
+  HEAP8[s0 + 69 | 0] = s1;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l1 = s0;
+  s0 = l0;
+  s1 = l0;
+  s1 = HEAP32[(s1 + 44 | 0) >> 2];
+  s2 = 1;
+  s1 = s1 + s2 | 0;
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 8 | 0) >> 2];
+  s1 = l1;
+  s2 = l0;
+  s2 = HEAP32[(s2 + 36 | 0) >> 2];
+  s1 = s1 - s2 | 0;
+  HEAP32[(s0 + 8 | 0) >> 2] = s1;
+ }
+ function $6(l0, l1, l2, l3, l4, l5, l6, l7) {
+  var l8 = 0, l9 = 0, l10 = 0, l11 = 0, l12 = 0, s0 = 0, s1 = 0, s1h = 0, s2 = 0, s3 = 0, s4 = 0;
+  s0 = global$0;
+  s1 = 784;
+  s0 = s0 - s1 | 0;
+  l8 = s0;
+  global$0 = s0;
+  s0 = l8;
+  s1 = 272;
+  s0 = s0 + s1 | 0;
+  s1 = 0;
+  s2 = 512;
+  s0 = $65(s0, s1, s2) | 0;
+  s0 = l8;
+  s1 = 0;
+  HEAP32[(s0 + 36 | 0) >> 2] = s1;
+  s0 = 1;
+  l9 = s0;
+  s0 = l8;
+  s1 = 1;
+  HEAP16[(s0 + 32 | 0) >> 1] = s1;
+  s0 = l8;
+  s1 = 0;
+  HEAP32[(s0 + 28 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = 0; s1h = 0;
+  store32(s0 + 20 | 0, s1); store32(s0 + 24 | 0, s1h);
+  s0 = l8;
+  s1 = l4;
+  HEAP32[(s0 + 16 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = l3;
+  HEAP32[(s0 + 12 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = l2;
+  HEAP32[(s0 + 8 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = l6;
+  HEAP32[(s0 + 92 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = 0;
+  HEAP32[(s0 + 88 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = 0; s1h = 0;
+  HEAP32[(s0 + 80 | 0) >> 2] = s1; HEAP32[(s0 + 84 | 0) >> 2] = s1h;
+  s0 = l8;
+  s1 = 0;
+  HEAP8[s0 + 78 | 0] = s1;
+  s0 = l8;
+  s1 = 0;
+  HEAP16[(s0 + 76 | 0) >> 1] = s1;
+  s0 = l8;
+  s1 = 32;
+  HEAP32[(s0 + 68 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = 64; s1h = 0;
+  store32(s0 + 60 | 0, s1); store32(s0 + 64 | 0, s1h);
+  s0 = l8;
+  s1 = l0;
+  HEAP32[(s0 + 44 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = 0;
+  s1 = HEAP32[(s1 + 8956 | 0) >> 2];
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = l8;
+  s2 = 144;
+  s1 = s1 + s2 | 0;
+  HEAP32[(s0 + 72 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = l8;
+  s2 = 272;
+  s1 = s1 + s2 | 0;
+  HEAP32[(s0 + 56 | 0) >> 2] = s1;
+  label$1 : {
+   label$2 : {
+    s0 = l5;
+    if (s0) { break label$2; }
+    s0 = l8;
+    s1 = 0;
+    HEAP32[(s0 + 96 | 0) >> 2] = s1;
+    s0 = -1;
+    l5 = s0;
+    break label$1;
+   }
+   s0 = l8;
+   s1 = l5;
+   s1 = HEAP32[s1 >> 2];
+   l9 = s1;
+   HEAP32[(s0 + 96 | 0) >> 2] = s1;
+   s0 = l5;
+   s0 = HEAP32[(s0 + 4 | 0) >> 2];
+   l5 = s0;
+   s1 = -1;
+   s2 = l5;
+   s0 = s2 ? s0 : s1;
+   l5 = s0;
+   s0 = l9;
+   s1 = 8;
+   s0 = s0 & s1;
+   s0 = !s0 | 0;
+   l9 = s0;
+  }
+  s0 = l8;
+  s1 = l5;
+  HEAP32[(s0 + 100 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = 104;
+  s0 = s0 + s1 | 0;
+  s1 = 0;
+  s2 = 36;
+  s0 = $65(s0, s1, s2) | 0;
+  s0 = l4;
+  s1 = 0; s1h = 0;
+  store32(s0 + 16 | 0, s1); store32(s0 + 20 | 0, s1h);
+  s0 = l8;
+  s1 = l0;
+  s2 = -1;
+  s1 = s1 + s2 | 0;
+  l5 = s1;
+  HEAP32[(s0 + 48 | 0) >> 2] = s1;
+  s0 = l8;
+  s1 = l5;
+  s2 = l1;
+  s1 = s1 + s2 | 0;
+  HEAP32[(s0 + 52 | 0) >> 2] = s1;
+  label$3 : {
+   label$4 : {
+    s0 = l9;
+    if (s0) { break label$4; }
+    label$5 : {
+     label$6 : {
+      s0 = 1024;
+      s1 = l3;
+      s2 = l2;
+      s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+      l10 = s0;
+      s0 = !s0 | 0;
+      if (s0) { break label$6; }
+      s0 = l0;
+      s1 = l1;
+      s0 = s0 + s1 | 0;
+      l1 = s0;
+      s0 = 0;
+      l5 = s0;
+      s0 = l10;
+      s1 = 0;
+      HEAP32[s0 >> 2] = s1;
+      s0 = 256;
+      l3 = s0;
+      s0 = 1;
+      l9 = s0;
+      label$7 : while (1) {
+       s0 = l0;
+       s1 = l5;
+       s0 = s0 + s1 | 0;
+       l2 = s0;
+       s1 = l1;
+       s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+       if (s0) { break label$5; }
+       label$8 : {
+        s0 = l2;
+        s0 = HEAPU8[s0];
+        s1 = 10;
+        s0 = (s0 | 0) != (s1 | 0) | 0;
+        if (s0) { break label$8; }
+        label$9 : {
+         s0 = l9;
+         s1 = l3;
+         s0 = (s0 | 0) != (s1 | 0) | 0;
+         if (s0) { break label$9; }
+         s0 = l3;
+         s1 = 1;
+         s0 = s0 << s1;
+         l2 = s0;
+         s1 = 1073741823;
+         s0 = s0 >>> 0 > s1 >>> 0 | 0;
+         if (s0) { break label$6; }
+         s0 = l3;
+         s1 = 3;
+         s0 = s0 << s1;
+         s1 = l8;
+         s1 = HEAP32[(s1 + 12 | 0) >> 2];
+         s2 = l8;
+         s2 = HEAP32[(s2 + 8 | 0) >> 2];
+         s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+         l11 = s0;
+         s0 = !s0 | 0;
+         if (s0) { break label$6; }
+         s0 = l3;
+         s1 = 2;
+         s0 = s0 << s1;
+         l12 = s0;
+         s0 = l2;
+         l3 = s0;
+         s0 = l11;
+         s1 = l10;
+         s2 = l12;
+         s0 = $63(s0, s1, s2) | 0;
+         l10 = s0;
+        }
+        s0 = l10;
+        s1 = l9;
+        s2 = 2;
+        s1 = s1 << s2;
+        s0 = s0 + s1 | 0;
+        s1 = l5;
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        HEAP32[s0 >> 2] = s1;
+        s0 = l9;
+        s1 = 1;
+        s0 = s0 + s1 | 0;
+        l9 = s0;
+       }
+       s0 = l5;
+       s1 = 1;
+       s0 = s0 + s1 | 0;
+       l5 = s0;
+       continue label$7;
+      }
+     }
+     s0 = 0;
+     l5 = s0;
+     s0 = l8;
+     s0 = HEAP32[(s0 + 16 | 0) >> 2];
+     s1 = 0;
+     HEAP32[(s0 + 8 | 0) >> 2] = s1;
+     s0 = l8;
+     s1 = 1;
+     HEAP8[s0 + 77 | 0] = s1;
+     break label$3;
+    }
+    s0 = l8;
+    s0 = HEAP32[(s0 + 16 | 0) >> 2];
+    l5 = s0;
+    s1 = l9;
+    HEAP32[(s0 + 20 | 0) >> 2] = s1;
+    s0 = l5;
+    s1 = l10;
+    HEAP32[(s0 + 16 | 0) >> 2] = s1;
+   }
+   label$10 : {
+    s0 = l7;
+    s0 = !s0 | 0;
+    if (s0) { break label$10; }
+    s0 = l8;
+    s1 = l7;
+    s1 = HEAP32[(s1 + 20 | 0) >> 2];
+    l5 = s1;
+    HEAP32[(s0 + 36 | 0) >> 2] = s1;
+    s0 = l8;
+    s1 = l8;
+    s1 = HEAP32[(s1 + 48 | 0) >> 2];
+    s2 = l7;
+    s2 = HEAP32[s2 >> 2];
+    l10 = s2;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 48 | 0) >> 2] = s1;
+    s0 = l8;
+    s1 = 0;
+    s1 = HEAP32[(s1 + 8956 | 0) >> 2];
+    s2 = l0;
+    s3 = l7;
+    s3 = HEAP32[(s3 + 8 | 0) >> 2];
+    l9 = s3;
+    s2 = s2 + s3 | 0;
+    s3 = l9;
+    s4 = -1;
+    s3 = (s3 | 0) == (s4 | 0) | 0;
+    s1 = s3 ? s1 : s2;
+    HEAP32[(s0 + 40 | 0) >> 2] = s1;
+    s0 = l5;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l2 = s0;
+    s0 = l6;
+    s0 = HEAP32[(s0 + 40 | 0) >> 2];
+    s1 = l7;
+    s1 = HEAP32[(s1 + 24 | 0) >> 2];
+    s2 = 3;
+    s1 = s1 << s2;
+    s0 = s0 + s1 | 0;
+    l5 = s0;
+    s0 = l8;
+    s1 = 272;
+    s0 = s0 + s1 | 0;
+    l9 = s0;
+    label$11 : while (1) {
+     label$12 : {
+      s0 = l2;
+      if (s0) { break label$12; }
+      s0 = l6;
+      s1 = l10;
+      s2 = 1024;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 24 | 0) >> 2] = s1;
+      s0 = l8;
+      s1 = l7;
+      s1h = load32(s1 + 16 | 0); s1 = load32(s1 + 12 | 0);
+      HEAP32[(s0 + 80 | 0) >> 2] = s1; HEAP32[(s0 + 84 | 0) >> 2] = s1h;
+      s0 = l8;
+      s1 = l7;
+      s1 = HEAPU16[(s1 + 28 | 0) >> 1];
+      HEAP16[(s0 + 32 | 0) >> 1] = s1;
+      s0 = l8;
+      s1 = l7;
+      s1 = HEAPU8[s1 + 30 | 0];
+      HEAP8[s0 + 76 | 0] = s1;
+      break label$10;
+     }
+     s0 = l9;
+     s1 = l5;
+     s2 = 4;
+     s1 = s1 + s2 | 0;
+     s1 = HEAP32[s1 >> 2];
+     HEAP32[s0 >> 2] = s1;
+     s0 = l9;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     s1 = 0;
+     s2 = l0;
+     s3 = l5;
+     s3 = HEAP32[s3 >> 2];
+     l3 = s3;
+     s2 = s2 + s3 | 0;
+     s3 = l3;
+     s4 = -1;
+     s3 = (s3 | 0) == (s4 | 0) | 0;
+     s1 = s3 ? s1 : s2;
+     HEAP32[s0 >> 2] = s1;
+     s0 = l2;
+     s1 = -1;
+     s0 = s0 + s1 | 0;
+     l2 = s0;
+     s0 = l5;
+     s1 = 8;
+     s0 = s0 + s1 | 0;
+     l5 = s0;
+     s0 = l9;
+     s1 = 8;
+     s0 = s0 + s1 | 0;
+     l9 = s0;
+     continue label$11;
+    }
+   }
+   s0 = l8;
+   s1 = 8;
+   s0 = s0 + s1 | 0;
+   s1 = 0;
+   s0 = $7(s0, s1) | 0;
+   l5 = s0;
+   s0 = l4;
+   s1 = l8;
+   s1 = HEAPU8[s1 + 32 | 0];
+   HEAP8[s0 + 12 | 0] = s1;
+  }
+  s0 = l8;
+  s1 = 784;
+  s0 = s0 + s1 | 0;
+  global$0 = s0;
+  s0 = l5;
+  return s0;
+ }
+ function $7(l0, l1) {
+  var l2 = 0, l3 = 0, l4 = 0, l5 = 0, l6 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       s0 = l0;
+       s0 = HEAPU8[s0 + 24 | 0];
+       s0 = !s0 | 0;
+       if (s0) { break label$5; }
+       label$6 : while (1) {
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        l2 = s1;
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        HEAP32[(s0 + 40 | 0) >> 2] = s1;
+        label$7 : {
+         label$8 : {
+          label$9 : {
+           s0 = l2;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 44 | 0) >> 2];
+           s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+           if (s0) { break label$9; }
+           label$10 : {
+            s0 = l0;
+            s0 = $9(s0) | 0;
+            if (s0) { break label$10; }
+            s0 = 0;
+            return s0;
+           }
+           label$11 : {
+            s0 = l1;
+            s0 = !s0 | 0;
+            if (s0) { break label$11; }
+            s0 = l0;
+            s1 = l1;
+            s0 = $10(s0, s1) | 0;
+            s0 = !s0 | 0;
+            if (s0) { break label$2; }
+           }
+           label$12 : {
+            s0 = l0;
+            s0 = HEAP32[(s0 + 84 | 0) >> 2];
+            s0 = !s0 | 0;
+            if (s0) { break label$12; }
+            s0 = l0;
+            s0 = $11(s0) | 0;
+            s0 = !s0 | 0;
+            if (s0) { break label$1; }
+           }
+           s0 = l0;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 40 | 0) >> 2];
+           s2 = l0;
+           s2 = HEAP32[(s2 + 44 | 0) >> 2];
+           l3 = s2;
+           s3 = 1;
+           s1 = $12(s1, s2, s3) | 0;
+           l2 = s1;
+           HEAP32[(s0 + 40 | 0) >> 2] = s1;
+           s0 = l2;
+           s0 = HEAPU8[s0];
+           l4 = s0;
+           s1 = -9;
+           s0 = s0 + s1 | 0;
+           s1 = 5;
+           s0 = s0 >>> 0 < s1 >>> 0 | 0;
+           if (s0) { continue label$6; }
+           label$13 : {
+            label$14 : {
+             label$15 : {
+              label$16 : {
+               s0 = l4;
+               s1 = -101;
+               s0 = s0 + s1 | 0;
+               switch (s0) {
+                case 0:
+                 break label$15;
+                case 1: case 2: case 3:
+                 break label$8;
+                case 4:
+                 break label$14;
+                default:
+                 break label$16;
+               }
+              }
+              s0 = l4;
+              s1 = 32;
+              s0 = (s0 | 0) == (s1 | 0) | 0;
+              if (s0) { continue label$6; }
+              s0 = l4;
+              s1 = 47;
+              s0 = (s0 | 0) == (s1 | 0) | 0;
+              if (s0) { break label$13; }
+              s0 = l4;
+              s1 = 59;
+              s0 = (s0 | 0) == (s1 | 0) | 0;
+              if (s0) { break label$7; }
+              s0 = l4;
+              s1 = 114;
+              s0 = (s0 | 0) != (s1 | 0) | 0;
+              if (s0) { break label$8; }
+              s0 = l0;
+              $13(s0);
+              break label$7;
+             }
+             s0 = l0;
+             s0 = HEAP32[(s0 + 28 | 0) >> 2];
+             if (s0) { break label$7; }
+             s0 = l0;
+             s0 = $14(s0) | 0;
+             s0 = !s0 | 0;
+             if (s0) { break label$7; }
+             s0 = l0;
+             s1 = l2;
+             s2 = 1;
+             s1 = s1 + s2 | 0;
+             s2 = 1919905912; s2h = 116;
+             s3 = 5;
+             s0 = $15(s0, s1, s2, s2h, s3) | 0;
+             s0 = !s0 | 0;
+             if (s0) { break label$7; }
+             s0 = l0;
+             $16(s0);
+             s0 = 1;
+             l4 = s0;
+             s0 = l0;
+             s0 = HEAP32[(s0 + 96 | 0) >> 2];
+             s1 = l0;
+             s1 = HEAP32[(s1 + 92 | 0) >> 2];
+             s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+             if (s0) { break label$4; }
+             s0 = l0;
+             s0 = HEAPU8[s0 + 24 | 0];
+             if (s0) { break label$7; }
+             s0 = l0;
+             s0 = HEAPU8[s0 + 88 | 0];
+             s1 = 4;
+             s0 = s0 & s1;
+             if (s0) { break label$4; }
+             s0 = l0;
+             s1 = l0;
+             s1 = HEAP32[(s1 + 40 | 0) >> 2];
+             HEAP32[(s0 + 32 | 0) >> 2] = s1;
+             break label$5;
+            }
+            s0 = l0;
+            s0 = $14(s0) | 0;
+            s0 = !s0 | 0;
+            if (s0) { break label$7; }
+            s0 = l0;
+            s1 = l2;
+            s2 = 1;
+            s1 = s1 + s2 | 0;
+            s2 = 1919905901; s2h = 116;
+            s3 = 5;
+            s0 = $15(s0, s1, s2, s2h, s3) | 0;
+            s0 = !s0 | 0;
+            if (s0) { break label$7; }
+            s0 = l0;
+            $17(s0);
+            s0 = l0;
+            s0 = HEAP32[(s0 + 96 | 0) >> 2];
+            s1 = l0;
+            s1 = HEAP32[(s1 + 92 | 0) >> 2];
+            s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+            if (s0) { break label$1; }
+            break label$7;
+           }
+           label$17 : {
+            s0 = l3;
+            s1 = l2;
+            s2 = 1;
+            s1 = s1 + s2 | 0;
+            l4 = s1;
+            s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+            if (s0) { break label$17; }
+            s0 = l0;
+            s1 = 1;
+            HEAP8[s0 + 70 | 0] = s1;
+            break label$8;
+           }
+           label$18 : {
+            s0 = l4;
+            s0 = HEAPU8[s0];
+            l4 = s0;
+            s1 = 42;
+            s0 = (s0 | 0) == (s1 | 0) | 0;
+            if (s0) { break label$18; }
+            s0 = l4;
+            s1 = 47;
+            s0 = (s0 | 0) != (s1 | 0) | 0;
+            if (s0) { break label$8; }
+            s0 = l0;
+            $18(s0);
+            continue label$6;
+           }
+           s0 = l0;
+           s1 = 1;
+           $19(s0, s1);
+           continue label$6;
+          }
+          s0 = l1;
+          if (s0) { break label$2; }
+          s0 = 0;
+          l4 = s0;
+          s0 = l0;
+          s0 = HEAPU8[s0 + 69 | 0];
+          if (s0) { break label$4; }
+          break label$5;
+         }
+         s0 = l0;
+         s1 = 0;
+         HEAP8[s0 + 24 | 0] = s1;
+         s0 = 1;
+         l4 = s0;
+         s0 = l0;
+         s0 = HEAPU8[s0 + 88 | 0];
+         s1 = 4;
+         s0 = s0 & s1;
+         if (s0) { break label$4; }
+         s0 = l0;
+         s1 = l2;
+         s2 = -1;
+         s1 = s1 + s2 | 0;
+         HEAP32[(s0 + 40 | 0) >> 2] = s1;
+         break label$5;
+        }
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        HEAP32[(s0 + 32 | 0) >> 2] = s1;
+        continue label$6;
+       }
+      }
+      label$19 : while (1) {
+       s0 = l0;
+       s1 = l0;
+       s1 = HEAP32[(s1 + 40 | 0) >> 2];
+       l2 = s1;
+       s2 = 1;
+       s1 = s1 + s2 | 0;
+       HEAP32[(s0 + 40 | 0) >> 2] = s1;
+       label$20 : {
+        label$21 : {
+         s0 = l2;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 44 | 0) >> 2];
+         s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+         if (s0) { break label$21; }
+         s0 = 0;
+         l4 = s0;
+         s0 = l0;
+         s0 = $9(s0) | 0;
+         s0 = !s0 | 0;
+         if (s0) { break label$4; }
+         label$22 : {
+          s0 = l1;
+          s0 = !s0 | 0;
+          if (s0) { break label$22; }
+          s0 = l0;
+          s1 = l1;
+          s0 = $10(s0, s1) | 0;
+          s0 = !s0 | 0;
+          if (s0) { break label$2; }
+         }
+         label$23 : {
+          s0 = l0;
+          s0 = HEAP32[(s0 + 84 | 0) >> 2];
+          s0 = !s0 | 0;
+          if (s0) { break label$23; }
+          s0 = l0;
+          s0 = $11(s0) | 0;
+          s0 = !s0 | 0;
+          if (s0) { break label$1; }
+         }
+         s0 = l0;
+         s0 = HEAP32[(s0 + 44 | 0) >> 2];
+         l5 = s0;
+         s0 = l0;
+         s0 = HEAP32[(s0 + 40 | 0) >> 2];
+         l2 = s0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 36 | 0) >> 2];
+         l6 = s1;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$20; }
+         s0 = l0;
+         s0 = HEAP32[(s0 + 32 | 0) >> 2];
+         l3 = s0;
+         label$24 : while (1) {
+          label$25 : {
+           label$26 : {
+            label$27 : {
+             s0 = l2;
+             s1 = l5;
+             s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+             if (s0) { break label$27; }
+             label$28 : {
+              label$29 : {
+               label$30 : {
+                s0 = l2;
+                s0 = HEAPU8[s0];
+                l4 = s0;
+                s1 = -96;
+                s0 = s0 + s1 | 0;
+                switch (s0) {
+                 case 0:
+                  break label$27;
+                 case 1: case 2: case 4: case 6: case 7: case 8:
+                  break label$26;
+                 case 3: case 5: case 9:
+                  break label$29;
+                 default:
+                  break label$30;
+                }
+               }
+               label$31 : {
+                s0 = l4;
+                s1 = -32;
+                s0 = s0 + s1 | 0;
+                switch (s0) {
+                 case 0:
+                  break label$25;
+                 case 1: case 3: case 4: case 5: case 6:
+                  break label$26;
+                 case 2: case 7: case 8: case 9:
+                  break label$27;
+                 default:
+                  break label$31;
+                }
+               }
+               s0 = l4;
+               s1 = 114;
+               s0 = (s0 | 0) == (s1 | 0) | 0;
+               if (s0) { break label$29; }
+               s0 = l4;
+               s1 = -123;
+               s0 = s0 + s1 | 0;
+               switch (s0) {
+                case 0: case 2:
+                 break label$27;
+                case 1:
+                 break label$26;
+                default:
+                 break label$28;
+               }
+              }
+              s0 = l6;
+              s1 = l2;
+              s0 = $20(s0, s1) | 0;
+              if (s0) { break label$27; }
+              break label$26;
+             }
+             s0 = l4;
+             s1 = 47;
+             s0 = (s0 | 0) != (s1 | 0) | 0;
+             if (s0) { break label$26; }
+            }
+            s0 = l0;
+            s1 = l3;
+            HEAP32[(s0 + 32 | 0) >> 2] = s1;
+            break label$20;
+           }
+           s0 = l3;
+           s1 = l2;
+           s2 = l4;
+           s3 = -9;
+           s2 = s2 + s3 | 0;
+           s3 = 255;
+           s2 = s2 & s3;
+           s3 = 5;
+           s2 = s2 >>> 0 < s3 >>> 0 | 0;
+           s0 = s2 ? s0 : s1;
+           l3 = s0;
+          }
+          s0 = l2;
+          s1 = 1;
+          s0 = s0 + s1 | 0;
+          l2 = s0;
+          continue label$24;
+         }
+        }
+        s0 = l1;
+        if (s0) { break label$2; }
+        s0 = 0;
+        l4 = s0;
+        s0 = l0;
+        s0 = HEAP32[(s0 + 28 | 0) >> 2];
+        if (s0) { break label$4; }
+        s0 = l0;
+        s0 = HEAPU8[s0 + 69 | 0];
+        if (s0) { break label$4; }
+        s0 = l0;
+        s0 = HEAP32[(s0 + 56 | 0) >> 2];
+        s0 = !s0 | 0;
+        l4 = s0;
+        break label$4;
+       }
+       s0 = l0;
+       s1 = l2;
+       HEAP32[(s0 + 40 | 0) >> 2] = s1;
+       s0 = l2;
+       s0 = HEAPU8[s0];
+       l4 = s0;
+       s1 = -9;
+       s0 = s0 + s1 | 0;
+       s1 = 5;
+       s0 = s0 >>> 0 < s1 >>> 0 | 0;
+       if (s0) { continue label$19; }
+       label$32 : {
+        label$33 : {
+         label$34 : {
+          label$35 : {
+           label$36 : {
+            label$37 : {
+             label$38 : {
+              label$39 : {
+               label$40 : {
+                label$41 : {
+                 label$42 : {
+                  label$43 : {
+                   s0 = l4;
+                   s1 = -32;
+                   s0 = s0 + s1 | 0;
+                   switch (s0) {
+                    case 0:
+                     continue label$19;
+                    case 1: case 3: case 4: case 5: case 6:
+                     break label$32;
+                    case 2:
+                     break label$37;
+                    case 7:
+                     break label$38;
+                    case 8:
+                     break label$42;
+                    case 9:
+                     break label$41;
+                    default:
+                     break label$43;
+                   }
+                  }
+                  label$44 : {
+                   label$45 : {
+                    label$46 : {
+                     label$47 : {
+                      s0 = l4;
+                      s1 = -96;
+                      s0 = s0 + s1 | 0;
+                      switch (s0) {
+                       case 0:
+                        break label$35;
+                       case 1: case 2: case 4: case 6: case 7: case 8:
+                        break label$32;
+                       case 3:
+                        break label$44;
+                       case 5:
+                        break label$46;
+                       case 9:
+                        break label$45;
+                       default:
+                        break label$47;
+                      }
+                     }
+                     label$48 : {
+                      s0 = l4;
+                      s1 = -123;
+                      s0 = s0 + s1 | 0;
+                      switch (s0) {
+                       case 0:
+                        break label$40;
+                       case 1:
+                        break label$32;
+                       case 2:
+                        break label$39;
+                       default:
+                        break label$48;
+                      }
+                     }
+                     s0 = l4;
+                     s1 = 47;
+                     s0 = (s0 | 0) == (s1 | 0) | 0;
+                     if (s0) { break label$36; }
+                     s0 = l4;
+                     s1 = 114;
+                     s0 = (s0 | 0) != (s1 | 0) | 0;
+                     if (s0) { break label$32; }
+                     s0 = l0;
+                     $13(s0);
+                     break label$32;
+                    }
+                    s0 = l0;
+                    s0 = HEAP32[(s0 + 28 | 0) >> 2];
+                    if (s0) { break label$32; }
+                    s0 = l0;
+                    s0 = $14(s0) | 0;
+                    s0 = !s0 | 0;
+                    if (s0) { break label$32; }
+                    s0 = l0;
+                    s1 = l2;
+                    s2 = 1;
+                    s1 = s1 + s2 | 0;
+                    s2 = 1919905912; s2h = 116;
+                    s3 = 5;
+                    s0 = $15(s0, s1, s2, s2h, s3) | 0;
+                    s0 = !s0 | 0;
+                    if (s0) { break label$32; }
+                    s0 = l0;
+                    $16(s0);
+                    s0 = l0;
+                    s0 = HEAP32[(s0 + 96 | 0) >> 2];
+                    s1 = l0;
+                    s1 = HEAP32[(s1 + 92 | 0) >> 2];
+                    s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                    if (s0) { break label$1; }
+                    break label$32;
+                   }
+                   s0 = l0;
+                   s0 = $14(s0) | 0;
+                   s0 = !s0 | 0;
+                   if (s0) { break label$32; }
+                   s0 = l0;
+                   s1 = l2;
+                   s2 = 1;
+                   s1 = s1 + s2 | 0;
+                   s2 = 1919905901; s2h = 116;
+                   s3 = 5;
+                   s0 = $15(s0, s1, s2, s2h, s3) | 0;
+                   s0 = !s0 | 0;
+                   if (s0) { break label$32; }
+                   s0 = l0;
+                   $17(s0);
+                   s0 = l0;
+                   s0 = HEAP32[(s0 + 96 | 0) >> 2];
+                   s1 = l0;
+                   s1 = HEAP32[(s1 + 92 | 0) >> 2];
+                   s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                   if (s0) { break label$1; }
+                   break label$32;
+                  }
+                  s0 = l0;
+                  s0 = $14(s0) | 0;
+                  s0 = !s0 | 0;
+                  if (s0) { break label$32; }
+                  s0 = l0;
+                  s1 = l2;
+                  s2 = 1;
+                  s1 = s1 + s2 | 0;
+                  s2 = 1936941420; s2h = 0;
+                  s3 = 4;
+                  s0 = $15(s0, s1, s2, s2h, s3) | 0;
+                  s0 = !s0 | 0;
+                  if (s0) { break label$32; }
+                  label$49 : {
+                   s0 = l0;
+                   s0 = HEAP32[(s0 + 44 | 0) >> 2];
+                   s1 = l0;
+                   s1 = HEAP32[(s1 + 40 | 0) >> 2];
+                   s2 = 5;
+                   s1 = s1 + s2 | 0;
+                   l2 = s1;
+                   s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                   if (s0) { break label$49; }
+                   s0 = l0;
+                   s1 = 1;
+                   HEAP8[s0 + 70 | 0] = s1;
+                   break label$32;
+                  }
+                  s0 = l2;
+                  s0 = HEAPU8[s0];
+                  s1 = -9;
+                  s0 = s0 + s1 | 0;
+                  l2 = s0;
+                  s1 = 23;
+                  s0 = s0 >>> 0 > s1 >>> 0 | 0;
+                  if (s0) { break label$32; }
+                  s0 = 1;
+                  s1 = l2;
+                  s0 = s0 << s1;
+                  s1 = 8388639;
+                  s0 = s0 & s1;
+                  s0 = !s0 | 0;
+                  if (s0) { break label$32; }
+                  s0 = l0;
+                  s1 = 1;
+                  HEAP8[s0 + 68 | 0] = s1;
+                  break label$32;
+                 }
+                 s0 = l0;
+                 s1 = l0;
+                 s1 = HEAP32[(s1 + 28 | 0) >> 2];
+                 l2 = s1;
+                 s2 = 1;
+                 s1 = s1 + s2 | 0;
+                 HEAP32[(s0 + 28 | 0) >> 2] = s1;
+                 s0 = l0;
+                 s0 = HEAP32[(s0 + 48 | 0) >> 2];
+                 s1 = l2;
+                 s2 = 3;
+                 s1 = s1 << s2;
+                 s0 = s0 + s1 | 0;
+                 l2 = s0;
+                 s1 = 1;
+                 HEAP32[s0 >> 2] = s1;
+                 s0 = l2;
+                 s1 = l0;
+                 s1 = HEAP32[(s1 + 32 | 0) >> 2];
+                 HEAP32[(s0 + 4 | 0) >> 2] = s1;
+                 break label$32;
+                }
+                s0 = l0;
+                s0 = HEAP32[(s0 + 28 | 0) >> 2];
+                l4 = s0;
+                s0 = !s0 | 0;
+                if (s0) { break label$3; }
+                s0 = l0;
+                s1 = l4;
+                s2 = -1;
+                s1 = s1 + s2 | 0;
+                l4 = s1;
+                HEAP32[(s0 + 28 | 0) >> 2] = s1;
+                s0 = l0;
+                s0 = HEAP32[(s0 + 56 | 0) >> 2];
+                l3 = s0;
+                s0 = !s0 | 0;
+                if (s0) { break label$32; }
+                s0 = l0;
+                s0 = HEAP32[(s0 + 64 | 0) >> 2];
+                s1 = l3;
+                s2 = -1;
+                s1 = s1 + s2 | 0;
+                l5 = s1;
+                s2 = 2;
+                s1 = s1 << s2;
+                s0 = s0 + s1 | 0;
+                s0 = HEAP32[s0 >> 2];
+                l3 = s0;
+                s0 = HEAP32[(s0 + 20 | 0) >> 2];
+                s1 = l0;
+                s1 = HEAP32[(s1 + 48 | 0) >> 2];
+                s2 = l4;
+                s3 = 3;
+                s2 = s2 << s3;
+                s1 = s1 + s2 | 0;
+                s1 = HEAP32[(s1 + 4 | 0) >> 2];
+                s0 = (s0 | 0) != (s1 | 0) | 0;
+                if (s0) { break label$32; }
+                label$50 : {
+                 s0 = l3;
+                 s0 = HEAP32[(s0 + 4 | 0) >> 2];
+                 if (s0) { break label$50; }
+                 s0 = l3;
+                 s1 = l2;
+                 HEAP32[(s0 + 4 | 0) >> 2] = s1;
+                }
+                s0 = l0;
+                s1 = l5;
+                HEAP32[(s0 + 56 | 0) >> 2] = s1;
+                s0 = l3;
+                s1 = l2;
+                s2 = 1;
+                s1 = s1 + s2 | 0;
+                HEAP32[(s0 + 12 | 0) >> 2] = s1;
+                break label$32;
+               }
+               label$51 : {
+                s0 = l0;
+                s0 = HEAP32[(s0 + 32 | 0) >> 2];
+                l2 = s0;
+                s0 = HEAPU8[s0];
+                s1 = 41;
+                s0 = (s0 | 0) != (s1 | 0) | 0;
+                if (s0) { break label$51; }
+                s0 = l0;
+                s0 = HEAP32[(s0 + 12 | 0) >> 2];
+                l4 = s0;
+                s0 = !s0 | 0;
+                if (s0) { break label$51; }
+                s0 = l4;
+                s0 = HEAP32[(s0 + 4 | 0) >> 2];
+                s1 = l2;
+                s0 = (s0 | 0) != (s1 | 0) | 0;
+                if (s0) { break label$51; }
+                s0 = l0;
+                s1 = l0;
+                s1 = HEAP32[(s1 + 16 | 0) >> 2];
+                l4 = s1;
+                HEAP32[(s0 + 12 | 0) >> 2] = s1;
+                s0 = l0;
+                s1 = l0;
+                s1 = HEAP32[(s1 + 72 | 0) >> 2];
+                s2 = -1;
+                s1 = s1 + s2 | 0;
+                HEAP32[(s0 + 72 | 0) >> 2] = s1;
+                label$52 : {
+                 label$53 : {
+                  s0 = l4;
+                  s0 = !s0 | 0;
+                  if (s0) { break label$53; }
+                  s0 = l4;
+                  s1 = 28;
+                  s0 = s0 + s1 | 0;
+                  l4 = s0;
+                  break label$52;
+                 }
+                 s0 = l0;
+                 s0 = HEAP32[(s0 + 8 | 0) >> 2];
+                 l4 = s0;
+                }
+                s0 = l4;
+                s1 = 0;
+                HEAP32[s0 >> 2] = s1;
+               }
+               s0 = l0;
+               s0 = HEAPU8[s0 + 68 | 0];
+               l4 = s0;
+               s0 = l0;
+               s1 = 0;
+               HEAP8[s0 + 68 | 0] = s1;
+               s0 = l0;
+               s1 = l0;
+               s1 = HEAP32[(s1 + 28 | 0) >> 2];
+               l3 = s1;
+               s2 = 1;
+               s1 = s1 + s2 | 0;
+               HEAP32[(s0 + 28 | 0) >> 2] = s1;
+               s0 = l0;
+               s0 = HEAP32[(s0 + 48 | 0) >> 2];
+               s1 = l3;
+               s2 = 3;
+               s1 = s1 << s2;
+               s0 = s0 + s1 | 0;
+               l3 = s0;
+               s1 = 6;
+               s2 = 2;
+               s3 = l4;
+               s1 = s3 ? s1 : s2;
+               HEAP32[s0 >> 2] = s1;
+               s0 = l3;
+               s1 = l2;
+               HEAP32[(s0 + 4 | 0) >> 2] = s1;
+               break label$32;
+              }
+              s0 = l0;
+              s0 = HEAP32[(s0 + 28 | 0) >> 2];
+              l2 = s0;
+              s0 = !s0 | 0;
+              if (s0) { break label$3; }
+              s0 = l0;
+              s1 = l2;
+              s2 = -1;
+              s1 = s1 + s2 | 0;
+              l2 = s1;
+              HEAP32[(s0 + 28 | 0) >> 2] = s1;
+              s0 = l0;
+              s0 = HEAP32[(s0 + 48 | 0) >> 2];
+              s1 = l2;
+              s2 = 3;
+              s1 = s1 << s2;
+              s0 = s0 + s1 | 0;
+              s0 = HEAP32[s0 >> 2];
+              s1 = 4;
+              s0 = (s0 | 0) == (s1 | 0) | 0;
+              if (s0) { break label$34; }
+              break label$32;
+             }
+             s0 = l0;
+             s1 = 39;
+             $21(s0, s1);
+             break label$32;
+            }
+            s0 = l0;
+            s1 = 34;
+            $21(s0, s1);
+            break label$32;
+           }
+           label$54 : {
+            s0 = l5;
+            s1 = l2;
+            s2 = 1;
+            s1 = s1 + s2 | 0;
+            l2 = s1;
+            s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+            if (s0) { break label$54; }
+            s0 = l0;
+            s1 = 1;
+            HEAP8[s0 + 70 | 0] = s1;
+            break label$33;
+           }
+           label$55 : {
+            s0 = l2;
+            s0 = HEAPU8[s0];
+            l2 = s0;
+            s1 = 42;
+            s0 = (s0 | 0) == (s1 | 0) | 0;
+            if (s0) { break label$55; }
+            s0 = l2;
+            s1 = 47;
+            s0 = (s0 | 0) != (s1 | 0) | 0;
+            if (s0) { break label$33; }
+            s0 = l0;
+            $18(s0);
+            continue label$19;
+           }
+           s0 = l0;
+           s1 = 1;
+           $19(s0, s1);
+           continue label$19;
+          }
+          s0 = l0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 28 | 0) >> 2];
+          l2 = s1;
+          s2 = 1;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 28 | 0) >> 2] = s1;
+          s0 = l0;
+          s0 = HEAP32[(s0 + 48 | 0) >> 2];
+          s1 = l2;
+          s2 = 3;
+          s1 = s1 << s2;
+          s0 = s0 + s1 | 0;
+          l2 = s0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 32 | 0) >> 2];
+          HEAP32[(s0 + 4 | 0) >> 2] = s1;
+          s0 = l2;
+          s1 = 3;
+          HEAP32[s0 >> 2] = s1;
+         }
+         s0 = l0;
+         $22(s0);
+         break label$32;
+        }
+        label$56 : {
+         label$57 : {
+          label$58 : {
+           s0 = l0;
+           s0 = HEAP32[(s0 + 32 | 0) >> 2];
+           l4 = s0;
+           s0 = HEAPU8[s0];
+           l2 = s0;
+           s0 = $23(s0) | 0;
+           s0 = !s0 | 0;
+           if (s0) { break label$58; }
+           s0 = l4;
+           s1 = l6;
+           s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+           if (s0) { break label$56; }
+           label$59 : {
+            label$60 : {
+             label$61 : {
+              s0 = l2;
+              s1 = -43;
+              s0 = s0 + s1 | 0;
+              switch (s0) {
+               case 0:
+                break label$60;
+               case 2:
+                break label$59;
+               case 3:
+                break label$61;
+               default:
+                break label$56;
+              }
+             }
+             s0 = l4;
+             s1 = -1;
+             s0 = s0 + s1 | 0;
+             s0 = HEAPU8[s0];
+             s1 = -48;
+             s0 = s0 + s1 | 0;
+             s1 = 255;
+             s0 = s0 & s1;
+             s1 = 10;
+             s0 = s0 >>> 0 < s1 >>> 0 | 0;
+             if (s0) { break label$57; }
+             break label$56;
+            }
+            s0 = l4;
+            s1 = -1;
+            s0 = s0 + s1 | 0;
+            s0 = HEAPU8[s0];
+            s1 = 43;
+            s0 = (s0 | 0) == (s1 | 0) | 0;
+            if (s0) { break label$57; }
+            break label$56;
+           }
+           s0 = l4;
+           s1 = -1;
+           s0 = s0 + s1 | 0;
+           s0 = HEAPU8[s0];
+           s1 = 45;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$57; }
+           break label$56;
+          }
+          label$62 : {
+           s0 = l2;
+           s1 = 125;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$62; }
+           s0 = l2;
+           s1 = 41;
+           s0 = (s0 | 0) != (s1 | 0) | 0;
+           if (s0) { break label$57; }
+           s0 = l0;
+           s0 = HEAP32[(s0 + 48 | 0) >> 2];
+           s1 = l0;
+           s1 = HEAP32[(s1 + 28 | 0) >> 2];
+           s2 = 3;
+           s1 = s1 << s2;
+           s0 = s0 + s1 | 0;
+           s0 = HEAP32[(s0 + 4 | 0) >> 2];
+           l4 = s0;
+           s0 = !s0 | 0;
+           if (s0) { break label$57; }
+           s0 = l0;
+           s1 = l4;
+           s0 = $24(s0, s1) | 0;
+           s0 = !s0 | 0;
+           if (s0) { break label$57; }
+           break label$56;
+          }
+          s0 = l0;
+          s0 = HEAP32[(s0 + 48 | 0) >> 2];
+          s1 = l0;
+          s1 = HEAP32[(s1 + 28 | 0) >> 2];
+          s2 = 3;
+          s1 = s1 << s2;
+          s0 = s0 + s1 | 0;
+          s0 = HEAP32[(s0 + 4 | 0) >> 2];
+          l4 = s0;
+          s0 = !s0 | 0;
+          if (s0) { break label$57; }
+          s0 = l0;
+          s1 = l4;
+          s0 = $25(s0, s1) | 0;
+          if (s0) { break label$56; }
+          s0 = l0;
+          s0 = HEAP32[(s0 + 48 | 0) >> 2];
+          s1 = l0;
+          s1 = HEAP32[(s1 + 28 | 0) >> 2];
+          s2 = 3;
+          s1 = s1 << s2;
+          s0 = s0 + s1 | 0;
+          s0 = HEAP32[s0 >> 2];
+          s1 = 6;
+          s0 = (s0 | 0) == (s1 | 0) | 0;
+          if (s0) { break label$56; }
+         }
+         s0 = l0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 32 | 0) >> 2];
+         s0 = $26(s0, s1) | 0;
+         if (s0) { break label$56; }
+         s0 = l2;
+         s0 = !s0 | 0;
+         if (s0) { break label$56; }
+         label$63 : {
+          s0 = l2;
+          s1 = 47;
+          s0 = (s0 | 0) != (s1 | 0) | 0;
+          if (s0) { break label$63; }
+          s0 = l0;
+          s0 = HEAPU8[s0 + 25 | 0];
+          if (s0) { break label$56; }
+         }
+         s0 = l0;
+         s0 = HEAP32[(s0 + 32 | 0) >> 2];
+         s1 = -1;
+         s0 = s0 + s1 | 0;
+         l2 = s0;
+         s0 = l0;
+         s0 = HEAP32[(s0 + 36 | 0) >> 2];
+         l3 = s0;
+         label$64 : {
+          label$65 : while (1) {
+           label$66 : {
+            s0 = l2;
+            s1 = 1;
+            s0 = s0 + s1 | 0;
+            l5 = s0;
+            s1 = l3;
+            s0 = s0 >>> 0 > s1 >>> 0 | 0;
+            if (s0) { break label$66; }
+            s0 = l5;
+            s0 = HEAPU8[s0];
+            l4 = s0;
+            break label$64;
+           }
+           s0 = l0;
+           s1 = l2;
+           HEAP32[(s0 + 32 | 0) >> 2] = s1;
+           s0 = l2;
+           s0 = HEAPU8[s0];
+           l4 = s0;
+           s0 = l2;
+           s1 = -1;
+           s0 = s0 + s1 | 0;
+           l5 = s0;
+           l2 = s0;
+           s0 = l4;
+           s0 = $27(s0) | 0;
+           s0 = !s0 | 0;
+           if (s0) { continue label$65; }
+           break label$65;
+          }
+          s0 = l5;
+          s1 = 1;
+          s0 = s0 + s1 | 0;
+          l5 = s0;
+         }
+         label$67 : {
+          s0 = l4;
+          s1 = 255;
+          s0 = s0 & s1;
+          s0 = $28(s0) | 0;
+          s0 = !s0 | 0;
+          if (s0) { break label$67; }
+          s0 = l5;
+          s1 = -1;
+          s0 = s0 + s1 | 0;
+          l2 = s0;
+          label$68 : {
+           label$69 : while (1) {
+            s0 = l2;
+            s1 = 1;
+            s0 = s0 + s1 | 0;
+            l4 = s0;
+            s1 = l3;
+            s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+            if (s0) { break label$68; }
+            s0 = l0;
+            s1 = l2;
+            HEAP32[(s0 + 32 | 0) >> 2] = s1;
+            s0 = l2;
+            s0 = HEAPU8[s0];
+            l4 = s0;
+            s0 = l2;
+            s1 = -1;
+            s0 = s0 + s1 | 0;
+            l5 = s0;
+            l2 = s0;
+            s0 = l4;
+            s0 = $28(s0) | 0;
+            if (s0) { continue label$69; }
+            break label$69;
+           }
+           s0 = l5;
+           s1 = 1;
+           s0 = s0 + s1 | 0;
+           l4 = s0;
+          }
+          s0 = l0;
+          s1 = l4;
+          s0 = $29(s0, s1) | 0;
+          if (s0) { break label$56; }
+         }
+         s0 = l0;
+         s1 = 1;
+         HEAP8[s0 + 25 | 0] = s1;
+         break label$32;
+        }
+        s0 = l0;
+        $30(s0);
+        s0 = l0;
+        s1 = 0;
+        HEAP8[s0 + 25 | 0] = s1;
+       }
+       s0 = l0;
+       s1 = l0;
+       s1 = HEAP32[(s1 + 40 | 0) >> 2];
+       HEAP32[(s0 + 32 | 0) >> 2] = s1;
+       continue label$19;
+      }
+     }
+     s0 = l4;
+     return s0;
+    }
+    s0 = l0;
+    $5(s0);
+    s0 = 0;
+    return s0;
+   }
+   s0 = l0;
+   s1 = l1;
+   $31(s0, s1);
+  }
+  s0 = 1;
+  return s0;
+ }
+ function $8(l0, l1, l2, l3, l4, l5) {
+  var s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+  s0 = l0;
+  s1 = l1;
+  s2 = l2;
+  s3 = l3;
+  s4 = l4;
+  s5 = l5;
+  s6 = 0;
+  s7 = 0;
+  s0 = $6(s0, s1, s2, s3, s4, s5, s6, s7) | 0;
+  return s0;
+ }
+ function $9(l0) {
+  var l1 = 0, s0 = 0, s1 = 0;
+  label$1 : {
+   label$2 : {
+    s0 = l0;
+    s0 = HEAP32[(s0 + 28 | 0) >> 2];
+    s1 = 4;
+    s0 = s0 + s1 | 0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 52 | 0) >> 2];
+    s0 = s0 >>> 0 > s1 >>> 0 | 0;
+    if (s0) { break label$2; }
+    s0 = 1;
+    l1 = s0;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 56 | 0) >> 2];
+    s1 = 4;
+    s0 = s0 + s1 | 0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 60 | 0) >> 2];
+    s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+    if (s0) { break label$1; }
+   }
+   s0 = l0;
+   s0 = $4(s0) | 0;
+   l1 = s0;
+  }
+  s0 = l1;
+  return s0;
+ }
+ function $10(l0, l1) {
+  var l2 = 0, s0 = 0, s1 = 0, s2 = 0;
+  s0 = 0;
+  l2 = s0;
+  label$1 : {
+   s0 = l0;
+   s0 = HEAPU8[s0 + 70 | 0];
+   if (s0) { break label$1; }
+   s0 = l0;
+   s0 = HEAPU8[s0 + 69 | 0];
+   if (s0) { break label$1; }
+   s0 = l1;
+   s1 = l0;
+   s2 = 132;
+   s0 = $63(s0, s1, s2) | 0;
+   l0 = s0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 40 | 0) >> 2];
+   s2 = -1;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   s0 = 1;
+   l2 = s0;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function $11(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, l4 = 0, l5 = 0, l6 = 0, l7 = 0, l8 = 0, l9 = 0, l10 = 0, l11 = 0, l11h = 0, l12 = 0, l13 = 0, l14 = 0, s0 = 0, s0h = 0, s1 = 0, s1h = 0, s2 = 0, s3 = 0, s4 = 0;
+  s0 = global$0;
+  s1 = 16;
+  s0 = s0 - s1 | 0;
+  l1 = s0;
+  global$0 = s0;
+  s0 = 1;
+  l2 = s0;
+  label$1 : {
+   s0 = l0;
+   s0 = HEAP32[(s0 + 28 | 0) >> 2];
+   s1 = 16;
+   s0 = s0 >>> 0 > s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s0 = HEAP32[(s0 + 56 | 0) >> 2];
+   if (s0) { break label$1; }
+   label$2 : {
+    s0 = l0;
+    s0 = HEAP32[(s0 + 12 | 0) >> 2];
+    l3 = s0;
+    s0 = !s0 | 0;
+    if (s0) { break label$2; }
+    s0 = l3;
+    s0 = HEAP32[(s0 + 4 | 0) >> 2];
+    s1 = l0;
+    s1 = HEAP32[(s1 + 32 | 0) >> 2];
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$1; }
+   }
+   s0 = l0;
+   s0 = HEAP32[(s0 + 40 | 0) >> 2];
+   s1 = l0;
+   s1 = HEAP32[(s1 + 36 | 0) >> 2];
+   s0 = s0 - s1 | 0;
+   l4 = s0;
+   label$3 : {
+    s0 = l0;
+    s0 = HEAP32[(s0 + 84 | 0) >> 2];
+    l3 = s0;
+    s0 = HEAP32[(s0 + 36 | 0) >> 2];
+    l5 = s0;
+    s1 = l3;
+    s1 = HEAP32[(s1 + 32 | 0) >> 2];
+    l6 = s1;
+    s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+    if (s0) { break label$3; }
+    s0 = l4;
+    s1 = l3;
+    s1 = HEAP32[(s1 + 52 | 0) >> 2];
+    s2 = 32;
+    s1 = s1 + s2 | 0;
+    s0 = s0 >>> 0 < s1 >>> 0 | 0;
+    if (s0) { break label$3; }
+    label$4 : while (1) {
+     s0 = l5;
+     s1 = l6;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     label$5 : {
+      label$6 : {
+       s0 = l3;
+       s1 = l3;
+       s1 = HEAP32[(s1 + 28 | 0) >> 2];
+       l6 = s1;
+       s2 = l5;
+       s3 = 5;
+       s2 = s2 << s3;
+       s1 = s1 + s2 | 0;
+       s1 = HEAP32[s1 >> 2];
+       s2 = l1;
+       s3 = 12;
+       s2 = s2 + s3 | 0;
+       s0 = $32(s0, s1, s2) | 0;
+       s0 = !s0 | 0;
+       if (s0) { break label$6; }
+       s0 = l1;
+       s0 = HEAP32[(s0 + 12 | 0) >> 2];
+       l7 = s0;
+       s1 = l4;
+       s0 = s0 >>> 0 < s1 >>> 0 | 0;
+       if (s0) { break label$6; }
+       s0 = l7;
+       s1 = l4;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$3; }
+       s0 = l6;
+       s1 = l5;
+       s2 = 5;
+       s1 = s1 << s2;
+       s0 = s0 + s1 | 0;
+       l7 = s0;
+       s0 = HEAPU8[s0 + 28 | 0];
+       s1 = l0;
+       s1 = HEAPU8[s1 + 24 | 0];
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$3; }
+       s0 = l7;
+       s0 = HEAPU8[s0 + 29 | 0];
+       s1 = l0;
+       s1 = HEAPU8[s1 + 25 | 0];
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$3; }
+       s0 = l6;
+       s1 = l5;
+       s2 = 5;
+       s1 = s1 << s2;
+       s0 = s0 + s1 | 0;
+       l7 = s0;
+       s0 = HEAPU8[s0 + 30 | 0];
+       s1 = l0;
+       s1 = HEAPU8[s1 + 68 | 0];
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$3; }
+       s0 = l7;
+       s0 = HEAP32[(s0 + 20 | 0) >> 2];
+       s1 = l0;
+       s1 = HEAP32[(s1 + 28 | 0) >> 2];
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$3; }
+       s0 = -1;
+       l7 = s0;
+       label$7 : {
+        s0 = l0;
+        s0 = HEAP32[(s0 + 32 | 0) >> 2];
+        l8 = s0;
+        s0 = !s0 | 0;
+        if (s0) { break label$7; }
+        s0 = 0;
+        s0 = HEAP32[(s0 + 8956 | 0) >> 2];
+        s1 = l8;
+        s0 = (s0 | 0) == (s1 | 0) | 0;
+        if (s0) { break label$7; }
+        s0 = l8;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 36 | 0) >> 2];
+        s0 = s0 - s1 | 0;
+        l7 = s0;
+       }
+       s0 = l0;
+       s1 = l7;
+       s2 = l6;
+       s3 = l5;
+       s4 = 5;
+       s3 = s3 << s4;
+       s2 = s2 + s3 | 0;
+       s2 = HEAP32[(s2 + 8 | 0) >> 2];
+       s0 = $33(s0, s1, s2) | 0;
+       s0 = !s0 | 0;
+       if (s0) { break label$3; }
+       s0 = -1;
+       l7 = s0;
+       s0 = l0;
+       s1 = l0;
+       s1 = HEAP32[(s1 + 36 | 0) >> 2];
+       s2 = -1;
+       s1 = s1 ^ s2;
+       s2 = l0;
+       s2 = HEAP32[(s2 + 40 | 0) >> 2];
+       s1 = s1 + s2 | 0;
+       s0 = $34(s0, s1) | 0;
+       s0 = !s0 | 0;
+       if (s0) { break label$3; }
+       s0 = l0;
+       s0 = HEAP32[(s0 + 84 | 0) >> 2];
+       s0 = HEAP32[(s0 + 40 | 0) >> 2];
+       s1 = l6;
+       s2 = l5;
+       s3 = 5;
+       s2 = s2 << s3;
+       s1 = s1 + s2 | 0;
+       s1 = HEAP32[(s1 + 24 | 0) >> 2];
+       s2 = 3;
+       s1 = s1 << s2;
+       s0 = s0 + s1 | 0;
+       l9 = s0;
+       s0 = 4;
+       l5 = s0;
+       label$8 : while (1) {
+        s0 = l7;
+        s1 = 1;
+        s0 = s0 + s1 | 0;
+        l7 = s0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 28 | 0) >> 2];
+        s0 = s0 >>> 0 > s1 >>> 0 | 0;
+        if (s0) { break label$5; }
+        s0 = l9;
+        s1 = l5;
+        s0 = s0 + s1 | 0;
+        l10 = s0;
+        s0 = HEAP32[s0 >> 2];
+        s1 = l0;
+        s1 = HEAP32[(s1 + 48 | 0) >> 2];
+        s2 = l5;
+        s1 = s1 + s2 | 0;
+        l8 = s1;
+        s2 = -4;
+        s1 = s1 + s2 | 0;
+        s1 = HEAP32[s1 >> 2];
+        s0 = (s0 | 0) != (s1 | 0) | 0;
+        if (s0) { break label$3; }
+        s0 = -1;
+        l6 = s0;
+        label$9 : {
+         s0 = l8;
+         s0 = HEAP32[s0 >> 2];
+         l8 = s0;
+         s0 = !s0 | 0;
+         if (s0) { break label$9; }
+         s0 = 0;
+         s0 = HEAP32[(s0 + 8956 | 0) >> 2];
+         s1 = l8;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$9; }
+         s0 = l8;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 36 | 0) >> 2];
+         s0 = s0 - s1 | 0;
+         l6 = s0;
+        }
+        s0 = l5;
+        s1 = 8;
+        s0 = s0 + s1 | 0;
+        l5 = s0;
+        s0 = l0;
+        s1 = l6;
+        s2 = l10;
+        s3 = -4;
+        s2 = s2 + s3 | 0;
+        s2 = HEAP32[s2 >> 2];
+        s0 = $33(s0, s1, s2) | 0;
+        if (s0) { continue label$8; }
+        break label$3;
+       }
+      }
+      s0 = l3;
+      s1 = l3;
+      s1 = HEAP32[(s1 + 36 | 0) >> 2];
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      l5 = s1;
+      HEAP32[(s0 + 36 | 0) >> 2] = s1;
+      s0 = l3;
+      s0 = HEAP32[(s0 + 32 | 0) >> 2];
+      l6 = s0;
+      continue label$4;
+     }
+     break label$4;
+    }
+    s0 = l3;
+    s1 = 1;
+    HEAP8[s0 + 56 | 0] = s1;
+    s0 = 0;
+    l2 = s0;
+    break label$1;
+   }
+   s0 = l4;
+   s1 = l3;
+   s1 = HEAP32[(s1 + 24 | 0) >> 2];
+   s0 = s0 >>> 0 < s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   label$10 : {
+    label$11 : {
+     s0 = l0;
+     s0 = HEAP32[(s0 + 84 | 0) >> 2];
+     l5 = s0;
+     s0 = HEAP32[(s0 + 4 | 0) >> 2];
+     l6 = s0;
+     s1 = l5;
+     s1 = HEAP32[(s1 + 8 | 0) >> 2];
+     s0 = (s0 | 0) != (s1 | 0) | 0;
+     if (s0) { break label$11; }
+     s0 = l6;
+     s1 = 1;
+     s0 = s0 << s1;
+     s1 = 64;
+     s2 = l6;
+     s0 = s2 ? s0 : s1;
+     l6 = s0;
+     s1 = 134217727;
+     s0 = s0 >>> 0 > s1 >>> 0 | 0;
+     if (s0) { break label$10; }
+     s0 = l6;
+     s1 = 5;
+     s0 = s0 << s1;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 4 | 0) >> 2];
+     s2 = l0;
+     s2 = HEAP32[s2 >> 2];
+     s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+     l7 = s0;
+     s0 = !s0 | 0;
+     if (s0) { break label$10; }
+     label$12 : {
+      s0 = l5;
+      s0 = HEAP32[(s0 + 4 | 0) >> 2];
+      l8 = s0;
+      s0 = !s0 | 0;
+      if (s0) { break label$12; }
+      s0 = l7;
+      s1 = l5;
+      s1 = HEAP32[s1 >> 2];
+      s2 = l8;
+      s3 = 5;
+      s2 = s2 << s3;
+      s0 = $63(s0, s1, s2) | 0;
+     }
+     s0 = l5;
+     s1 = l6;
+     HEAP32[(s0 + 8 | 0) >> 2] = s1;
+     s0 = l5;
+     s1 = l7;
+     HEAP32[s0 >> 2] = s1;
+    }
+    label$13 : {
+     s0 = l5;
+     s0 = HEAP32[(s0 + 16 | 0) >> 2];
+     s1 = 17;
+     s0 = s0 + s1 | 0;
+     s1 = l5;
+     s1 = HEAP32[(s1 + 20 | 0) >> 2];
+     l6 = s1;
+     s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+     if (s0) { break label$13; }
+     s0 = l6;
+     s1 = 1;
+     s0 = s0 << s1;
+     s1 = 256;
+     s2 = l6;
+     s0 = s2 ? s0 : s1;
+     l6 = s0;
+     s1 = 536870911;
+     s0 = s0 >>> 0 > s1 >>> 0 | 0;
+     if (s0) { break label$10; }
+     s0 = l6;
+     s1 = 3;
+     s0 = s0 << s1;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 4 | 0) >> 2];
+     s2 = l0;
+     s2 = HEAP32[s2 >> 2];
+     s0 = FUNCTION_TABLE[s2](s0, s1) | 0;
+     l7 = s0;
+     s0 = !s0 | 0;
+     if (s0) { break label$10; }
+     label$14 : {
+      s0 = l5;
+      s0 = HEAP32[(s0 + 16 | 0) >> 2];
+      l2 = s0;
+      s0 = !s0 | 0;
+      if (s0) { break label$14; }
+      s0 = l7;
+      s1 = l5;
+      s1 = HEAP32[(s1 + 12 | 0) >> 2];
+      s2 = l2;
+      s3 = 3;
+      s2 = s2 << s3;
+      s0 = $63(s0, s1, s2) | 0;
+     }
+     s0 = l5;
+     s1 = l6;
+     HEAP32[(s0 + 20 | 0) >> 2] = s1;
+     s0 = l5;
+     s1 = l7;
+     HEAP32[(s0 + 12 | 0) >> 2] = s1;
+    }
+    s0 = l3;
+    s1 = l3;
+    s1 = HEAP32[(s1 + 4 | 0) >> 2];
+    l2 = s1;
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 4 | 0) >> 2] = s1;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 40 | 0) >> 2];
+    l6 = s0;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 80 | 0) >> 2];
+    l7 = s0;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 36 | 0) >> 2];
+    l8 = s0;
+    s0 = 0;
+    s0 = HEAP32[(s0 + 8956 | 0) >> 2];
+    l10 = s0;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 32 | 0) >> 2];
+    l5 = s0;
+    s0 = l0;
+    s0h = load32(s0 + 76 | 0); s0 = load32(s0 + 72 | 0);
+    l11 = s0; l11h = s0h;
+    s0 = l0;
+    s0 = HEAPU16[(s0 + 24 | 0) >> 1];
+    l9 = s0;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 28 | 0) >> 2];
+    l12 = s0;
+    s0 = l3;
+    s0 = HEAP32[(s0 + 16 | 0) >> 2];
+    l13 = s0;
+    s0 = l0;
+    s0 = HEAPU8[s0 + 68 | 0];
+    l14 = s0;
+    s0 = l3;
+    s0 = HEAP32[s0 >> 2];
+    s1 = l2;
+    s2 = 5;
+    s1 = s1 << s2;
+    s0 = s0 + s1 | 0;
+    l2 = s0;
+    s1 = l4;
+    HEAP32[s0 >> 2] = s1;
+    s0 = l2;
+    s1 = l14;
+    HEAP8[s0 + 30 | 0] = s1;
+    s0 = l2;
+    s1 = l13;
+    HEAP32[(s0 + 24 | 0) >> 2] = s1;
+    s0 = l2;
+    s1 = l12;
+    HEAP32[(s0 + 20 | 0) >> 2] = s1;
+    s0 = l2;
+    s1 = l9;
+    HEAP16[(s0 + 28 | 0) >> 1] = s1;
+    s0 = l2;
+    s1 = l11; s1h = l11h;
+    store32(s0 + 12 | 0, s1); store32(s0 + 16 | 0, s1h);
+    s0 = l2;
+    s1 = -1;
+    s2 = l5;
+    s3 = l8;
+    s2 = s2 - s3 | 0;
+    s3 = l10;
+    s4 = l5;
+    s3 = (s3 | 0) == (s4 | 0) | 0;
+    s1 = s3 ? s1 : s2;
+    s2 = -1;
+    s3 = l5;
+    s1 = s3 ? s1 : s2;
+    HEAP32[(s0 + 8 | 0) >> 2] = s1;
+    s0 = l2;
+    s1 = l7;
+    s2 = l6;
+    s3 = l7;
+    s4 = l6;
+    s3 = s3 >>> 0 > s4 >>> 0 | 0;
+    s1 = s3 ? s1 : s2;
+    s2 = l8;
+    s1 = s1 - s2 | 0;
+    s2 = 32;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 4 | 0) >> 2] = s1;
+    s0 = 0;
+    l5 = s0;
+    s0 = 0;
+    l2 = s0;
+    label$15 : while (1) {
+     label$16 : {
+      s0 = l2;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 28 | 0) >> 2];
+      s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+      if (s0) { break label$16; }
+      s0 = l3;
+      s1 = l4;
+      s2 = 1024;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 24 | 0) >> 2] = s1;
+      s0 = 1;
+      l2 = s0;
+      break label$1;
+     }
+     s0 = l3;
+     s1 = l3;
+     s1 = HEAP32[(s1 + 16 | 0) >> 2];
+     l8 = s1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 16 | 0) >> 2] = s1;
+     s0 = l3;
+     s0 = HEAP32[(s0 + 12 | 0) >> 2];
+     l10 = s0;
+     s0 = -1;
+     l6 = s0;
+     label$17 : {
+      s0 = l0;
+      s0 = HEAP32[(s0 + 48 | 0) >> 2];
+      s1 = l5;
+      s0 = s0 + s1 | 0;
+      l9 = s0;
+      s1 = 4;
+      s0 = s0 + s1 | 0;
+      s0 = HEAP32[s0 >> 2];
+      l7 = s0;
+      s0 = !s0 | 0;
+      if (s0) { break label$17; }
+      s0 = 0;
+      s0 = HEAP32[(s0 + 8956 | 0) >> 2];
+      s1 = l7;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$17; }
+      s0 = l7;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 36 | 0) >> 2];
+      s0 = s0 - s1 | 0;
+      l6 = s0;
+     }
+     s0 = l10;
+     s1 = l8;
+     s2 = 3;
+     s1 = s1 << s2;
+     s0 = s0 + s1 | 0;
+     l7 = s0;
+     s1 = l9;
+     s1 = HEAP32[s1 >> 2];
+     HEAP32[(s0 + 4 | 0) >> 2] = s1;
+     s0 = l7;
+     s1 = l6;
+     HEAP32[s0 >> 2] = s1;
+     s0 = l5;
+     s1 = 8;
+     s0 = s0 + s1 | 0;
+     l5 = s0;
+     s0 = l2;
+     s1 = 1;
+     s0 = s0 + s1 | 0;
+     l2 = s0;
+     continue label$15;
+    }
+   }
+   s0 = l3;
+   s1 = -1;
+   HEAP32[(s0 + 24 | 0) >> 2] = s1;
+  }
+  s0 = l1;
+  s1 = 16;
+  s0 = s0 + s1 | 0;
+  global$0 = s0;
+  s0 = l2;
+  return s0;
+ }
+ function $12(l0, l1, l2) {
+  var l3 = 0, s0 = 0, s1 = 0;
+  label$1 : while (1) {
+   label$2 : {
+    s0 = l0;
+    s1 = l1;
+    s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+    if (s0) { break label$2; }
+    s0 = l0;
+    s0 = HEAPU8[s0];
+    l3 = s0;
+    label$3 : {
+     label$4 : {
+      s0 = l2;
+      s0 = !s0 | 0;
+      if (s0) { break label$4; }
+      s0 = l3;
+      s1 = -9;
+      s0 = s0 + s1 | 0;
+      l3 = s0;
+      s1 = 23;
+      s0 = s0 >>> 0 > s1 >>> 0 | 0;
+      if (s0) { break label$2; }
+      s0 = 1;
+      s1 = l3;
+      s0 = s0 << s1;
+      s1 = 8388639;
+      s0 = s0 & s1;
+      if (s0) { break label$3; }
+      break label$2;
+     }
+     s0 = l3;
+     s0 = $28(s0) | 0;
+     s0 = !s0 | 0;
+     if (s0) { break label$2; }
+    }
+    label$5 : while (1) {
+     s0 = l0;
+     s1 = l1;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$2; }
+     s0 = l0;
+     s0 = HEAPU8[s0];
+     l3 = s0;
+     label$6 : {
+      label$7 : {
+       s0 = l2;
+       s0 = !s0 | 0;
+       if (s0) { break label$7; }
+       s0 = l3;
+       s1 = -9;
+       s0 = s0 + s1 | 0;
+       l3 = s0;
+       s1 = 23;
+       s0 = s0 >>> 0 > s1 >>> 0 | 0;
+       if (s0) { break label$2; }
+       s0 = 1;
+       s1 = l3;
+       s0 = s0 << s1;
+       s1 = 8388639;
+       s0 = s0 & s1;
+       s0 = !s0 | 0;
+       if (s0) { break label$2; }
+       break label$6;
+      }
+      s0 = l3;
+      s0 = $28(s0) | 0;
+      s0 = !s0 | 0;
+      if (s0) { break label$2; }
+     }
+     s0 = l0;
+     s1 = 1;
+     s0 = s0 + s1 | 0;
+     l0 = s0;
+     continue label$5;
+    }
+   }
+   label$8 : {
+    s0 = l1;
+    s1 = l0;
+    s0 = s0 - s1 | 0;
+    s1 = 2;
+    s0 = (s0 | 0) < (s1 | 0) | 0;
+    if (s0) { break label$8; }
+    s0 = l0;
+    s0 = HEAPU8[s0];
+    s1 = 194;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$8; }
+    s0 = l0;
+    s0 = HEAPU8[s0 + 1 | 0];
+    s1 = 160;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$8; }
+    s0 = l0;
+    s1 = 2;
+    s0 = s0 + s1 | 0;
+    l0 = s0;
+    continue label$1;
+   }
+   break label$1;
+  }
+  s0 = l0;
+  return s0;
+ }
+ function $13(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0, s4 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l1 = s0;
+  label$1 : {
+   s0 = l0;
+   s0 = $14(s0) | 0;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l1;
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   s2 = 1769304421; s2h = 25970;
+   s3 = 6;
+   s0 = $15(s0, s1, s2, s2h, s3) | 0;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 40 | 0) >> 2];
+   s2 = 7;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   label$2 : {
+    s0 = l0;
+    s1 = 1;
+    s0 = $35(s0, s1) | 0;
+    l2 = s0;
+    s1 = 58;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$2; }
+    s0 = l2;
+    s1 = 46;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$2; }
+    label$3 : {
+     s0 = l2;
+     s1 = 40;
+     s0 = (s0 | 0) != (s1 | 0) | 0;
+     if (s0) { break label$3; }
+     s0 = l0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 40 | 0) >> 2];
+     l3 = s1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     s0 = l0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 28 | 0) >> 2];
+     l2 = s1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 28 | 0) >> 2] = s1;
+     s0 = l0;
+     s0 = HEAP32[(s0 + 48 | 0) >> 2];
+     s1 = l2;
+     s2 = 3;
+     s1 = s1 << s2;
+     s0 = s0 + s1 | 0;
+     l2 = s0;
+     s1 = 5;
+     HEAP32[s0 >> 2] = s1;
+     s0 = l2;
+     s1 = l3;
+     HEAP32[(s0 + 4 | 0) >> 2] = s1;
+     s0 = l0;
+     s1 = 1;
+     s0 = $35(s0, s1) | 0;
+     l2 = s0;
+     s0 = l0;
+     s1 = l1;
+     s2 = l0;
+     s2 = HEAP32[(s2 + 40 | 0) >> 2];
+     s3 = 0;
+     s4 = l3;
+     s0 = $0(s0, s1, s2, s3, s4) | 0;
+     l1 = s0;
+     s0 = l0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 56 | 0) >> 2];
+     l3 = s1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 56 | 0) >> 2] = s1;
+     s0 = l0;
+     s0 = HEAP32[(s0 + 64 | 0) >> 2];
+     s1 = l3;
+     s2 = 2;
+     s1 = s1 << s2;
+     s0 = s0 + s1 | 0;
+     s1 = l1;
+     HEAP32[s0 >> 2] = s1;
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        label$7 : {
+         s0 = l2;
+         s1 = 34;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$7; }
+         s0 = l2;
+         s1 = 96;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$5; }
+         s0 = l2;
+         s1 = 39;
+         s0 = (s0 | 0) != (s1 | 0) | 0;
+         if (s0) { break label$6; }
+        }
+        s0 = l0;
+        s1 = l2;
+        $21(s0, s1);
+        break label$4;
+       }
+       s0 = l0;
+       s1 = l0;
+       s1 = HEAP32[(s1 + 40 | 0) >> 2];
+       s2 = -1;
+       s1 = s1 + s2 | 0;
+       HEAP32[(s0 + 40 | 0) >> 2] = s1;
+       return;
+      }
+      s0 = l0;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 28 | 0) >> 2];
+      l2 = s1;
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 28 | 0) >> 2] = s1;
+      s0 = l0;
+      s0 = HEAP32[(s0 + 48 | 0) >> 2];
+      s1 = l2;
+      s2 = 3;
+      s1 = s1 << s2;
+      s0 = s0 + s1 | 0;
+      l2 = s0;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 40 | 0) >> 2];
+      HEAP32[(s0 + 4 | 0) >> 2] = s1;
+      s0 = l2;
+      s1 = 3;
+      HEAP32[s0 >> 2] = s1;
+      s0 = l0;
+      $22(s0);
+     }
+     s0 = l0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 40 | 0) >> 2];
+     l2 = s1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     l3 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     label$8 : {
+      s0 = l0;
+      s1 = 1;
+      s0 = $35(s0, s1) | 0;
+      s1 = 41;
+      s0 = (s0 | 0) != (s1 | 0) | 0;
+      if (s0) { break label$8; }
+      s0 = l1;
+      s1 = l3;
+      HEAP32[(s0 + 4 | 0) >> 2] = s1;
+      s0 = l1;
+      s1 = 1;
+      HEAP8[s0 + 24 | 0] = s1;
+      s0 = l0;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 28 | 0) >> 2];
+      s2 = -1;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 28 | 0) >> 2] = s1;
+      s0 = l1;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 40 | 0) >> 2];
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 12 | 0) >> 2] = s1;
+      s0 = l1;
+      s1 = l1;
+      s1 = HEAP32[s1 >> 2];
+      l3 = s1;
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      s2 = l2;
+      s3 = l3;
+      s3 = HEAPU8[s3];
+      s4 = 96;
+      s3 = (s3 | 0) == (s4 | 0) | 0;
+      s1 = $3(s1, s2, s3) | 0;
+      HEAP8[s0 + 25 | 0] = s1;
+      s0 = l0;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 56 | 0) >> 2];
+      s2 = -1;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 56 | 0) >> 2] = s1;
+      return;
+     }
+     s0 = l0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 40 | 0) >> 2];
+     s2 = -1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     return;
+    }
+    label$9 : {
+     label$10 : {
+      s0 = l2;
+      s1 = 24;
+      s0 = s0 << s1;
+      s1 = 24;
+      s0 = s0 >> s1;
+      s1 = 0;
+      s0 = (s0 | 0) < (s1 | 0) | 0;
+      if (s0) { break label$10; }
+      s0 = l0;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 40 | 0) >> 2];
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 40 | 0) >> 2] = s1;
+      break label$9;
+     }
+     s0 = l0;
+     s0 = $40(s0) | 0;
+     l2 = s0;
+    }
+    s0 = l2;
+    s0 = $41(s0) | 0;
+    if (s0) { break label$2; }
+    s0 = l0;
+    s1 = l1;
+    s2 = l0;
+    s2 = HEAP32[(s2 + 40 | 0) >> 2];
+    l2 = s2;
+    s3 = l2;
+    s4 = l2;
+    s0 = $0(s0, s1, s2, s3, s4) | 0;
+   }
+   label$11 : {
+    s0 = l0;
+    s0 = HEAP32[(s0 + 40 | 0) >> 2];
+    l2 = s0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 80 | 0) >> 2];
+    s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+    if (s0) { break label$11; }
+    s0 = l0;
+    s1 = l2;
+    HEAP32[(s0 + 80 | 0) >> 2] = s1;
+   }
+   s0 = l0;
+   s1 = l1;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  }
+ }
+ function $14(l0) {
+  var s0 = 0, s1 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 36 | 0) >> 2];
+  s1 = l0;
+  s1 = HEAP32[(s1 + 40 | 0) >> 2];
+  s0 = $20(s0, s1) | 0;
+  return s0;
+ }
+ function $15(l0, l1, l2, l2h, l3) {
+  var l4 = 0, l5 = 0, s0 = 0, s0h = 0, s1 = 0, s1h = 0, s2 = 0;
+  s0 = global$0;
+  s1 = 16;
+  s0 = s0 - s1 | 0;
+  l4 = s0;
+  global$0 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     s0 = l0;
+     s0 = HEAP32[(s0 + 44 | 0) >> 2];
+     l5 = s0;
+     s1 = l1;
+     s0 = s0 >>> 0 < s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     s0 = l5;
+     s1 = l1;
+     s0 = s0 - s1 | 0;
+     s1 = l3;
+     s2 = -1;
+     s1 = s1 + s2 | 0;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$2; }
+    }
+    s0 = l0;
+    s1 = 1;
+    HEAP8[s0 + 70 | 0] = s1;
+    s0 = 0;
+    l1 = s0;
+    break label$1;
+   }
+   s0 = l4;
+   s1 = 0; s1h = 0;
+   HEAP32[(s0 + 8 | 0) >> 2] = s1; HEAP32[(s0 + 12 | 0) >> 2] = s1h;
+   s0 = l4;
+   s1 = 8;
+   s0 = s0 + s1 | 0;
+   s1 = l1;
+   s2 = l3;
+   s0 = $63(s0, s1, s2) | 0;
+   s0 = l4;
+   s0h = HEAP32[(s0 + 12 | 0) >> 2]; s0 = HEAP32[(s0 + 8 | 0) >> 2];
+   s1 = l2; s1h = l2h;
+   s0 = (s0 | 0) == (s1 | 0) & (s0h | 0) == (s1h | 0);
+   l1 = s0;
+  }
+  s0 = l4;
+  s1 = 16;
+  s0 = s0 + s1 | 0;
+  global$0 = s0;
+  s0 = l1;
+  return s0;
+ }
+ function $16(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, l4 = 0, l5 = 0, l6 = 0, s0 = 0, s1 = 0, s1h = 0, s2 = 0, s2h = 0, s3 = 0, s4 = 0;
+  s0 = l0;
+  s1 = l0;
+  s1 = HEAP32[(s1 + 40 | 0) >> 2];
+  l1 = s1;
+  s2 = 6;
+  s1 = s1 + s2 | 0;
+  l2 = s1;
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 20 | 0) >> 2];
+  l3 = s0;
+  s0 = l0;
+  s1 = 1;
+  s0 = $35(s0, s1) | 0;
+  l4 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        label$7 : {
+         s0 = l0;
+         s0 = HEAP32[(s0 + 40 | 0) >> 2];
+         l5 = s0;
+         s1 = l2;
+         s0 = (s0 | 0) != (s1 | 0) | 0;
+         if (s0) { break label$7; }
+         s0 = l4;
+         s0 = $36(s0) | 0;
+         s0 = !s0 | 0;
+         if (s0) { break label$6; }
+        }
+        label$8 : {
+         label$9 : {
+          label$10 : {
+           label$11 : {
+            s0 = l4;
+            s1 = 42;
+            s0 = (s0 | 0) == (s1 | 0) | 0;
+            if (s0) { break label$11; }
+            s0 = l4;
+            s1 = 123;
+            s0 = (s0 | 0) != (s1 | 0) | 0;
+            if (s0) { break label$10; }
+            s0 = l0;
+            s1 = l5;
+            s2 = 1;
+            s1 = s1 + s2 | 0;
+            HEAP32[(s0 + 40 | 0) >> 2] = s1;
+            s0 = l0;
+            s1 = 1;
+            s0 = $35(s0, s1) | 0;
+            l2 = s0;
+            s0 = l0;
+            s0 = HEAP32[(s0 + 40 | 0) >> 2];
+            l5 = s0;
+            label$12 : while (1) {
+             label$13 : {
+              label$14 : {
+               s0 = l2;
+               s1 = 255;
+               s0 = s0 & s1;
+               l4 = s0;
+               s1 = 34;
+               s0 = (s0 | 0) == (s1 | 0) | 0;
+               if (s0) { break label$14; }
+               s0 = l4;
+               s1 = 39;
+               s0 = (s0 | 0) == (s1 | 0) | 0;
+               if (s0) { break label$14; }
+               s0 = l0;
+               s1 = l4;
+               s0 = $37(s0, s1) | 0;
+               s0 = l0;
+               s0 = HEAP32[(s0 + 40 | 0) >> 2];
+               l4 = s0;
+               break label$13;
+              }
+              s0 = l0;
+              s1 = l4;
+              $21(s0, s1);
+              s0 = l0;
+              s1 = l0;
+              s1 = HEAP32[(s1 + 40 | 0) >> 2];
+              s2 = 1;
+              s1 = s1 + s2 | 0;
+              l4 = s1;
+              HEAP32[(s0 + 40 | 0) >> 2] = s1;
+             }
+             s0 = l0;
+             s1 = 1;
+             s0 = $35(s0, s1) | 0;
+             label$15 : {
+              s0 = l0;
+              s1 = l5;
+              s2 = l4;
+              s0 = $38(s0, s1, s2) | 0;
+              l2 = s0;
+              s1 = 44;
+              s0 = (s0 | 0) != (s1 | 0) | 0;
+              if (s0) { break label$15; }
+              s0 = l0;
+              s1 = l0;
+              s1 = HEAP32[(s1 + 40 | 0) >> 2];
+              s2 = 1;
+              s1 = s1 + s2 | 0;
+              HEAP32[(s0 + 40 | 0) >> 2] = s1;
+              s0 = l0;
+              s1 = 1;
+              s0 = $35(s0, s1) | 0;
+              l2 = s0;
+             }
+             s0 = l0;
+             s0 = HEAP32[(s0 + 40 | 0) >> 2];
+             l4 = s0;
+             s0 = l2;
+             s1 = 125;
+             s0 = (s0 | 0) == (s1 | 0) | 0;
+             if (s0) { break label$9; }
+             s0 = l4;
+             s1 = l5;
+             s0 = (s0 | 0) == (s1 | 0) | 0;
+             if (s0) { break label$1; }
+             s0 = l4;
+             l5 = s0;
+             s0 = l4;
+             s1 = l0;
+             s1 = HEAP32[(s1 + 44 | 0) >> 2];
+             s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+             if (s0) { continue label$12; }
+             break label$1;
+            }
+           }
+           s0 = l0;
+           s1 = l5;
+           s2 = 1;
+           s1 = s1 + s2 | 0;
+           HEAP32[(s0 + 40 | 0) >> 2] = s1;
+           s0 = l0;
+           s1 = 1;
+           s0 = $35(s0, s1) | 0;
+           s0 = l0;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 40 | 0) >> 2];
+           l4 = s1;
+           s2 = l4;
+           s0 = $38(s0, s1, s2) | 0;
+           break label$8;
+          }
+          s0 = l0;
+          s1 = 0;
+          HEAP8[s0 + 24 | 0] = s1;
+          label$16 : {
+           label$17 : {
+            label$18 : {
+             label$19 : {
+              label$20 : {
+               label$21 : {
+                s0 = l4;
+                s1 = -97;
+                s0 = s0 + s1 | 0;
+                switch (s0) {
+                 case 0:
+                  break label$19;
+                 case 1: case 4: case 6: case 7: case 8: case 9: case 10:
+                  break label$6;
+                 case 2:
+                  break label$17;
+                 case 3:
+                  break label$20;
+                 case 5:
+                  break label$18;
+                 case 11:
+                  break label$16;
+                 default:
+                  break label$21;
+                }
+               }
+               s0 = l4;
+               s1 = 118;
+               s0 = (s0 | 0) == (s1 | 0) | 0;
+               if (s0) { break label$16; }
+               break label$6;
+              }
+              s0 = l0;
+              s1 = l5;
+              s2 = 7;
+              s1 = s1 + s2 | 0;
+              l1 = s1;
+              HEAP32[(s0 + 40 | 0) >> 2] = s1;
+              s0 = 97;
+              l4 = s0;
+              label$22 : {
+               s0 = l0;
+               s1 = 1;
+               s0 = $35(s0, s1) | 0;
+               l2 = s0;
+               s1 = 97;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$22; }
+               s0 = 0;
+               l3 = s0;
+               s0 = l0;
+               s0 = $14(s0) | 0;
+               s0 = !s0 | 0;
+               if (s0) { break label$2; }
+               s0 = l0;
+               s1 = l0;
+               s1 = HEAP32[(s1 + 40 | 0) >> 2];
+               s2 = 1;
+               s1 = s1 + s2 | 0;
+               s2 = 1668184435; s2h = 0;
+               s3 = 4;
+               s0 = $15(s0, s1, s2, s2h, s3) | 0;
+               s0 = !s0 | 0;
+               if (s0) { break label$2; }
+               label$23 : {
+                label$24 : {
+                 s0 = l0;
+                 s0 = HEAP32[(s0 + 44 | 0) >> 2];
+                 s1 = l0;
+                 s1 = HEAP32[(s1 + 40 | 0) >> 2];
+                 s2 = 5;
+                 s1 = s1 + s2 | 0;
+                 l2 = s1;
+                 s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                 if (s0) { break label$24; }
+                 s0 = l0;
+                 s1 = 1;
+                 HEAP8[s0 + 70 | 0] = s1;
+                 s0 = 0;
+                 l6 = s0;
+                 break label$23;
+                }
+                s0 = l2;
+                s0 = HEAPU8[s0];
+                l6 = s0;
+               }
+               s0 = l6;
+               s1 = 255;
+               s0 = s0 & s1;
+               s0 = $28(s0) | 0;
+               s0 = !s0 | 0;
+               if (s0) { break label$2; }
+               s0 = l0;
+               s1 = l2;
+               HEAP32[(s0 + 40 | 0) >> 2] = s1;
+               s0 = l0;
+               s1 = 0;
+               s0 = $35(s0, s1) | 0;
+               l2 = s0;
+              }
+              s0 = l2;
+              l4 = s0;
+              label$25 : {
+               s0 = l2;
+               s1 = 102;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$25; }
+               s0 = 0;
+               l3 = s0;
+               s0 = l0;
+               s0 = $14(s0) | 0;
+               s0 = !s0 | 0;
+               if (s0) { break label$3; }
+               s0 = l0;
+               s1 = l0;
+               s1 = HEAP32[(s1 + 40 | 0) >> 2];
+               s2 = 1;
+               s1 = s1 + s2 | 0;
+               s2 = 1952673397; s2h = 7237481;
+               s3 = 7;
+               s0 = $15(s0, s1, s2, s2h, s3) | 0;
+               s0 = !s0 | 0;
+               if (s0) { break label$3; }
+               label$26 : {
+                s0 = l0;
+                s0 = HEAP32[(s0 + 44 | 0) >> 2];
+                s1 = l0;
+                s1 = HEAP32[(s1 + 40 | 0) >> 2];
+                s2 = 8;
+                s1 = s1 + s2 | 0;
+                l6 = s1;
+                s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                if (s0) { break label$26; }
+                s0 = 102;
+                l4 = s0;
+                s0 = 0;
+                l3 = s0;
+                break label$4;
+               }
+               label$27 : {
+                label$28 : {
+                 s0 = l6;
+                 s0 = HEAPU8[s0];
+                 s1 = -9;
+                 s0 = s0 + s1 | 0;
+                 l4 = s0;
+                 s1 = 23;
+                 s0 = s0 >>> 0 > s1 >>> 0 | 0;
+                 if (s0) { break label$28; }
+                 s0 = 1;
+                 s1 = l4;
+                 s0 = s0 << s1;
+                 s1 = 8388639;
+                 s0 = s0 & s1;
+                 if (s0) { break label$27; }
+                }
+                s0 = 102;
+                l4 = s0;
+                s0 = 0;
+                l3 = s0;
+                s0 = l6;
+                s0 = HEAPU8[s0];
+                s1 = -40;
+                s0 = s0 + s1 | 0;
+                switch (s0) {
+                 case 0: case 2:
+                  break label$27;
+                 default:
+                  break label$2;
+                }
+               }
+               s0 = l0;
+               s1 = l6;
+               HEAP32[(s0 + 40 | 0) >> 2] = s1;
+               label$29 : {
+                s0 = l0;
+                s1 = 1;
+                s0 = $35(s0, s1) | 0;
+                l4 = s0;
+                s1 = 42;
+                s0 = (s0 | 0) != (s1 | 0) | 0;
+                if (s0) { break label$29; }
+                s0 = l0;
+                s1 = l0;
+                s1 = HEAP32[(s1 + 40 | 0) >> 2];
+                s2 = 1;
+                s1 = s1 + s2 | 0;
+                HEAP32[(s0 + 40 | 0) >> 2] = s1;
+                s0 = l0;
+                s1 = 1;
+                s0 = $35(s0, s1) | 0;
+                l4 = s0;
+               }
+               s0 = l4;
+               s1 = 40;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$25; }
+               s0 = l0;
+               s1 = l5;
+               s2 = l1;
+               s3 = 0;
+               s4 = 0;
+               $1(s0, s1, s2, s3, s4);
+               s0 = l5;
+               s1 = 6;
+               s0 = s0 + s1 | 0;
+               l4 = s0;
+               label$30 : {
+                s0 = l0;
+                s0 = HEAP32[(s0 + 40 | 0) >> 2];
+                l2 = s0;
+                s1 = l0;
+                s1 = HEAP32[(s1 + 80 | 0) >> 2];
+                s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+                if (s0) { break label$30; }
+                s0 = l0;
+                s1 = l2;
+                HEAP32[(s0 + 80 | 0) >> 2] = s1;
+               }
+               s0 = l0;
+               s1 = l4;
+               HEAP32[(s0 + 40 | 0) >> 2] = s1;
+               return;
+              }
+              s0 = l2;
+              s1 = 102;
+              s0 = (s0 | 0) == (s1 | 0) | 0;
+              l3 = s0;
+              s0 = l4;
+              s1 = 99;
+              s0 = (s0 | 0) != (s1 | 0) | 0;
+              if (s0) { break label$2; }
+              s0 = l0;
+              s0 = $14(s0) | 0;
+              s0 = !s0 | 0;
+              if (s0) { break label$5; }
+              s0 = l0;
+              s1 = l0;
+              s1 = HEAP32[(s1 + 40 | 0) >> 2];
+              s2 = 1;
+              s1 = s1 + s2 | 0;
+              s2 = 1936941420; s2h = 0;
+              s3 = 4;
+              s0 = $15(s0, s1, s2, s2h, s3) | 0;
+              s0 = !s0 | 0;
+              if (s0) { break label$5; }
+              s0 = 99;
+              l4 = s0;
+              s0 = l0;
+              s0 = HEAP32[(s0 + 44 | 0) >> 2];
+              s1 = l0;
+              s1 = HEAP32[(s1 + 40 | 0) >> 2];
+              s2 = 5;
+              s1 = s1 + s2 | 0;
+              l2 = s1;
+              s0 = s0 >>> 0 < s1 >>> 0 | 0;
+              if (s0) { break label$4; }
+              label$31 : {
+               label$32 : {
+                s0 = l2;
+                s0 = HEAPU8[s0];
+                s1 = -9;
+                s0 = s0 + s1 | 0;
+                l4 = s0;
+                s1 = 23;
+                s0 = s0 >>> 0 > s1 >>> 0 | 0;
+                if (s0) { break label$32; }
+                s0 = 1;
+                s1 = l4;
+                s0 = s0 << s1;
+                s1 = 8388639;
+                s0 = s0 & s1;
+                if (s0) { break label$31; }
+               }
+               s0 = 99;
+               l4 = s0;
+               s0 = l2;
+               s0 = HEAPU8[s0];
+               s1 = 123;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$2; }
+              }
+              s0 = l0;
+              s1 = l2;
+              HEAP32[(s0 + 40 | 0) >> 2] = s1;
+              s0 = 1;
+              l3 = s0;
+              s0 = l0;
+              s1 = 1;
+              s0 = $35(s0, s1) | 0;
+              l4 = s0;
+              s1 = 123;
+              s0 = (s0 | 0) != (s1 | 0) | 0;
+              if (s0) { break label$2; }
+              s0 = l0;
+              s1 = l5;
+              s2 = l1;
+              s3 = 0;
+              s4 = 0;
+              $1(s0, s1, s2, s3, s4);
+              s0 = l5;
+              s1 = 6;
+              s0 = s0 + s1 | 0;
+              l4 = s0;
+              label$33 : {
+               s0 = l0;
+               s0 = HEAP32[(s0 + 40 | 0) >> 2];
+               l2 = s0;
+               s1 = l0;
+               s1 = HEAP32[(s1 + 80 | 0) >> 2];
+               s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+               if (s0) { break label$33; }
+               s0 = l0;
+               s1 = l2;
+               HEAP32[(s0 + 80 | 0) >> 2] = s1;
+              }
+              s0 = l0;
+              s1 = l4;
+              HEAP32[(s0 + 40 | 0) >> 2] = s1;
+              return;
+             }
+             s0 = l0;
+             s1 = l5;
+             s2 = 5;
+             s1 = s1 + s2 | 0;
+             HEAP32[(s0 + 40 | 0) >> 2] = s1;
+             s0 = l0;
+             s1 = 1;
+             s0 = $35(s0, s1) | 0;
+             s0 = l0;
+             s0 = HEAP32[(s0 + 40 | 0) >> 2];
+             l5 = s0;
+            }
+            s0 = l0;
+            s1 = l5;
+            s2 = 8;
+            s1 = s1 + s2 | 0;
+            HEAP32[(s0 + 40 | 0) >> 2] = s1;
+            label$34 : {
+             s0 = l0;
+             s1 = 1;
+             s0 = $35(s0, s1) | 0;
+             l2 = s0;
+             s1 = 42;
+             s0 = (s0 | 0) != (s1 | 0) | 0;
+             if (s0) { break label$34; }
+             s0 = l0;
+             s1 = l0;
+             s1 = HEAP32[(s1 + 40 | 0) >> 2];
+             s2 = 1;
+             s1 = s1 + s2 | 0;
+             HEAP32[(s0 + 40 | 0) >> 2] = s1;
+             s0 = l0;
+             s1 = 1;
+             s0 = $35(s0, s1) | 0;
+             l2 = s0;
+            }
+            s0 = l0;
+            s0 = HEAP32[(s0 + 40 | 0) >> 2];
+            l4 = s0;
+            s0 = l0;
+            s1 = l2;
+            s0 = $37(s0, s1) | 0;
+            s0 = l0;
+            s1 = l4;
+            s2 = l0;
+            s2 = HEAP32[(s2 + 40 | 0) >> 2];
+            l2 = s2;
+            s3 = l4;
+            s4 = l2;
+            $1(s0, s1, s2, s3, s4);
+            s0 = l0;
+            s1 = l0;
+            s1 = HEAP32[(s1 + 40 | 0) >> 2];
+            s2 = -1;
+            s1 = s1 + s2 | 0;
+            HEAP32[(s0 + 40 | 0) >> 2] = s1;
+            return;
+           }
+           s0 = l0;
+           s1 = l5;
+           s2 = 1;
+           s1 = s1 + s2 | 0;
+           s2 = 1936941420; s2h = 0;
+           s3 = 4;
+           s0 = $15(s0, s1, s2, s2h, s3) | 0;
+           l2 = s0;
+           s0 = l0;
+           s0 = HEAP32[(s0 + 40 | 0) >> 2];
+           l4 = s0;
+           label$35 : {
+            s0 = l2;
+            s0 = !s0 | 0;
+            if (s0) { break label$35; }
+            label$36 : {
+             label$37 : {
+              s0 = l0;
+              s0 = HEAP32[(s0 + 44 | 0) >> 2];
+              s1 = l4;
+              s2 = 5;
+              s1 = s1 + s2 | 0;
+              l2 = s1;
+              s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+              if (s0) { break label$37; }
+              s0 = l0;
+              s1 = 1;
+              HEAP8[s0 + 70 | 0] = s1;
+              s0 = 0;
+              l5 = s0;
+              break label$36;
+             }
+             s0 = l2;
+             s0 = HEAPU8[s0];
+             l5 = s0;
+            }
+            s0 = l5;
+            s1 = 255;
+            s0 = s0 & s1;
+            s0 = $27(s0) | 0;
+            s0 = !s0 | 0;
+            if (s0) { break label$35; }
+            s0 = l0;
+            s1 = l2;
+            HEAP32[(s0 + 40 | 0) >> 2] = s1;
+            s0 = l0;
+            s1 = 1;
+            s0 = $35(s0, s1) | 0;
+            l2 = s0;
+            s0 = l0;
+            s0 = HEAP32[(s0 + 40 | 0) >> 2];
+            l4 = s0;
+            s0 = l0;
+            s1 = l2;
+            s0 = $37(s0, s1) | 0;
+            s0 = l0;
+            s1 = l4;
+            s2 = l0;
+            s2 = HEAP32[(s2 + 40 | 0) >> 2];
+            l2 = s2;
+            s3 = l4;
+            s4 = l2;
+            $1(s0, s1, s2, s3, s4);
+            s0 = l0;
+            s1 = l0;
+            s1 = HEAP32[(s1 + 40 | 0) >> 2];
+            s2 = -1;
+            s1 = s1 + s2 | 0;
+            HEAP32[(s0 + 40 | 0) >> 2] = s1;
+            return;
+           }
+           s0 = l4;
+           s1 = 2;
+           s0 = s0 + s1 | 0;
+           l5 = s0;
+          }
+          s0 = l0;
+          s1 = 0;
+          HEAP8[s0 + 24 | 0] = s1;
+          s0 = l5;
+          s1 = 2;
+          s0 = s0 + s1 | 0;
+          l4 = s0;
+          label$38 : {
+           label$39 : while (1) {
+            s0 = l0;
+            s1 = l4;
+            s2 = 1;
+            s1 = s1 + s2 | 0;
+            HEAP32[(s0 + 40 | 0) >> 2] = s1;
+            s0 = l0;
+            s1 = 1;
+            s0 = $35(s0, s1) | 0;
+            l2 = s0;
+            s0 = l0;
+            s0 = HEAP32[(s0 + 40 | 0) >> 2];
+            l4 = s0;
+            s0 = l0;
+            s1 = l2;
+            s0 = $37(s0, s1) | 0;
+            s1 = 32;
+            s0 = s0 | s1;
+            s1 = 123;
+            s0 = (s0 | 0) == (s1 | 0) | 0;
+            if (s0) { break label$38; }
+            s0 = l0;
+            s0 = HEAP32[(s0 + 40 | 0) >> 2];
+            l2 = s0;
+            s1 = l4;
+            s0 = (s0 | 0) == (s1 | 0) | 0;
+            if (s0) { break label$6; }
+            s0 = l0;
+            s1 = l4;
+            s2 = l2;
+            s3 = l4;
+            s4 = l2;
+            $1(s0, s1, s2, s3, s4);
+            s0 = l0;
+            s1 = 1;
+            s0 = $35(s0, s1) | 0;
+            s1 = 44;
+            s0 = (s0 | 0) != (s1 | 0) | 0;
+            if (s0) { break label$38; }
+            s0 = l0;
+            s0 = HEAP32[(s0 + 40 | 0) >> 2];
+            l4 = s0;
+            continue label$39;
+           }
+          }
+          s0 = l0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 40 | 0) >> 2];
+          s2 = -1;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 40 | 0) >> 2] = s1;
+          return;
+         }
+         s0 = l0;
+         s1 = l4;
+         s2 = 1;
+         s1 = s1 + s2 | 0;
+         HEAP32[(s0 + 40 | 0) >> 2] = s1;
+        }
+        label$40 : {
+         s0 = l0;
+         s1 = 1;
+         s0 = $35(s0, s1) | 0;
+         s1 = 102;
+         s0 = (s0 | 0) != (s1 | 0) | 0;
+         if (s0) { break label$40; }
+         s0 = l0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 40 | 0) >> 2];
+         s2 = 1;
+         s1 = s1 + s2 | 0;
+         s2 = 7171954; s2h = 0;
+         s3 = 3;
+         s0 = $15(s0, s1, s2, s2h, s3) | 0;
+         s0 = !s0 | 0;
+         if (s0) { break label$40; }
+         s0 = l0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 40 | 0) >> 2];
+         s2 = 4;
+         s1 = s1 + s2 | 0;
+         HEAP32[(s0 + 40 | 0) >> 2] = s1;
+         s0 = l0;
+         s1 = l1;
+         s2 = l0;
+         s3 = 1;
+         s2 = $35(s2, s3) | 0;
+         $39(s0, s1, s2);
+         label$41 : {
+          label$42 : {
+           s0 = l3;
+           if (s0) { break label$42; }
+           s0 = l0;
+           s0 = HEAP32[(s0 + 8 | 0) >> 2];
+           s1 = 4;
+           s0 = s0 + s1 | 0;
+           l0 = s0;
+           break label$41;
+          }
+          s0 = l3;
+          s1 = 20;
+          s0 = s0 + s1 | 0;
+          l0 = s0;
+         }
+         label$43 : while (1) {
+          s0 = l0;
+          s0 = HEAP32[s0 >> 2];
+          l0 = s0;
+          s0 = !s0 | 0;
+          if (s0) { break label$6; }
+          s0 = l0;
+          s1 = 0;
+          HEAP8[s0 + 17 | 0] = s1;
+          s0 = l0;
+          s1 = 0; s1h = 0;
+          store32(s0 + 8 | 0, s1); store32(s0 + 12 | 0, s1h);
+          s0 = l0;
+          s1 = 20;
+          s0 = s0 + s1 | 0;
+          l0 = s0;
+          continue label$43;
+         }
+        }
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        s2 = -1;
+        s1 = s1 + s2 | 0;
+        HEAP32[(s0 + 40 | 0) >> 2] = s1;
+       }
+       return;
+      }
+      s0 = 99;
+      l4 = s0;
+      break label$2;
+     }
+     s0 = l0;
+     s1 = 1;
+     HEAP8[s0 + 70 | 0] = s1;
+     break label$2;
+    }
+    s0 = 102;
+    l4 = s0;
+   }
+   s0 = l0;
+   s0 = HEAP32[(s0 + 40 | 0) >> 2];
+   l2 = s0;
+   s0 = l0;
+   s1 = l4;
+   s0 = $37(s0, s1) | 0;
+   label$44 : {
+    s0 = l3;
+    s0 = !s0 | 0;
+    if (s0) { break label$44; }
+    s0 = l0;
+    s0 = HEAP32[(s0 + 40 | 0) >> 2];
+    l4 = s0;
+    s1 = l2;
+    s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+    if (s0) { break label$44; }
+    s0 = l0;
+    s1 = l5;
+    s2 = l1;
+    s3 = l2;
+    s4 = l4;
+    $1(s0, s1, s2, s3, s4);
+    s0 = l0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 40 | 0) >> 2];
+    s2 = -1;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 40 | 0) >> 2] = s1;
+    return;
+   }
+   s0 = l0;
+   s1 = l5;
+   s2 = l1;
+   s3 = 0;
+   s4 = 0;
+   $1(s0, s1, s2, s3, s4);
+   s0 = l5;
+   s1 = 6;
+   s0 = s0 + s1 | 0;
+   l4 = s0;
+   label$45 : {
+    s0 = l0;
+    s0 = HEAP32[(s0 + 40 | 0) >> 2];
+    l2 = s0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 80 | 0) >> 2];
+    s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+    if (s0) { break label$45; }
+    s0 = l0;
+    s1 = l2;
+    HEAP32[(s0 + 80 | 0) >> 2] = s1;
+   }
+   s0 = l0;
+   s1 = l4;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   return;
+  }
+  s0 = l0;
+  $5(s0);
+ }
+ function $17(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, l4 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0, s4 = 0;
+  s0 = l0;
+  s1 = l0;
+  s1 = HEAP32[(s1 + 40 | 0) >> 2];
+  l1 = s1;
+  s2 = 6;
+  s1 = s1 + s2 | 0;
+  l2 = s1;
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        label$7 : {
+         label$8 : {
+          label$9 : {
+           label$10 : {
+            s0 = l0;
+            s1 = 1;
+            s0 = $35(s0, s1) | 0;
+            l3 = s0;
+            s1 = -39;
+            s0 = s0 + s1 | 0;
+            switch (s0) {
+             case 0: case 3:
+              break label$6;
+             case 1:
+              break label$8;
+             case 2: case 4: case 5: case 6:
+              break label$9;
+             case 7:
+              break label$7;
+             default:
+              break label$10;
+            }
+           }
+           s0 = l3;
+           s1 = 34;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$6; }
+           s0 = l3;
+           s1 = 123;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$5; }
+          }
+          s0 = l0;
+          s0 = HEAP32[(s0 + 40 | 0) >> 2];
+          s1 = l2;
+          s0 = (s0 | 0) != (s1 | 0) | 0;
+          if (s0) { break label$6; }
+          s0 = l0;
+          s1 = l1;
+          s2 = 5;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 40 | 0) >> 2] = s1;
+          return;
+         }
+         s0 = l0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 28 | 0) >> 2];
+         l3 = s1;
+         s2 = 1;
+         s1 = s1 + s2 | 0;
+         HEAP32[(s0 + 28 | 0) >> 2] = s1;
+         s0 = l0;
+         s0 = HEAP32[(s0 + 48 | 0) >> 2];
+         s1 = l3;
+         s2 = 3;
+         s1 = s1 << s2;
+         s0 = s0 + s1 | 0;
+         l3 = s0;
+         s1 = 5;
+         HEAP32[s0 >> 2] = s1;
+         s0 = l3;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 40 | 0) >> 2];
+         l2 = s1;
+         HEAP32[(s0 + 4 | 0) >> 2] = s1;
+         s0 = l0;
+         s0 = HEAP32[(s0 + 32 | 0) >> 2];
+         s0 = HEAPU8[s0];
+         s1 = 46;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$4; }
+         s0 = l0;
+         s1 = l2;
+         s2 = 1;
+         s1 = s1 + s2 | 0;
+         HEAP32[(s0 + 40 | 0) >> 2] = s1;
+         s0 = l0;
+         s1 = 1;
+         s0 = $35(s0, s1) | 0;
+         l4 = s0;
+         s0 = l0;
+         s1 = l1;
+         s2 = l0;
+         s2 = HEAP32[(s2 + 40 | 0) >> 2];
+         s3 = 0;
+         s4 = l2;
+         s0 = $0(s0, s1, s2, s3, s4) | 0;
+         l3 = s0;
+         s0 = l0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 56 | 0) >> 2];
+         l2 = s1;
+         s2 = 1;
+         s1 = s1 + s2 | 0;
+         HEAP32[(s0 + 56 | 0) >> 2] = s1;
+         s0 = l0;
+         s0 = HEAP32[(s0 + 64 | 0) >> 2];
+         s1 = l2;
+         s2 = 2;
+         s1 = s1 << s2;
+         s0 = s0 + s1 | 0;
+         s1 = l3;
+         HEAP32[s0 >> 2] = s1;
+         label$11 : {
+          label$12 : {
+           label$13 : {
+            label$14 : {
+             s0 = l4;
+             s1 = 34;
+             s0 = (s0 | 0) == (s1 | 0) | 0;
+             if (s0) { break label$14; }
+             s0 = l4;
+             s1 = 96;
+             s0 = (s0 | 0) == (s1 | 0) | 0;
+             if (s0) { break label$12; }
+             s0 = l4;
+             s1 = 39;
+             s0 = (s0 | 0) != (s1 | 0) | 0;
+             if (s0) { break label$13; }
+            }
+            s0 = l0;
+            s1 = l4;
+            $21(s0, s1);
+            break label$11;
+           }
+           s0 = l0;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 40 | 0) >> 2];
+           s2 = -1;
+           s1 = s1 + s2 | 0;
+           HEAP32[(s0 + 40 | 0) >> 2] = s1;
+           return;
+          }
+          s0 = l0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 28 | 0) >> 2];
+          l2 = s1;
+          s2 = 1;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 28 | 0) >> 2] = s1;
+          s0 = l0;
+          s0 = HEAP32[(s0 + 48 | 0) >> 2];
+          s1 = l2;
+          s2 = 3;
+          s1 = s1 << s2;
+          s0 = s0 + s1 | 0;
+          l2 = s0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 40 | 0) >> 2];
+          HEAP32[(s0 + 4 | 0) >> 2] = s1;
+          s0 = l2;
+          s1 = 3;
+          HEAP32[s0 >> 2] = s1;
+          s0 = l0;
+          $22(s0);
+         }
+         s0 = l0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 40 | 0) >> 2];
+         l2 = s1;
+         s2 = 1;
+         s1 = s1 + s2 | 0;
+         l4 = s1;
+         HEAP32[(s0 + 40 | 0) >> 2] = s1;
+         label$15 : {
+          label$16 : {
+           label$17 : {
+            s0 = l0;
+            s1 = 1;
+            s0 = $35(s0, s1) | 0;
+            s1 = -41;
+            s0 = s0 + s1 | 0;
+            switch (s0) {
+             case 0:
+              break label$16;
+             case 3:
+              break label$17;
+             default:
+              break label$15;
+            }
+           }
+           s0 = l0;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 40 | 0) >> 2];
+           s2 = 1;
+           s1 = s1 + s2 | 0;
+           HEAP32[(s0 + 40 | 0) >> 2] = s1;
+           s0 = l0;
+           s1 = 1;
+           s0 = $35(s0, s1) | 0;
+           s0 = l3;
+           s1 = 1;
+           HEAP8[s0 + 24 | 0] = s1;
+           s0 = l3;
+           s1 = l4;
+           HEAP32[(s0 + 4 | 0) >> 2] = s1;
+           s0 = l3;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 40 | 0) >> 2];
+           l4 = s1;
+           HEAP32[(s0 + 16 | 0) >> 2] = s1;
+           s0 = l3;
+           s0 = HEAP32[s0 >> 2];
+           l1 = s0;
+           s1 = 1;
+           s0 = s0 + s1 | 0;
+           s1 = l2;
+           s2 = l1;
+           s2 = HEAPU8[s2];
+           s3 = 96;
+           s2 = (s2 | 0) == (s3 | 0) | 0;
+           s0 = $3(s0, s1, s2) | 0;
+           l2 = s0;
+           s0 = l0;
+           s1 = l4;
+           s2 = -1;
+           s1 = s1 + s2 | 0;
+           HEAP32[(s0 + 40 | 0) >> 2] = s1;
+           s0 = l3;
+           s1 = l2;
+           HEAP8[s0 + 25 | 0] = s1;
+           return;
+          }
+          s0 = l3;
+          s1 = l4;
+          HEAP32[(s0 + 4 | 0) >> 2] = s1;
+          s0 = l3;
+          s1 = 1;
+          HEAP8[s0 + 24 | 0] = s1;
+          s0 = l0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 28 | 0) >> 2];
+          s2 = -1;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 28 | 0) >> 2] = s1;
+          s0 = l3;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 40 | 0) >> 2];
+          s2 = 1;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 12 | 0) >> 2] = s1;
+          s0 = l3;
+          s1 = l3;
+          s1 = HEAP32[s1 >> 2];
+          l4 = s1;
+          s2 = 1;
+          s1 = s1 + s2 | 0;
+          s2 = l2;
+          s3 = l4;
+          s3 = HEAPU8[s3];
+          s4 = 96;
+          s3 = (s3 | 0) == (s4 | 0) | 0;
+          s1 = $3(s1, s2, s3) | 0;
+          HEAP8[s0 + 25 | 0] = s1;
+          s0 = l0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 56 | 0) >> 2];
+          s2 = -1;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 56 | 0) >> 2] = s1;
+          return;
+         }
+         s0 = l0;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 40 | 0) >> 2];
+         s2 = -1;
+         s1 = s1 + s2 | 0;
+         HEAP32[(s0 + 40 | 0) >> 2] = s1;
+         return;
+        }
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        HEAP32[(s0 + 40 | 0) >> 2] = s1;
+        s0 = l0;
+        s1 = 1;
+        s0 = $35(s0, s1) | 0;
+        s1 = 109;
+        s0 = (s0 | 0) != (s1 | 0) | 0;
+        if (s0) { break label$4; }
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        s2 = 6386789; s2h = 0;
+        s3 = 3;
+        s0 = $15(s0, s1, s2, s2h, s3) | 0;
+        s0 = !s0 | 0;
+        if (s0) { break label$4; }
+        s0 = l0;
+        s0 = HEAP32[(s0 + 32 | 0) >> 2];
+        s0 = HEAPU8[s0];
+        s1 = 46;
+        s0 = (s0 | 0) == (s1 | 0) | 0;
+        if (s0) { break label$4; }
+        s0 = l0;
+        s1 = l1;
+        s2 = l1;
+        s3 = l0;
+        s3 = HEAP32[(s3 + 40 | 0) >> 2];
+        s4 = 4;
+        s3 = s3 + s4 | 0;
+        s4 = 0;
+        s4 = HEAP32[(s4 + 8952 | 0) >> 2];
+        s0 = $0(s0, s1, s2, s3, s4) | 0;
+        return;
+       }
+       s0 = l0;
+       s0 = HEAP32[(s0 + 28 | 0) >> 2];
+       if (s0) { break label$3; }
+       s0 = l0;
+       s0 = HEAP32[(s0 + 40 | 0) >> 2];
+       l3 = s0;
+       s0 = l0;
+       s0 = HEAP32[(s0 + 44 | 0) >> 2];
+       l4 = s0;
+       label$18 : while (1) {
+        s0 = l3;
+        s1 = l4;
+        s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+        if (s0) { break label$1; }
+        label$19 : {
+         label$20 : {
+          s0 = l3;
+          s0 = HEAPU8[s0];
+          l2 = s0;
+          s1 = 39;
+          s0 = (s0 | 0) == (s1 | 0) | 0;
+          if (s0) { break label$20; }
+          s0 = l2;
+          s1 = 34;
+          s0 = (s0 | 0) != (s1 | 0) | 0;
+          if (s0) { break label$19; }
+         }
+         s0 = l0;
+         s1 = l1;
+         s2 = l2;
+         $39(s0, s1, s2);
+         return;
+        }
+        s0 = l0;
+        s1 = l3;
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        l3 = s1;
+        HEAP32[(s0 + 40 | 0) >> 2] = s1;
+        continue label$18;
+       }
+      }
+      s0 = l0;
+      s0 = HEAP32[(s0 + 28 | 0) >> 2];
+      if (s0) { break label$2; }
+      s0 = l0;
+      s0 = HEAP32[(s0 + 40 | 0) >> 2];
+      l3 = s0;
+      label$21 : {
+       label$22 : while (1) {
+        label$23 : {
+         label$24 : {
+          label$25 : {
+           s0 = l3;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 44 | 0) >> 2];
+           s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+           if (s0) { break label$25; }
+           s0 = l0;
+           s1 = 1;
+           s0 = $35(s0, s1) | 0;
+           l3 = s0;
+           s1 = 34;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$24; }
+           s0 = l3;
+           s1 = 39;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$24; }
+           s0 = l3;
+           s1 = 125;
+           s0 = (s0 | 0) != (s1 | 0) | 0;
+           if (s0) { break label$23; }
+           s0 = l0;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 40 | 0) >> 2];
+           s2 = 1;
+           s1 = s1 + s2 | 0;
+           HEAP32[(s0 + 40 | 0) >> 2] = s1;
+          }
+          s0 = l0;
+          s1 = 1;
+          s0 = $35(s0, s1) | 0;
+          s0 = l0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 40 | 0) >> 2];
+          s2 = 1836020326; s2h = 0;
+          s3 = 4;
+          s0 = $15(s0, s1, s2, s2h, s3) | 0;
+          s0 = !s0 | 0;
+          if (s0) { break label$1; }
+          s0 = l0;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 40 | 0) >> 2];
+          s2 = 4;
+          s1 = s1 + s2 | 0;
+          HEAP32[(s0 + 40 | 0) >> 2] = s1;
+          s0 = l0;
+          s1 = 1;
+          s0 = $35(s0, s1) | 0;
+          l3 = s0;
+          s1 = 34;
+          s0 = (s0 | 0) == (s1 | 0) | 0;
+          if (s0) { break label$21; }
+          s0 = l3;
+          s1 = 39;
+          s0 = (s0 | 0) == (s1 | 0) | 0;
+          if (s0) { break label$21; }
+          break label$1;
+         }
+         s0 = l0;
+         s1 = l3;
+         $21(s0, s1);
+        }
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        l3 = s1;
+        HEAP32[(s0 + 40 | 0) >> 2] = s1;
+        continue label$22;
+       }
+      }
+      s0 = l0;
+      s1 = l1;
+      s2 = l3;
+      $39(s0, s1, s2);
+     }
+     return;
+    }
+    s0 = l0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 40 | 0) >> 2];
+    s2 = -1;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 40 | 0) >> 2] = s1;
+    return;
+   }
+   s0 = l0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 40 | 0) >> 2];
+   s2 = -1;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   return;
+  }
+  s0 = l0;
+  $5(s0);
+ }
+ function $18(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l1 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 44 | 0) >> 2];
+  l2 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : while (1) {
+     s0 = l0;
+     s1 = l1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     l3 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     s0 = l1;
+     s1 = l2;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$2; }
+     s0 = l0;
+     s1 = l3;
+     s2 = l2;
+     s3 = 10;
+     s4 = 13;
+     s5 = 10;
+     s6 = 10;
+     s7 = 10;
+     s1 = $42(s1, s2, s3, s4, s5, s6, s7) | 0;
+     l1 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     s0 = l1;
+     s0 = HEAPU8[s0];
+     s1 = -10;
+     s0 = s0 + s1 | 0;
+     switch (s0) {
+      case 0: case 3:
+       break label$1;
+      default:
+       continue label$3;
+     }
+    }
+   }
+   s0 = l0;
+   s1 = 1;
+   HEAP8[s0 + 70 | 0] = s1;
+  }
+ }
+ function $19(l0, l1) {
+  var l2 = 0, l3 = 0, l4 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  s1 = 1;
+  s0 = s0 + s1 | 0;
+  l2 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 44 | 0) >> 2];
+  l3 = s0;
+  label$1 : while (1) {
+   s0 = l0;
+   s1 = l2;
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   l4 = s1;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       s0 = l2;
+       s1 = l3;
+       s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+       if (s0) { break label$5; }
+       s0 = l1;
+       s0 = !s0 | 0;
+       if (s0) { break label$4; }
+       s0 = l0;
+       s1 = l4;
+       s2 = l3;
+       s3 = 42;
+       s4 = 42;
+       s5 = 42;
+       s6 = 42;
+       s7 = 42;
+       s1 = $42(s1, s2, s3, s4, s5, s6, s7) | 0;
+       l2 = s1;
+       HEAP32[(s0 + 40 | 0) >> 2] = s1;
+       s0 = l2;
+       s0 = HEAPU8[s0];
+       l4 = s0;
+       break label$2;
+      }
+      s0 = l0;
+      s1 = 1;
+      HEAP8[s0 + 70 | 0] = s1;
+      break label$3;
+     }
+     s0 = l0;
+     s1 = l4;
+     s2 = l3;
+     s3 = 42;
+     s4 = 10;
+     s5 = 13;
+     s6 = 42;
+     s7 = 42;
+     s1 = $42(s1, s2, s3, s4, s5, s6, s7) | 0;
+     l2 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     s0 = l2;
+     s0 = HEAPU8[s0];
+     l4 = s0;
+     s1 = -10;
+     s0 = s0 + s1 | 0;
+     switch (s0) {
+      case 0: case 3:
+       break label$3;
+      default:
+       break label$2;
+     }
+    }
+    return;
+   }
+   s0 = l4;
+   s1 = 255;
+   s0 = s0 & s1;
+   s1 = 42;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   if (s0) { continue label$1; }
+   label$6 : {
+    s0 = l3;
+    s1 = l2;
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    l4 = s1;
+    s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+    if (s0) { break label$6; }
+    s0 = l0;
+    s1 = 1;
+    HEAP8[s0 + 70 | 0] = s1;
+    continue label$1;
+   }
+   s0 = l4;
+   s0 = HEAPU8[s0];
+   s1 = 47;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   if (s0) { continue label$1; }
+   break label$1;
+  }
+  s0 = l0;
+  s1 = l4;
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+ }
+ function $20(l0, l1) {
+  var l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0;
+  s0 = 1;
+  l2 = s0;
+  label$1 : {
+   s0 = l1;
+   s1 = l0;
+   s0 = (s0 | 0) == (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l1;
+   s1 = -1;
+   s0 = s0 + s1 | 0;
+   s0 = HEAPU8[s0];
+   l3 = s0;
+   s0 = $27(s0) | 0;
+   if (s0) { break label$1; }
+   s0 = 0;
+   l2 = s0;
+   s0 = l1;
+   s1 = l0;
+   s0 = s0 - s1 | 0;
+   s1 = 2;
+   s0 = (s0 | 0) < (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l1;
+   s1 = -2;
+   s0 = s0 + s1 | 0;
+   s0 = HEAPU8[s0];
+   s1 = 194;
+   s0 = (s0 | 0) == (s1 | 0) | 0;
+   s1 = l3;
+   s2 = 160;
+   s1 = (s1 | 0) == (s2 | 0) | 0;
+   s0 = s0 & s1;
+   l2 = s0;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function $21(l0, l1) {
+  var l2 = 0, l3 = 0, l4 = 0, l5 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l2 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 44 | 0) >> 2];
+  l3 = s0;
+  label$1 : while (1) {
+   s0 = l0;
+   s1 = l2;
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   l4 = s1;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      s0 = l2;
+      s1 = l3;
+      s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+      if (s0) { break label$4; }
+      s0 = l0;
+      s1 = l4;
+      s2 = l3;
+      s3 = l1;
+      s4 = 92;
+      s5 = 10;
+      s6 = 13;
+      s7 = l1;
+      s1 = $42(s1, s2, s3, s4, s5, s6, s7) | 0;
+      l4 = s1;
+      HEAP32[(s0 + 40 | 0) >> 2] = s1;
+      s0 = l4;
+      s0 = HEAPU8[s0];
+      l5 = s0;
+      s1 = l1;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$3; }
+      label$5 : {
+       s0 = l5;
+       s1 = 92;
+       s0 = (s0 | 0) == (s1 | 0) | 0;
+       if (s0) { break label$5; }
+       s0 = l4;
+       l2 = s0;
+       s0 = l5;
+       s1 = -10;
+       s0 = s0 + s1 | 0;
+       switch (s0) {
+        case 0: case 3:
+         break label$4;
+        default:
+         continue label$1;
+       }
+      }
+      s0 = l0;
+      s1 = l4;
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      l2 = s1;
+      HEAP32[(s0 + 40 | 0) >> 2] = s1;
+      s0 = l3;
+      s1 = l2;
+      s0 = s0 >>> 0 < s1 >>> 0 | 0;
+      if (s0) { break label$2; }
+      s0 = l2;
+      s0 = HEAPU8[s0];
+      s1 = 13;
+      s0 = (s0 | 0) != (s1 | 0) | 0;
+      if (s0) { continue label$1; }
+      s0 = l3;
+      s1 = l4;
+      s2 = 2;
+      s1 = s1 + s2 | 0;
+      l4 = s1;
+      s0 = s0 >>> 0 < s1 >>> 0 | 0;
+      if (s0) { break label$2; }
+      s0 = l4;
+      s0 = HEAPU8[s0];
+      s1 = 10;
+      s0 = (s0 | 0) != (s1 | 0) | 0;
+      if (s0) { continue label$1; }
+      s0 = l0;
+      s1 = l4;
+      HEAP32[(s0 + 40 | 0) >> 2] = s1;
+      s0 = l4;
+      l2 = s0;
+      continue label$1;
+     }
+     s0 = l0;
+     $5(s0);
+    }
+    return;
+   }
+   s0 = l0;
+   s1 = 1;
+   HEAP8[s0 + 70 | 0] = s1;
+   continue label$1;
+  }
+ }
+ function $22(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l1 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 44 | 0) >> 2];
+  l2 = s0;
+  label$1 : while (1) {
+   s0 = l0;
+   s1 = l1;
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   l3 = s1;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      s0 = l1;
+      s1 = l2;
+      s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+      if (s0) { break label$4; }
+      s0 = l0;
+      s1 = l3;
+      s2 = l2;
+      s3 = 36;
+      s4 = 96;
+      s5 = 92;
+      s6 = 36;
+      s7 = 36;
+      s1 = $42(s1, s2, s3, s4, s5, s6, s7) | 0;
+      l1 = s1;
+      HEAP32[(s0 + 40 | 0) >> 2] = s1;
+      label$5 : {
+       label$6 : {
+        s0 = l1;
+        s0 = HEAPU8[s0];
+        l3 = s0;
+        s1 = -92;
+        s0 = s0 + s1 | 0;
+        switch (s0) {
+         case 0:
+          break label$2;
+         case 1: case 2: case 3:
+          continue label$1;
+         case 4:
+          break label$5;
+         default:
+          break label$6;
+        }
+       }
+       s0 = l3;
+       s1 = 36;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { continue label$1; }
+       label$7 : {
+        s0 = l2;
+        s1 = l1;
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        l3 = s1;
+        s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+        if (s0) { break label$7; }
+        s0 = l0;
+        s1 = 1;
+        HEAP8[s0 + 70 | 0] = s1;
+        continue label$1;
+       }
+       s0 = l3;
+       s0 = HEAPU8[s0];
+       s1 = 123;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { continue label$1; }
+       s0 = l0;
+       s1 = l3;
+       HEAP32[(s0 + 40 | 0) >> 2] = s1;
+       s0 = l0;
+       s1 = l0;
+       s1 = HEAP32[(s1 + 28 | 0) >> 2];
+       l1 = s1;
+       s2 = 1;
+       s1 = s1 + s2 | 0;
+       HEAP32[(s0 + 28 | 0) >> 2] = s1;
+       s0 = l0;
+       s0 = HEAP32[(s0 + 48 | 0) >> 2];
+       s1 = l1;
+       s2 = 3;
+       s1 = s1 << s2;
+       s0 = s0 + s1 | 0;
+       l1 = s0;
+       s1 = 4;
+       HEAP32[s0 >> 2] = s1;
+       s0 = l1;
+       s1 = l3;
+       HEAP32[(s0 + 4 | 0) >> 2] = s1;
+       return;
+      }
+      s0 = l0;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 28 | 0) >> 2];
+      s2 = -1;
+      s1 = s1 + s2 | 0;
+      l1 = s1;
+      HEAP32[(s0 + 28 | 0) >> 2] = s1;
+      s0 = l0;
+      s0 = HEAP32[(s0 + 48 | 0) >> 2];
+      s1 = l1;
+      s2 = 3;
+      s1 = s1 << s2;
+      s0 = s0 + s1 | 0;
+      s0 = HEAP32[s0 >> 2];
+      s1 = 3;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$3; }
+     }
+     s0 = l0;
+     $5(s0);
+    }
+    return;
+   }
+   s0 = l0;
+   s1 = l1;
+   s2 = 1;
+   s1 = s1 + s2 | 0;
+   l1 = s1;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   continue label$1;
+  }
+ }
+ function $23(l0) {
+  var l1 = 0, l2 = 0, s0 = 0, s1 = 0, s2 = 0;
+  s0 = 1;
+  l1 = s0;
+  label$1 : {
+   label$2 : {
+    s0 = l0;
+    s1 = -33;
+    s0 = s0 + s1 | 0;
+    l2 = s0;
+    s1 = 5;
+    s0 = s0 >>> 0 > s1 >>> 0 | 0;
+    if (s0) { break label$2; }
+    s0 = 1;
+    s1 = l2;
+    s0 = s0 << s1;
+    s1 = 49;
+    s0 = s0 & s1;
+    if (s0) { break label$1; }
+   }
+   s0 = l0;
+   s1 = -58;
+   s0 = s0 + s1 | 0;
+   s1 = 255;
+   s0 = s0 & s1;
+   s1 = 6;
+   s0 = s0 >>> 0 < s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = 41;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   s1 = l0;
+   s2 = -40;
+   s1 = s1 + s2 | 0;
+   s2 = 255;
+   s1 = s1 & s2;
+   s2 = 7;
+   s1 = s1 >>> 0 < s2 >>> 0 | 0;
+   s0 = s0 & s1;
+   if (s0) { break label$1; }
+   label$3 : {
+    s0 = l0;
+    s1 = -91;
+    s0 = s0 + s1 | 0;
+    switch (s0) {
+     case 0: case 3:
+      break label$1;
+     default:
+      break label$3;
+    }
+   }
+   s0 = l0;
+   s1 = 125;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   s1 = l0;
+   s2 = -123;
+   s1 = s1 + s2 | 0;
+   s2 = 255;
+   s1 = s1 & s2;
+   s2 = 4;
+   s1 = s1 >>> 0 < s2 >>> 0 | 0;
+   s0 = s0 & s1;
+   l1 = s0;
+  }
+  s0 = l1;
+  return s0;
+ }
+ function $24(l0, l1) {
+  var l2 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0;
+  s0 = 1;
+  l2 = s0;
+  label$1 : {
+   s0 = l0;
+   s1 = l1;
+   s2 = 1818847351; s2h = 101;
+   s3 = 5;
+   s0 = $43(s0, s1, s2, s2h, s3) | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l1;
+   s2 = 7499622; s2h = 0;
+   s3 = 3;
+   s0 = $43(s0, s1, s2, s2h, s3) | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l1;
+   s2 = 26217; s2h = 0;
+   s3 = 2;
+   s0 = $43(s0, s1, s2, s2h, s3) | 0;
+   l2 = s0;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function $25(l0, l1) {
+  var l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0;
+  s0 = 1;
+  l2 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        s0 = l1;
+        s0 = HEAPU8[s0];
+        l3 = s0;
+        s1 = -59;
+        s0 = s0 + s1 | 0;
+        switch (s0) {
+         case 0:
+          break label$1;
+         case 1: case 2:
+          break label$2;
+         case 3:
+          break label$5;
+         default:
+          break label$6;
+        }
+       }
+       label$7 : {
+        s0 = l3;
+        s1 = -101;
+        s0 = s0 + s1 | 0;
+        switch (s0) {
+         case 0:
+          break label$3;
+         case 1: case 2:
+          break label$2;
+         case 3:
+          break label$4;
+         default:
+          break label$7;
+        }
+       }
+       s0 = l3;
+       s1 = 41;
+       s0 = (s0 | 0) == (s1 | 0) | 0;
+       if (s0) { break label$1; }
+       s0 = l3;
+       s1 = 121;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$2; }
+       s0 = l0;
+       s1 = l1;
+       s2 = -1;
+       s1 = s1 + s2 | 0;
+       s2 = 1634625894; s2h = 27756;
+       s3 = 6;
+       s0 = $43(s0, s1, s2, s2h, s3) | 0;
+       return s0;
+      }
+      s0 = l1;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 36 | 0) >> 2];
+      s0 = s0 - s1 | 0;
+      s1 = 1;
+      s0 = (s0 | 0) < (s1 | 0) | 0;
+      if (s0) { break label$2; }
+      s0 = l1;
+      s1 = -1;
+      s0 = s0 + s1 | 0;
+      s0 = HEAPU8[s0];
+      s1 = 61;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      return s0;
+     }
+     s0 = l0;
+     s1 = l1;
+     s2 = -1;
+     s1 = s1 + s2 | 0;
+     s2 = 1668571491; s2h = 0;
+     s3 = 4;
+     s0 = $43(s0, s1, s2, s2h, s3) | 0;
+     return s0;
+    }
+    s0 = l0;
+    s1 = l1;
+    s2 = -1;
+    s1 = s1 + s2 | 0;
+    s2 = 7564389; s2h = 0;
+    s3 = 3;
+    s0 = $43(s0, s1, s2, s2h, s3) | 0;
+    return s0;
+   }
+   s0 = 0;
+   l2 = s0;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function $26(l0, l1) {
+  var l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0;
+  s0 = 0;
+  l2 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        label$7 : {
+         label$8 : {
+          label$9 : {
+           label$10 : {
+            s0 = l1;
+            s0 = HEAPU8[s0];
+            s1 = -100;
+            s0 = s0 + s1 | 0;
+            switch (s0) {
+             case 0:
+              break label$10;
+             case 1:
+              break label$9;
+             case 2:
+              break label$8;
+             case 7:
+              break label$7;
+             case 10:
+              break label$6;
+             case 11:
+              break label$5;
+             case 14:
+              break label$4;
+             case 16:
+              break label$3;
+             case 19:
+              break label$2;
+             default:
+              break label$1;
+            }
+           }
+           s0 = l1;
+           s1 = l0;
+           s1 = HEAP32[(s1 + 36 | 0) >> 2];
+           s0 = s0 - s1 | 0;
+           s1 = 1;
+           s0 = (s0 | 0) < (s1 | 0) | 0;
+           if (s0) { break label$1; }
+           label$11 : {
+            label$12 : {
+             s0 = l1;
+             s1 = -1;
+             s0 = s0 + s1 | 0;
+             s0 = HEAPU8[s0];
+             s1 = -105;
+             s0 = s0 + s1 | 0;
+             switch (s0) {
+              case 0:
+               break label$12;
+              case 3:
+               break label$11;
+              default:
+               break label$1;
+             }
+            }
+            s0 = l0;
+            s1 = l1;
+            s2 = -2;
+            s1 = s1 + s2 | 0;
+            s2 = 28534; s2h = 0;
+            s3 = 2;
+            s0 = $43(s0, s1, s2, s2h, s3) | 0;
+            return s0;
+           }
+           s0 = l0;
+           s1 = l1;
+           s2 = -2;
+           s1 = s1 + s2 | 0;
+           s2 = 6646137; s2h = 0;
+           s3 = 3;
+           s0 = $43(s0, s1, s2, s2h, s3) | 0;
+           return s0;
+          }
+          s0 = l1;
+          s1 = l0;
+          s1 = HEAP32[(s1 + 36 | 0) >> 2];
+          s0 = s0 - s1 | 0;
+          l3 = s0;
+          s1 = 1;
+          s0 = (s0 | 0) < (s1 | 0) | 0;
+          if (s0) { break label$1; }
+          label$13 : {
+           label$14 : {
+            label$15 : {
+             s0 = l1;
+             s1 = -1;
+             s0 = s0 + s1 | 0;
+             s0 = HEAPU8[s0];
+             s1 = -115;
+             s0 = s0 + s1 | 0;
+             switch (s0) {
+              case 0:
+               break label$15;
+              case 1:
+               break label$14;
+              case 2:
+               break label$13;
+              default:
+               break label$1;
+             }
+            }
+            s0 = l3;
+            s1 = 2;
+            s0 = s0 >>> 0 < s1 >>> 0 | 0;
+            if (s0) { break label$1; }
+            label$16 : {
+             s0 = l1;
+             s1 = -2;
+             s0 = s0 + s1 | 0;
+             s0 = HEAPU8[s0];
+             l3 = s0;
+             s1 = 97;
+             s0 = (s0 | 0) == (s1 | 0) | 0;
+             if (s0) { break label$16; }
+             s0 = l3;
+             s1 = 108;
+             s0 = (s0 | 0) != (s1 | 0) | 0;
+             if (s0) { break label$1; }
+             s0 = l0;
+             s1 = l1;
+             s2 = -3;
+             s1 = s1 + s2 | 0;
+             s2 = 101;
+             s0 = $44(s0, s1, s2) | 0;
+             return s0;
+            }
+            s0 = l0;
+            s1 = l1;
+            s2 = -3;
+            s1 = s1 + s2 | 0;
+            s2 = 99;
+            s0 = $44(s0, s1, s2) | 0;
+            return s0;
+           }
+           s0 = l0;
+           s1 = l1;
+           s2 = -2;
+           s1 = s1 + s2 | 0;
+           s2 = 1701602660; s2h = 0;
+           s3 = 4;
+           s0 = $43(s0, s1, s2, s2h, s3) | 0;
+           return s0;
+          }
+          s0 = l0;
+          s1 = l1;
+          s2 = -2;
+          s1 = s1 + s2 | 0;
+          s2 = 1953394531; s2h = 28265;
+          s3 = 6;
+          s0 = $43(s0, s1, s2, s2h, s3) | 0;
+          return s0;
+         }
+         s0 = l1;
+         s1 = l0;
+         s1 = HEAP32[(s1 + 36 | 0) >> 2];
+         s0 = s0 - s1 | 0;
+         l3 = s0;
+         s1 = 1;
+         s0 = (s0 | 0) < (s1 | 0) | 0;
+         if (s0) { break label$1; }
+         s0 = l1;
+         s1 = -1;
+         s0 = s0 + s1 | 0;
+         s0 = HEAPU8[s0];
+         s1 = 111;
+         s0 = (s0 | 0) != (s1 | 0) | 0;
+         if (s0) { break label$1; }
+         s0 = l3;
+         s1 = 1;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$1; }
+         s0 = l1;
+         s1 = -2;
+         s0 = s0 + s1 | 0;
+         s0 = HEAPU8[s0];
+         s1 = 101;
+         s0 = (s0 | 0) != (s1 | 0) | 0;
+         if (s0) { break label$1; }
+         s0 = l3;
+         s1 = 3;
+         s0 = s0 >>> 0 < s1 >>> 0 | 0;
+         if (s0) { break label$1; }
+         label$17 : {
+          s0 = l1;
+          s1 = -3;
+          s0 = s0 + s1 | 0;
+          s0 = HEAPU8[s0];
+          l3 = s0;
+          s1 = 112;
+          s0 = (s0 | 0) == (s1 | 0) | 0;
+          if (s0) { break label$17; }
+          s0 = l3;
+          s1 = 99;
+          s0 = (s0 | 0) != (s1 | 0) | 0;
+          if (s0) { break label$1; }
+          s0 = l0;
+          s1 = l1;
+          s2 = -4;
+          s1 = s1 + s2 | 0;
+          s2 = 1953721961; s2h = 28257;
+          s3 = 6;
+          s0 = $43(s0, s1, s2, s2h, s3) | 0;
+          return s0;
+         }
+         s0 = l0;
+         s1 = l1;
+         s2 = -4;
+         s1 = s1 + s2 | 0;
+         s2 = 31092; s2h = 0;
+         s3 = 2;
+         s0 = $43(s0, s1, s2, s2h, s3) | 0;
+         return s0;
+        }
+        s0 = l0;
+        s1 = l1;
+        s2 = -1;
+        s1 = s1 + s2 | 0;
+        s2 = 1634038370; s2h = 0;
+        s3 = 4;
+        s0 = $43(s0, s1, s2, s2h, s3) | 0;
+        return s0;
+       }
+       s0 = 1;
+       l2 = s0;
+       s0 = l0;
+       s1 = l1;
+       s2 = -1;
+       s1 = s1 + s2 | 0;
+       l1 = s1;
+       s2 = 105;
+       s0 = $44(s0, s1, s2) | 0;
+       if (s0) { break label$1; }
+       s0 = l0;
+       s1 = l1;
+       s2 = 1970562418; s2h = 114;
+       s3 = 5;
+       s0 = $43(s0, s1, s2, s2h, s3) | 0;
+       return s0;
+      }
+      s0 = l0;
+      s1 = l1;
+      s2 = -1;
+      s1 = s1 + s2 | 0;
+      s2 = 100;
+      s0 = $44(s0, s1, s2) | 0;
+      return s0;
+     }
+     s0 = l0;
+     s1 = l1;
+     s2 = -1;
+     s1 = s1 + s2 | 0;
+     s2 = 1969382756; s2h = 6645607;
+     s3 = 7;
+     s0 = $43(s0, s1, s2, s2h, s3) | 0;
+     return s0;
+    }
+    s0 = l0;
+    s1 = l1;
+    s2 = -1;
+    s1 = s1 + s2 | 0;
+    s2 = 1767995233; s2h = 0;
+    s3 = 4;
+    s0 = $43(s0, s1, s2, s2h, s3) | 0;
+    return s0;
+   }
+   s0 = l1;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 36 | 0) >> 2];
+   s0 = s0 - s1 | 0;
+   s1 = 1;
+   s0 = (s0 | 0) < (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   label$18 : {
+    s0 = l1;
+    s1 = -1;
+    s0 = s0 + s1 | 0;
+    s0 = HEAPU8[s0];
+    l3 = s0;
+    s1 = 111;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$18; }
+    s0 = l3;
+    s1 = 101;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$1; }
+    s0 = l0;
+    s1 = l1;
+    s2 = -2;
+    s1 = s1 + s2 | 0;
+    s2 = 110;
+    s0 = $44(s0, s1, s2) | 0;
+    return s0;
+   }
+   s0 = l0;
+   s1 = l1;
+   s2 = -2;
+   s1 = s1 + s2 | 0;
+   s2 = 7497844; s2h = 0;
+   s3 = 3;
+   s0 = $43(s0, s1, s2, s2h, s3) | 0;
+   l2 = s0;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function $27(l0) {
+  var l1 = 0, s0 = 0, s1 = 0;
+  label$1 : {
+   s0 = l0;
+   s1 = -9;
+   s0 = s0 + s1 | 0;
+   s1 = 255;
+   s0 = s0 & s1;
+   l1 = s0;
+   s1 = 24;
+   s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = 8388639;
+   s1 = l1;
+   s0 = s0 >>> s1 | 0;
+   s1 = 1;
+   s0 = s0 & s1;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   s0 = 1;
+   return s0;
+  }
+  s0 = l0;
+  s1 = 46;
+  s0 = (s0 | 0) != (s1 | 0) | 0;
+  s1 = l0;
+  s1 = $36(s1) | 0;
+  s0 = s0 & s1;
+  return s0;
+ }
+ function $28(l0) {
+  var s0 = 0, s1 = 0, s2 = 0;
+  s0 = l0;
+  s1 = -9;
+  s0 = s0 + s1 | 0;
+  s1 = 255;
+  s0 = s0 & s1;
+  l0 = s0;
+  s1 = 24;
+  s0 = s0 >>> 0 < s1 >>> 0 | 0;
+  s1 = 8388621;
+  s2 = l0;
+  s1 = s1 >>> s2 | 0;
+  s0 = s0 & s1;
+  return s0;
+ }
+ function $29(l0, l1) {
+  var l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0;
+  s0 = 0;
+  l2 = s0;
+  label$1 : {
+   label$2 : {
+    s0 = l1;
+    s0 = HEAPU8[s0];
+    l3 = s0;
+    s1 = 101;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$2; }
+    s0 = l3;
+    s1 = 107;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$1; }
+    s0 = l0;
+    s1 = l1;
+    s2 = -1;
+    s1 = s1 + s2 | 0;
+    s2 = 1634038370; s2h = 0;
+    s3 = 4;
+    s0 = $43(s0, s1, s2, s2h, s3) | 0;
+    return s0;
+   }
+   s0 = l1;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 36 | 0) >> 2];
+   s0 = s0 - s1 | 0;
+   s1 = 1;
+   s0 = (s0 | 0) < (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l1;
+   s1 = -1;
+   s0 = s0 + s1 | 0;
+   s0 = HEAPU8[s0];
+   s1 = 117;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l1;
+   s2 = -2;
+   s1 = s1 + s2 | 0;
+   s2 = 1953394531; s2h = 28265;
+   s3 = 6;
+   s0 = $43(s0, s1, s2, s2h, s3) | 0;
+   l2 = s0;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function $30(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+  label$1 : {
+   label$2 : {
+    label$3 : while (1) {
+     s0 = l0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 40 | 0) >> 2];
+     l1 = s1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     l2 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     s0 = l1;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 44 | 0) >> 2];
+     l3 = s1;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$2; }
+     s0 = l0;
+     s1 = l2;
+     s2 = l3;
+     s3 = 47;
+     s4 = 91;
+     s5 = 92;
+     s6 = 10;
+     s7 = 13;
+     s1 = $42(s1, s2, s3, s4, s5, s6, s7) | 0;
+     l1 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        s0 = l1;
+        s0 = HEAPU8[s0];
+        l2 = s0;
+        s1 = -91;
+        s0 = s0 + s1 | 0;
+        switch (s0) {
+         case 0:
+          break label$5;
+         case 1:
+          break label$4;
+         default:
+          break label$6;
+        }
+       }
+       label$7 : {
+        s0 = l2;
+        s1 = -10;
+        s0 = s0 + s1 | 0;
+        switch (s0) {
+         case 0: case 3:
+          break label$2;
+         case 1: case 2:
+          continue label$3;
+         default:
+          break label$7;
+        }
+       }
+       s0 = l2;
+       s1 = 47;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { continue label$3; }
+       break label$1;
+      }
+      s0 = l0;
+      s0 = $45(s0) | 0;
+      continue label$3;
+     }
+     s0 = l0;
+     s1 = l1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     continue label$3;
+    }
+   }
+   s0 = l0;
+   $5(s0);
+  }
+ }
+ function $31(l0, l1) {
+  var l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   label$2 : {
+    s0 = l1;
+    s0 = HEAP32[(s0 + 12 | 0) >> 2];
+    l2 = s0;
+    if (s0) { break label$2; }
+    s0 = l0;
+    s0 = HEAP32[(s0 + 8 | 0) >> 2];
+    l2 = s0;
+    break label$1;
+   }
+   label$3 : {
+    label$4 : {
+     label$5 : {
+      s0 = l1;
+      s0 = HEAP32[(s0 + 16 | 0) >> 2];
+      l3 = s0;
+      if (s0) { break label$5; }
+      s0 = l0;
+      s0 = HEAP32[(s0 + 8 | 0) >> 2];
+      l3 = s0;
+      break label$4;
+     }
+     s0 = l3;
+     s1 = l2;
+     s0 = (s0 | 0) == (s1 | 0) | 0;
+     if (s0) { break label$3; }
+     s0 = l3;
+     s1 = 28;
+     s0 = s0 + s1 | 0;
+     l3 = s0;
+    }
+    s0 = l3;
+    s1 = l2;
+    HEAP32[s0 >> 2] = s1;
+   }
+   s0 = l2;
+   s1 = 28;
+   s0 = s0 + s1 | 0;
+   l2 = s0;
+  }
+  s0 = l2;
+  s1 = 0;
+  HEAP32[s0 >> 2] = s1;
+  label$6 : {
+   label$7 : {
+    s0 = l1;
+    s0 = HEAP32[(s0 + 20 | 0) >> 2];
+    l2 = s0;
+    if (s0) { break label$7; }
+    s0 = l0;
+    s0 = HEAP32[(s0 + 8 | 0) >> 2];
+    l2 = s0;
+    s1 = 0;
+    HEAP32[(s0 + 4 | 0) >> 2] = s1;
+    break label$6;
+   }
+   s0 = l2;
+   s1 = 0;
+   HEAP32[(s0 + 20 | 0) >> 2] = s1;
+   s0 = l0;
+   s0 = HEAP32[(s0 + 8 | 0) >> 2];
+   l2 = s0;
+  }
+  s0 = l2;
+  s1 = 0;
+  HEAP32[(s0 + 8 | 0) >> 2] = s1;
+  s0 = l0;
+  s1 = l1;
+  s2 = 132;
+  s0 = $63(s0, s1, s2) | 0;
+ }
+ function $32(l0, l1, l2) {
+  var l3 = 0, l4 = 0, s0 = 0, s1 = 0;
+  s0 = -1;
+  l3 = s0;
+  label$1 : {
+   label$2 : {
+    s0 = l1;
+    s1 = -1;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$2; }
+    label$3 : {
+     s0 = l0;
+     s0 = HEAP32[(s0 + 44 | 0) >> 2];
+     s1 = l1;
+     s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     s0 = l1;
+     l3 = s0;
+     break label$2;
+    }
+    s0 = 0;
+    l3 = s0;
+    s0 = l0;
+    s0 = HEAP32[(s0 + 48 | 0) >> 2];
+    l4 = s0;
+    s1 = l1;
+    s0 = s0 >>> 0 > s1 >>> 0 | 0;
+    if (s0) { break label$1; }
+    s0 = l1;
+    s1 = l4;
+    s0 = s0 - s1 | 0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 52 | 0) >> 2];
+    s0 = s0 + s1 | 0;
+    l3 = s0;
+   }
+   s0 = l2;
+   s1 = l3;
+   HEAP32[s0 >> 2] = s1;
+   s0 = 1;
+   l3 = s0;
+  }
+  s0 = l3;
+  return s0;
+ }
+ function $33(l0, l1, l2) {
+  var l3 = 0, l4 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  s0 = global$0;
+  s1 = 16;
+  s0 = s0 - s1 | 0;
+  l3 = s0;
+  global$0 = s0;
+  s0 = 0;
+  l4 = s0;
+  label$1 : {
+   s0 = l0;
+   s0 = HEAP32[(s0 + 84 | 0) >> 2];
+   s1 = l2;
+   s2 = l3;
+   s3 = 12;
+   s2 = s2 + s3 | 0;
+   s0 = $32(s0, s1, s2) | 0;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   s0 = l3;
+   s0 = HEAP32[(s0 + 12 | 0) >> 2];
+   s1 = l1;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = 1;
+   l4 = s0;
+   s0 = l1;
+   s1 = -1;
+   s0 = (s0 | 0) == (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s0 = HEAP32[(s0 + 84 | 0) >> 2];
+   s0 = HEAP32[(s0 + 44 | 0) >> 2];
+   s1 = l1;
+   s0 = s0 >>> 0 > s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l1;
+   s0 = $34(s0, s1) | 0;
+   l4 = s0;
+  }
+  s0 = l3;
+  s1 = 16;
+  s0 = s0 + s1 | 0;
+  global$0 = s0;
+  s0 = l4;
+  return s0;
+ }
+ function $34(l0, l1) {
+  var l2 = 0, s0 = 0, s1 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 36 | 0) >> 2];
+  l2 = s0;
+  s1 = l1;
+  s0 = s0 + s1 | 0;
+  l1 = s0;
+  s0 = l2;
+  s1 = l0;
+  s1 = HEAP32[(s1 + 84 | 0) >> 2];
+  s1 = HEAP32[(s1 + 52 | 0) >> 2];
+  s0 = s0 + s1 | 0;
+  s1 = 32;
+  s0 = s0 + s1 | 0;
+  l2 = s0;
+  label$1 : {
+   label$2 : while (1) {
+    s0 = l1;
+    s1 = l2;
+    s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+    if (s0) { break label$1; }
+    s0 = l1;
+    s0 = HEAPU8[s0];
+    s0 = $27(s0) | 0;
+    if (s0) { break label$1; }
+    s0 = l1;
+    s1 = -1;
+    s0 = s0 + s1 | 0;
+    l1 = s0;
+    continue label$2;
+   }
+  }
+  label$3 : {
+   label$4 : while (1) {
+    s0 = l1;
+    l0 = s0;
+    s1 = l2;
+    s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+    if (s0) { break label$3; }
+    s0 = l0;
+    s1 = -1;
+    s0 = s0 + s1 | 0;
+    l1 = s0;
+    s0 = l0;
+    s0 = HEAPU8[s0];
+    s0 = $28(s0) | 0;
+    if (s0) { continue label$4; }
+    break label$4;
+   }
+  }
+  s0 = l0;
+  s1 = l2;
+  s0 = s0 >>> 0 > s1 >>> 0 | 0;
+  return s0;
+ }
+ function $35(l0, l1) {
+  var l2 = 0, l3 = 0, l4 = 0, l5 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 44 | 0) >> 2];
+  l2 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l3 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : while (1) {
+     s0 = l0;
+     s1 = l3;
+     s2 = l2;
+     s3 = l1;
+     s1 = $12(s1, s2, s3) | 0;
+     l3 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        s0 = l2;
+        s1 = l3;
+        s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+        if (s0) { break label$6; }
+        s0 = l0;
+        s1 = 1;
+        HEAP8[s0 + 70 | 0] = s1;
+        s0 = 0;
+        l4 = s0;
+        break label$5;
+       }
+       s0 = l3;
+       s0 = HEAPU8[s0];
+       l4 = s0;
+       s1 = 47;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$5; }
+       label$7 : {
+        s0 = l2;
+        s1 = l3;
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        l3 = s1;
+        s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+        if (s0) { break label$7; }
+        s0 = 47;
+        l4 = s0;
+        break label$2;
+       }
+       label$8 : {
+        s0 = l3;
+        s0 = HEAPU8[s0];
+        l2 = s0;
+        s1 = 42;
+        s0 = (s0 | 0) == (s1 | 0) | 0;
+        if (s0) { break label$8; }
+        label$9 : {
+         s0 = l2;
+         s1 = 47;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$9; }
+         s0 = 47;
+         return s0;
+        }
+        s0 = l0;
+        $18(s0);
+        s0 = 47;
+        l4 = s0;
+        break label$4;
+       }
+       s0 = l0;
+       s1 = l1;
+       $19(s0, s1);
+       s0 = 47;
+       l4 = s0;
+       break label$4;
+      }
+      label$10 : {
+       s0 = l1;
+       s0 = !s0 | 0;
+       if (s0) { break label$10; }
+       s0 = l4;
+       s1 = -9;
+       s0 = s0 + s1 | 0;
+       l2 = s0;
+       s1 = 23;
+       s0 = s0 >>> 0 > s1 >>> 0 | 0;
+       if (s0) { break label$1; }
+       s0 = 1;
+       s1 = l2;
+       s0 = s0 << s1;
+       s1 = 8388639;
+       s0 = s0 & s1;
+       if (s0) { break label$4; }
+       break label$1;
+      }
+      s0 = l4;
+      s0 = $28(s0) | 0;
+      s0 = !s0 | 0;
+      if (s0) { break label$1; }
+     }
+     s0 = l0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 40 | 0) >> 2];
+     l5 = s1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     l3 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     s0 = l5;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 44 | 0) >> 2];
+     l2 = s1;
+     s0 = s0 >>> 0 < s1 >>> 0 | 0;
+     if (s0) { continue label$3; }
+     break label$3;
+    }
+   }
+   s0 = l0;
+   s1 = 1;
+   HEAP8[s0 + 70 | 0] = s1;
+  }
+  s0 = l4;
+  return s0;
+ }
+ function $36(l0) {
+  var l1 = 0, l2 = 0, s0 = 0, s1 = 0;
+  s0 = 1;
+  l1 = s0;
+  label$1 : {
+   label$2 : {
+    s0 = l0;
+    s1 = -33;
+    s0 = s0 + s1 | 0;
+    l2 = s0;
+    s1 = 5;
+    s0 = s0 >>> 0 > s1 >>> 0 | 0;
+    if (s0) { break label$2; }
+    s0 = 1;
+    s1 = l2;
+    s0 = s0 << s1;
+    s1 = 49;
+    s0 = s0 & s1;
+    if (s0) { break label$1; }
+   }
+   s0 = l0;
+   s1 = 248;
+   s0 = s0 & s1;
+   s1 = 40;
+   s0 = (s0 | 0) == (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = -58;
+   s0 = s0 + s1 | 0;
+   s1 = 255;
+   s0 = s0 & s1;
+   s1 = 6;
+   s0 = s0 >>> 0 < s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   label$3 : {
+    s0 = l0;
+    s1 = -91;
+    s0 = s0 + s1 | 0;
+    l2 = s0;
+    s1 = 3;
+    s0 = s0 >>> 0 > s1 >>> 0 | 0;
+    if (s0) { break label$3; }
+    s0 = l2;
+    s1 = 1;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$1; }
+   }
+   s0 = l0;
+   s1 = -123;
+   s0 = s0 + s1 | 0;
+   s1 = 255;
+   s0 = s0 & s1;
+   s1 = 4;
+   s0 = s0 >>> 0 < s1 >>> 0 | 0;
+   l1 = s0;
+  }
+  s0 = l1;
+  return s0;
+ }
+ function $37(l0, l1) {
+  var l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   label$2 : while (1) {
+    label$3 : {
+     s0 = l1;
+     s1 = 255;
+     s0 = s0 & s1;
+     l2 = s0;
+     s1 = -9;
+     s0 = s0 + s1 | 0;
+     l3 = s0;
+     s1 = 23;
+     s0 = s0 >>> 0 > s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     s0 = 1;
+     s1 = l3;
+     s0 = s0 << s1;
+     s1 = 8388639;
+     s0 = s0 & s1;
+     if (s0) { break label$1; }
+    }
+    s0 = l2;
+    s0 = $36(s0) | 0;
+    if (s0) { break label$1; }
+    label$4 : {
+     s0 = l0;
+     s0 = HEAP32[(s0 + 44 | 0) >> 2];
+     l3 = s0;
+     s1 = l0;
+     s1 = HEAP32[(s1 + 40 | 0) >> 2];
+     l2 = s1;
+     s0 = s0 - s1 | 0;
+     s1 = 2;
+     s0 = (s0 | 0) < (s1 | 0) | 0;
+     if (s0) { break label$4; }
+     s0 = l2;
+     s0 = HEAPU8[s0];
+     s1 = 194;
+     s0 = (s0 | 0) != (s1 | 0) | 0;
+     if (s0) { break label$4; }
+     s0 = l2;
+     s0 = HEAPU8[s0 + 1 | 0];
+     s1 = 160;
+     s0 = (s0 | 0) == (s1 | 0) | 0;
+     if (s0) { break label$1; }
+    }
+    s0 = l0;
+    s1 = l2;
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    l1 = s1;
+    HEAP32[(s0 + 40 | 0) >> 2] = s1;
+    label$5 : {
+     label$6 : {
+      s0 = l3;
+      s1 = l1;
+      s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+      if (s0) { break label$6; }
+      s0 = l0;
+      s1 = 1;
+      HEAP8[s0 + 70 | 0] = s1;
+      break label$5;
+     }
+     s0 = l1;
+     s0 = HEAPU8[s0];
+     l1 = s0;
+     if (s0) { continue label$2; }
+    }
+    break label$2;
+   }
+   s0 = 0;
+   l1 = s0;
+  }
+  s0 = l1;
+  s1 = 255;
+  s0 = s0 & s1;
+  return s0;
+ }
+ function $38(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, l6 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0;
+  label$1 : {
+   label$2 : {
+    s0 = l0;
+    s0 = HEAP32[(s0 + 44 | 0) >> 2];
+    s1 = l0;
+    s1 = HEAP32[(s1 + 40 | 0) >> 2];
+    l3 = s1;
+    s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+    if (s0) { break label$2; }
+    s0 = l0;
+    s1 = 1;
+    HEAP8[s0 + 70 | 0] = s1;
+    s0 = 0;
+    l4 = s0;
+    break label$1;
+   }
+   s0 = l3;
+   s0 = HEAPU8[s0];
+   l4 = s0;
+  }
+  label$3 : {
+   label$4 : {
+    s0 = l4;
+    s1 = 255;
+    s0 = s0 & s1;
+    s1 = 97;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$4; }
+    s0 = l2;
+    l5 = s0;
+    s0 = l1;
+    l6 = s0;
+    break label$3;
+   }
+   s0 = l0;
+   s1 = l3;
+   s2 = 2;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   s0 = l0;
+   s1 = 1;
+   s0 = $35(s0, s1) | 0;
+   l3 = s0;
+   s0 = l0;
+   s0 = HEAP32[(s0 + 40 | 0) >> 2];
+   l6 = s0;
+   label$5 : {
+    label$6 : {
+     s0 = l3;
+     s1 = 34;
+     s0 = (s0 | 0) == (s1 | 0) | 0;
+     if (s0) { break label$6; }
+     s0 = l3;
+     s1 = 39;
+     s0 = (s0 | 0) == (s1 | 0) | 0;
+     if (s0) { break label$6; }
+     s0 = l0;
+     s1 = l3;
+     s0 = $37(s0, s1) | 0;
+     s0 = l0;
+     s0 = HEAP32[(s0 + 40 | 0) >> 2];
+     l5 = s0;
+     break label$5;
+    }
+    s0 = l0;
+    s1 = l3;
+    $21(s0, s1);
+    s0 = l0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 40 | 0) >> 2];
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    l5 = s1;
+    HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   }
+   s0 = l0;
+   s1 = 1;
+   s0 = $35(s0, s1) | 0;
+   l4 = s0;
+   s0 = l0;
+   s0 = HEAP32[(s0 + 40 | 0) >> 2];
+   l3 = s0;
+  }
+  label$7 : {
+   s0 = l3;
+   s1 = l6;
+   s0 = (s0 | 0) == (s1 | 0) | 0;
+   if (s0) { break label$7; }
+   s0 = l0;
+   s1 = l6;
+   s2 = l5;
+   s3 = 0;
+   s4 = l1;
+   s5 = l1;
+   s6 = l2;
+   s5 = (s5 | 0) == (s6 | 0) | 0;
+   l3 = s5;
+   s3 = s5 ? s3 : s4;
+   s4 = 0;
+   s5 = l2;
+   s6 = l3;
+   s4 = s6 ? s4 : s5;
+   $1(s0, s1, s2, s3, s4);
+  }
+  s0 = l4;
+  s1 = 255;
+  s0 = s0 & s1;
+  return s0;
+ }
+ function $39(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, s0 = 0, s1 = 0, s2 = 0, s2h = 0, s3 = 0, s4 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l3 = s0;
+  label$1 : {
+   label$2 : {
+    s0 = l2;
+    s1 = 39;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$2; }
+    s0 = l2;
+    l4 = s0;
+    break label$1;
+   }
+   s0 = 34;
+   l4 = s0;
+   s0 = l2;
+   s1 = 34;
+   s0 = (s0 | 0) == (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   $5(s0);
+   return;
+  }
+  s0 = l0;
+  s1 = l4;
+  $21(s0, s1);
+  s0 = l0;
+  s1 = l1;
+  s2 = l3;
+  s3 = 1;
+  s2 = s2 + s3 | 0;
+  l2 = s2;
+  s3 = l0;
+  s3 = HEAP32[(s3 + 40 | 0) >> 2];
+  s4 = 0;
+  s4 = HEAP32[(s4 + 8948 | 0) >> 2];
+  s0 = $0(s0, s1, s2, s3, s4) | 0;
+  l1 = s0;
+  s0 = l2;
+  s1 = l0;
+  s1 = HEAP32[(s1 + 40 | 0) >> 2];
+  l3 = s1;
+  s2 = 0;
+  s0 = $3(s0, s1, s2) | 0;
+  l2 = s0;
+  s0 = l0;
+  s1 = l3;
+  s2 = 1;
+  s1 = s1 + s2 | 0;
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  s0 = l1;
+  s1 = l2;
+  HEAP8[s0 + 25 | 0] = s1;
+  label$3 : {
+   label$4 : {
+    s0 = l0;
+    s1 = 0;
+    s0 = $35(s0, s1) | 0;
+    s1 = 97;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$4; }
+    s0 = l0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 40 | 0) >> 2];
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    s2 = 1919251315; s2h = 116;
+    s3 = 5;
+    s0 = $15(s0, s1, s2, s2h, s3) | 0;
+    if (s0) { break label$3; }
+   }
+   s0 = l0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 40 | 0) >> 2];
+   s2 = -1;
+   s1 = s1 + s2 | 0;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+   return;
+  }
+  s0 = l0;
+  s1 = l0;
+  s1 = HEAP32[(s1 + 40 | 0) >> 2];
+  l5 = s1;
+  s2 = 6;
+  s1 = s1 + s2 | 0;
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  s0 = l0;
+  s1 = 1;
+  s0 = $35(s0, s1) | 0;
+  l2 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l4 = s0;
+  label$5 : {
+   label$6 : {
+    s0 = l2;
+    s1 = 123;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$6; }
+    s0 = l4;
+    l2 = s0;
+    label$7 : while (1) {
+     s0 = l0;
+     s1 = l2;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     label$8 : {
+      label$9 : {
+       label$10 : {
+        s0 = l0;
+        s1 = 1;
+        s0 = $35(s0, s1) | 0;
+        l2 = s0;
+        s1 = 34;
+        s0 = (s0 | 0) == (s1 | 0) | 0;
+        if (s0) { break label$10; }
+        s0 = l2;
+        s1 = 39;
+        s0 = (s0 | 0) != (s1 | 0) | 0;
+        if (s0) { break label$9; }
+        s0 = l0;
+        s1 = 39;
+        $21(s0, s1);
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        HEAP32[(s0 + 40 | 0) >> 2] = s1;
+        s0 = l0;
+        s1 = 1;
+        s0 = $35(s0, s1) | 0;
+        l3 = s0;
+        break label$8;
+       }
+       s0 = l0;
+       s1 = 34;
+       $21(s0, s1);
+       s0 = l0;
+       s1 = l0;
+       s1 = HEAP32[(s1 + 40 | 0) >> 2];
+       s2 = 1;
+       s1 = s1 + s2 | 0;
+       HEAP32[(s0 + 40 | 0) >> 2] = s1;
+       s0 = l0;
+       s1 = 1;
+       s0 = $35(s0, s1) | 0;
+       l3 = s0;
+       break label$8;
+      }
+      s0 = l0;
+      s1 = l2;
+      s0 = $37(s0, s1) | 0;
+      l3 = s0;
+     }
+     s0 = l0;
+     s0 = HEAP32[(s0 + 40 | 0) >> 2];
+     l2 = s0;
+     label$11 : {
+      s0 = l3;
+      s1 = 58;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$11; }
+      s0 = l2;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 80 | 0) >> 2];
+      s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+      if (s0) { break label$5; }
+      s0 = l0;
+      s1 = l2;
+      HEAP32[(s0 + 80 | 0) >> 2] = s1;
+      break label$5;
+     }
+     s0 = l0;
+     s1 = l2;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     label$12 : {
+      label$13 : {
+       label$14 : {
+        label$15 : {
+         s0 = l0;
+         s1 = 1;
+         s0 = $35(s0, s1) | 0;
+         l2 = s0;
+         s1 = 39;
+         s0 = (s0 | 0) == (s1 | 0) | 0;
+         if (s0) { break label$15; }
+         s0 = l2;
+         s1 = 34;
+         s0 = (s0 | 0) != (s1 | 0) | 0;
+         if (s0) { break label$14; }
+         s0 = 34;
+         l2 = s0;
+        }
+        s0 = l0;
+        s1 = l2;
+        $21(s0, s1);
+        s0 = l0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 40 | 0) >> 2];
+        s2 = 1;
+        s1 = s1 + s2 | 0;
+        HEAP32[(s0 + 40 | 0) >> 2] = s1;
+        s0 = l0;
+        s1 = 1;
+        s0 = $35(s0, s1) | 0;
+        l2 = s0;
+        s1 = 44;
+        s0 = (s0 | 0) == (s1 | 0) | 0;
+        if (s0) { break label$13; }
+        s0 = l2;
+        s1 = 125;
+        s0 = (s0 | 0) == (s1 | 0) | 0;
+        if (s0) { break label$12; }
+        s0 = l0;
+        s0 = HEAP32[(s0 + 40 | 0) >> 2];
+        l2 = s0;
+        s1 = l0;
+        s1 = HEAP32[(s1 + 80 | 0) >> 2];
+        s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+        if (s0) { break label$5; }
+        s0 = l0;
+        s1 = l2;
+        HEAP32[(s0 + 80 | 0) >> 2] = s1;
+        break label$5;
+       }
+       s0 = l0;
+       s0 = HEAP32[(s0 + 40 | 0) >> 2];
+       l2 = s0;
+       s1 = l0;
+       s1 = HEAP32[(s1 + 80 | 0) >> 2];
+       s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+       if (s0) { break label$5; }
+       s0 = l0;
+       s1 = l2;
+       HEAP32[(s0 + 80 | 0) >> 2] = s1;
+       break label$5;
+      }
+      s0 = l0;
+      s1 = l0;
+      s1 = HEAP32[(s1 + 40 | 0) >> 2];
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 40 | 0) >> 2] = s1;
+      s0 = l0;
+      s1 = 1;
+      s0 = $35(s0, s1) | 0;
+      s1 = 125;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$12; }
+      s0 = l0;
+      s0 = HEAP32[(s0 + 40 | 0) >> 2];
+      l2 = s0;
+      continue label$7;
+     }
+     break label$7;
+    }
+    s0 = l1;
+    s1 = l4;
+    HEAP32[(s0 + 16 | 0) >> 2] = s1;
+    s0 = l1;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 40 | 0) >> 2];
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 12 | 0) >> 2] = s1;
+    return;
+   }
+   s0 = l4;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 80 | 0) >> 2];
+   s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+   if (s0) { break label$5; }
+   s0 = l0;
+   s1 = l4;
+   HEAP32[(s0 + 80 | 0) >> 2] = s1;
+  }
+  s0 = l0;
+  s1 = l5;
+  HEAP32[(s0 + 40 | 0) >> 2] = s1;
+ }
+ function $40(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, l4 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0;
+  s0 = global$0;
+  s1 = 16;
+  s0 = s0 - s1 | 0;
+  l1 = s0;
+  global$0 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 44 | 0) >> 2];
+  l2 = s0;
+  s1 = l0;
+  s1 = HEAP32[(s1 + 40 | 0) >> 2];
+  l3 = s1;
+  s0 = s0 - s1 | 0;
+  l4 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     s0 = l2;
+     s1 = l3;
+     s0 = s0 >>> 0 < s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     s0 = l4;
+     s1 = 2;
+     s0 = (s0 | 0) > (s1 | 0) | 0;
+     if (s0) { break label$2; }
+    }
+    s0 = l1;
+    s1 = 0;
+    HEAP32[(s0 + 4 | 0) >> 2] = s1;
+    label$4 : {
+     s0 = l3;
+     s1 = l2;
+     s0 = s0 >>> 0 > s1 >>> 0 | 0;
+     if (s0) { break label$4; }
+     s0 = l1;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     s1 = l3;
+     s2 = l4;
+     s3 = 1;
+     s2 = s2 + s3 | 0;
+     s0 = $63(s0, s1, s2) | 0;
+    }
+    s0 = l1;
+    s1 = 4;
+    s0 = s0 + s1 | 0;
+    s1 = l1;
+    s2 = 12;
+    s1 = s1 + s2 | 0;
+    s2 = l1;
+    s3 = 8;
+    s2 = s2 + s3 | 0;
+    s0 = $46(s0, s1, s2) | 0;
+    l3 = s0;
+    s0 = l0;
+    s1 = 1;
+    HEAP8[s0 + 70 | 0] = s1;
+    s0 = l0;
+    s1 = l0;
+    s1 = HEAP32[(s1 + 40 | 0) >> 2];
+    s2 = l3;
+    s3 = l1;
+    s4 = 4;
+    s3 = s3 + s4 | 0;
+    s2 = s2 - s3 | 0;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 40 | 0) >> 2] = s1;
+    break label$1;
+   }
+   s0 = l0;
+   s1 = l3;
+   s2 = l1;
+   s3 = 12;
+   s2 = s2 + s3 | 0;
+   s3 = l1;
+   s4 = 8;
+   s3 = s3 + s4 | 0;
+   s1 = $46(s1, s2, s3) | 0;
+   HEAP32[(s0 + 40 | 0) >> 2] = s1;
+  }
+  s0 = l1;
+  s0 = HEAP32[(s0 + 12 | 0) >> 2];
+  l0 = s0;
+  s0 = l1;
+  s1 = 16;
+  s0 = s0 + s1 | 0;
+  global$0 = s0;
+  s0 = l0;
+  return s0;
+ }
+ function $41(l0) {
+  var l1 = 0, s0 = 0, s1 = 0, s2 = 0;
+  s0 = 0;
+  l1 = s0;
+  label$1 : {
+   s0 = l0;
+   s1 = 918015;
+   s0 = s0 >>> 0 > s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = 8;
+   s0 = s0 >>> s1 | 0;
+   s1 = 1040;
+   s0 = s0 + s1 | 0;
+   s0 = HEAPU8[s0];
+   s1 = 5;
+   s0 = s0 << s1;
+   s1 = l0;
+   s2 = 3;
+   s1 = s1 >>> s2 | 0;
+   s2 = 28;
+   s1 = s1 & s2;
+   s0 = s0 | s1;
+   s1 = 4640;
+   s0 = s0 + s1 | 0;
+   s0 = HEAP32[s0 >> 2];
+   s1 = l0;
+   s0 = s0 >>> s1 | 0;
+   s1 = 1;
+   s0 = s0 & s1;
+   l1 = s0;
+  }
+  s0 = l1;
+  return s0;
+ }
+ function $42(l0, l1, l2, l3, l4, l5, l6) {
+  var l7 = 0, l8 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  label$1 : {
+   label$2 : while (1) {
+    s0 = l0;
+    l7 = s0;
+    s1 = l1;
+    s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+    if (s0) { break label$1; }
+    s0 = l7;
+    s0 = HEAPU8[s0];
+    l8 = s0;
+    s1 = l6;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    s1 = l8;
+    s2 = l5;
+    s1 = (s1 | 0) == (s2 | 0) | 0;
+    s2 = 1;
+    s1 = s1 << s2;
+    s0 = s0 | s1;
+    s1 = l8;
+    s2 = l4;
+    s1 = (s1 | 0) == (s2 | 0) | 0;
+    s2 = l8;
+    s3 = l2;
+    s2 = (s2 | 0) == (s3 | 0) | 0;
+    s3 = 1;
+    s2 = s2 << s3;
+    s1 = s1 | s2;
+    s2 = 2;
+    s1 = s1 << s2;
+    s0 = s0 | s1;
+    if (s0) { break label$1; }
+    s0 = l7;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l0 = s0;
+    s0 = l8;
+    s1 = l3;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { continue label$2; }
+    break label$2;
+   }
+  }
+  s0 = l7;
+  return s0;
+ }
+ function $43(l0, l1, l2, l2h, l3) {
+  var l4 = 0, l5 = 0, s0 = 0, s0h = 0, s1 = 0, s1h = 0, s2 = 0;
+  s0 = global$0;
+  s1 = 16;
+  s0 = s0 - s1 | 0;
+  l4 = s0;
+  global$0 = s0;
+  s0 = 0;
+  l5 = s0;
+  label$1 : {
+   s0 = l1;
+   s1 = l3;
+   s0 = s0 - s1 | 0;
+   s1 = 1;
+   s0 = s0 + s1 | 0;
+   l1 = s0;
+   s1 = l0;
+   s1 = HEAP32[(s1 + 36 | 0) >> 2];
+   l0 = s1;
+   s0 = s0 >>> 0 < s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l4;
+   s1 = 0; s1h = 0;
+   HEAP32[(s0 + 8 | 0) >> 2] = s1; HEAP32[(s0 + 12 | 0) >> 2] = s1h;
+   s0 = l4;
+   s1 = 8;
+   s0 = s0 + s1 | 0;
+   s1 = l1;
+   s2 = l3;
+   s0 = $63(s0, s1, s2) | 0;
+   s0 = l4;
+   s0h = HEAP32[(s0 + 12 | 0) >> 2]; s0 = HEAP32[(s0 + 8 | 0) >> 2];
+   s1 = l2; s1h = l2h;
+   s0 = (s0 | 0) != (s1 | 0) | (s0h | 0) != (s1h | 0);
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l1;
+   s0 = $20(s0, s1) | 0;
+   l5 = s0;
+  }
+  s0 = l4;
+  s1 = 16;
+  s0 = s0 + s1 | 0;
+  global$0 = s0;
+  s0 = l5;
+  return s0;
+ }
+ function $44(l0, l1, l2) {
+  var l3 = 0, s0 = 0, s1 = 0;
+  s0 = 0;
+  l3 = s0;
+  label$1 : {
+   s0 = l0;
+   s0 = HEAP32[(s0 + 36 | 0) >> 2];
+   l0 = s0;
+   s1 = l1;
+   s0 = s0 >>> 0 > s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l1;
+   s0 = HEAPU8[s0];
+   s1 = l2;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l1;
+   s0 = $20(s0, s1) | 0;
+   l3 = s0;
+  }
+  s0 = l3;
+  return s0;
+ }
+ function $45(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 40 | 0) >> 2];
+  l1 = s0;
+  s0 = l0;
+  s0 = HEAP32[(s0 + 44 | 0) >> 2];
+  l2 = s0;
+  label$1 : {
+   label$2 : {
+    label$3 : while (1) {
+     s0 = l0;
+     s1 = l1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     l3 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     s0 = l1;
+     s1 = l2;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$2; }
+     s0 = l0;
+     s1 = l3;
+     s2 = l2;
+     s3 = 93;
+     s4 = 92;
+     s5 = 10;
+     s6 = 13;
+     s7 = 93;
+     s1 = $42(s1, s2, s3, s4, s5, s6, s7) | 0;
+     l1 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     label$4 : {
+      label$5 : {
+       s0 = l1;
+       s0 = HEAPU8[s0];
+       l3 = s0;
+       s1 = -92;
+       s0 = s0 + s1 | 0;
+       switch (s0) {
+        case 0:
+         break label$4;
+        case 1:
+         break label$1;
+        default:
+         break label$5;
+       }
+      }
+      s0 = l3;
+      s1 = -10;
+      s0 = s0 + s1 | 0;
+      switch (s0) {
+       case 0: case 3:
+        break label$2;
+       default:
+        continue label$3;
+      }
+     }
+     s0 = l0;
+     s1 = l1;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     l1 = s1;
+     HEAP32[(s0 + 40 | 0) >> 2] = s1;
+     continue label$3;
+    }
+   }
+   s0 = l0;
+   $5(s0);
+   s0 = 0;
+   l3 = s0;
+  }
+  s0 = l3;
+  return s0;
+ }
+ function $46(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, l6 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  s0 = l1;
+  s1 = l0;
+  s1 = HEAPU8[s1];
+  l3 = s1;
+  s2 = 3;
+  s1 = s1 >>> s2 | 0;
+  l4 = s1;
+  s2 = 8800;
+  s1 = s1 + s2 | 0;
+  s1 = HEAP8[s1];
+  l5 = s1;
+  s2 = 2;
+  s1 = s1 << s2;
+  l6 = s1;
+  s2 = 8832;
+  s1 = s1 + s2 | 0;
+  s1 = HEAP32[s1 >> 2];
+  s2 = l3;
+  s1 = s1 & s2;
+  s2 = 18;
+  s1 = s1 << s2;
+  l3 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l1;
+  s1 = l0;
+  s1 = HEAPU8[s1 + 1 | 0];
+  s2 = 63;
+  s1 = s1 & s2;
+  s2 = 12;
+  s1 = s1 << s2;
+  s2 = l3;
+  s1 = s1 | s2;
+  l3 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l1;
+  s1 = l0;
+  s1 = HEAPU8[s1 + 2 | 0];
+  s2 = 63;
+  s1 = s1 & s2;
+  s2 = 6;
+  s1 = s1 << s2;
+  s2 = l3;
+  s1 = s1 | s2;
+  l3 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l1;
+  s1 = l3;
+  s2 = l0;
+  s2 = HEAPU8[s2 + 3 | 0];
+  s3 = 63;
+  s2 = s2 & s3;
+  s1 = s1 | s2;
+  s2 = l6;
+  s3 = 8896;
+  s2 = s2 + s3 | 0;
+  s2 = HEAP32[s2 >> 2];
+  s1 = s1 >>> s2 | 0;
+  l3 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l2;
+  s1 = l3;
+  s2 = l6;
+  s3 = 8864;
+  s2 = s2 + s3 | 0;
+  s2 = HEAP32[s2 >> 2];
+  s1 = s1 >>> 0 < s2 >>> 0 | 0;
+  s2 = 6;
+  s1 = s1 << s2;
+  l3 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l2;
+  s1 = l1;
+  s1 = HEAP32[s1 >> 2];
+  s2 = -2048;
+  s1 = s1 & s2;
+  s2 = 55296;
+  s1 = (s1 | 0) == (s2 | 0) | 0;
+  s2 = 7;
+  s1 = s1 << s2;
+  s2 = l3;
+  s1 = s1 | s2;
+  l3 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l2;
+  s1 = l3;
+  s2 = l1;
+  s2 = HEAP32[s2 >> 2];
+  s3 = 1114111;
+  s2 = s2 >>> 0 > s3 >>> 0 | 0;
+  s3 = 8;
+  s2 = s2 << s3;
+  s1 = s1 | s2;
+  l1 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l2;
+  s1 = l1;
+  s2 = l0;
+  s2 = HEAPU8[s2 + 1 | 0];
+  s3 = 2;
+  s2 = s2 >>> s3 | 0;
+  s3 = 48;
+  s2 = s2 & s3;
+  s1 = s1 | s2;
+  l1 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l2;
+  s1 = l1;
+  s2 = l0;
+  s2 = HEAPU8[s2 + 2 | 0];
+  s3 = 4;
+  s2 = s2 >>> s3 | 0;
+  s3 = 12;
+  s2 = s2 & s3;
+  s1 = s1 | s2;
+  l1 = s1;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l2;
+  s1 = l1;
+  s2 = l0;
+  s2 = HEAPU8[s2 + 3 | 0];
+  s3 = 6;
+  s2 = s2 >>> s3 | 0;
+  s1 = s1 | s2;
+  s2 = 42;
+  s1 = s1 ^ s2;
+  s2 = l6;
+  s3 = 8928;
+  s2 = s2 + s3 | 0;
+  s2 = HEAP32[s2 >> 2];
+  s1 = s1 >> s2;
+  HEAP32[s0 >> 2] = s1;
+  s0 = l0;
+  s1 = l5;
+  s0 = s0 + s1 | 0;
+  s1 = -2130771968;
+  s2 = l4;
+  s1 = s1 >>> s2 | 0;
+  s2 = 1;
+  s1 = s1 & s2;
+  s0 = s0 + s1 | 0;
+  return s0;
+ }
+ function $47(l0, l1, l2, l3) {
+  var l4 = 0, l5 = 0, l6 = 0, l7 = 0, l8 = 0, l9 = 0, l10 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, s8 = 0;
+  s0 = global$0;
+  s1 = 16;
+  s0 = s0 - s1 | 0;
+  l4 = s0;
+  global$0 = s0;
+  s0 = 13;
+  s1 = 92;
+  s2 = l2;
+  s0 = s2 ? s0 : s1;
+  l5 = s0;
+  s0 = l3;
+  l6 = s0;
+  label$1 : while (1) {
+   s0 = l6;
+   s1 = l0;
+   s2 = l0;
+   s3 = l1;
+   s4 = 92;
+   s5 = l5;
+   s6 = 92;
+   s7 = 92;
+   s8 = 92;
+   s2 = $42(s2, s3, s4, s5, s6, s7, s8) | 0;
+   l7 = s2;
+   s3 = l0;
+   s2 = s2 - s3 | 0;
+   l8 = s2;
+   s0 = $64(s0, s1, s2) | 0;
+   s1 = l8;
+   s0 = s0 + s1 | 0;
+   l6 = s0;
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       label$6 : {
+        label$7 : {
+         label$8 : {
+          label$9 : {
+           s0 = l7;
+           s1 = l1;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$9; }
+           s0 = l4;
+           s1 = l7;
+           s2 = 1;
+           s1 = s1 + s2 | 0;
+           l0 = s1;
+           HEAP32[(s0 + 12 | 0) >> 2] = s1;
+           label$10 : {
+            s0 = l7;
+            s0 = HEAPU8[s0];
+            s1 = 13;
+            s0 = (s0 | 0) != (s1 | 0) | 0;
+            if (s0) { break label$10; }
+            s0 = l0;
+            s1 = l1;
+            s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+            if (s0) { break label$3; }
+            s0 = l0;
+            s0 = HEAPU8[s0];
+            s1 = 10;
+            s0 = (s0 | 0) != (s1 | 0) | 0;
+            if (s0) { break label$3; }
+            s0 = l4;
+            s1 = l7;
+            s2 = 2;
+            s1 = s1 + s2 | 0;
+            HEAP32[(s0 + 12 | 0) >> 2] = s1;
+            break label$3;
+           }
+           s0 = -1;
+           l9 = s0;
+           s0 = l0;
+           s1 = l1;
+           s0 = (s0 | 0) == (s1 | 0) | 0;
+           if (s0) { break label$8; }
+           s0 = l4;
+           s1 = l7;
+           s2 = 2;
+           s1 = s1 + s2 | 0;
+           l8 = s1;
+           HEAP32[(s0 + 12 | 0) >> 2] = s1;
+           label$11 : {
+            label$12 : {
+             label$13 : {
+              label$14 : {
+               label$15 : {
+                label$16 : {
+                 s0 = l7;
+                 s0 = HEAPU8[s0 + 1 | 0];
+                 l10 = s0;
+                 s1 = -48;
+                 s0 = s0 + s1 | 0;
+                 l0 = s0;
+                 switch (s0) {
+                  case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7:
+                   break label$15;
+                  case 8: case 9:
+                   break label$12;
+                  default:
+                   break label$16;
+                 }
+                }
+                label$17 : {
+                 label$18 : {
+                  label$19 : {
+                   label$20 : {
+                    label$21 : {
+                     label$22 : {
+                      label$23 : {
+                       label$24 : {
+                        label$25 : {
+                         label$26 : {
+                          s0 = l10;
+                          s1 = -110;
+                          s0 = s0 + s1 | 0;
+                          switch (s0) {
+                           case 0:
+                            break label$3;
+                           case 1: case 2: case 3: case 5: case 9:
+                            break label$11;
+                           case 4:
+                            break label$25;
+                           case 6:
+                            break label$24;
+                           case 7:
+                            break label$17;
+                           case 8:
+                            break label$22;
+                           case 10:
+                            break label$18;
+                           default:
+                            break label$26;
+                          }
+                         }
+                         label$27 : {
+                          s0 = l10;
+                          s1 = -10;
+                          s0 = s0 + s1 | 0;
+                          switch (s0) {
+                           case 0:
+                            break label$2;
+                           case 1: case 2:
+                            break label$11;
+                           case 3:
+                            break label$20;
+                           default:
+                            break label$27;
+                          }
+                         }
+                         s0 = l10;
+                         s1 = -98;
+                         s0 = s0 + s1 | 0;
+                         switch (s0) {
+                          case 0:
+                           break label$23;
+                          case 1: case 2: case 3:
+                           break label$11;
+                          case 4:
+                           break label$21;
+                          default:
+                           break label$19;
+                         }
+                        }
+                        s0 = l6;
+                        s1 = 13;
+                        HEAP8[s0] = s1;
+                        s0 = l6;
+                        s1 = 1;
+                        s0 = s0 + s1 | 0;
+                        l6 = s0;
+                        break label$2;
+                       }
+                       s0 = l6;
+                       s1 = 9;
+                       HEAP8[s0] = s1;
+                       s0 = l6;
+                       s1 = 1;
+                       s0 = s0 + s1 | 0;
+                       l6 = s0;
+                       break label$2;
+                      }
+                      s0 = l6;
+                      s1 = 8;
+                      HEAP8[s0] = s1;
+                      s0 = l6;
+                      s1 = 1;
+                      s0 = s0 + s1 | 0;
+                      l6 = s0;
+                      break label$2;
+                     }
+                     s0 = l6;
+                     s1 = 11;
+                     HEAP8[s0] = s1;
+                     s0 = l6;
+                     s1 = 1;
+                     s0 = s0 + s1 | 0;
+                     l6 = s0;
+                     break label$2;
+                    }
+                    s0 = l6;
+                    s1 = 12;
+                    HEAP8[s0] = s1;
+                    s0 = l6;
+                    s1 = 1;
+                    s0 = s0 + s1 | 0;
+                    l6 = s0;
+                    break label$2;
+                   }
+                   s0 = l8;
+                   s1 = l1;
+                   s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                   if (s0) { break label$2; }
+                   s0 = l8;
+                   s0 = HEAPU8[s0];
+                   s1 = 10;
+                   s0 = (s0 | 0) != (s1 | 0) | 0;
+                   if (s0) { break label$2; }
+                   s0 = l4;
+                   s1 = l7;
+                   s2 = 3;
+                   s1 = s1 + s2 | 0;
+                   HEAP32[(s0 + 12 | 0) >> 2] = s1;
+                   break label$2;
+                  }
+                  s0 = l10;
+                  s1 = 226;
+                  s0 = (s0 | 0) != (s1 | 0) | 0;
+                  if (s0) { break label$11; }
+                  label$28 : {
+                   s0 = l1;
+                   s1 = l8;
+                   s0 = s0 - s1 | 0;
+                   s1 = 2;
+                   s0 = (s0 | 0) < (s1 | 0) | 0;
+                   if (s0) { break label$28; }
+                   s0 = l8;
+                   s0 = HEAPU8[s0];
+                   s1 = 128;
+                   s0 = (s0 | 0) != (s1 | 0) | 0;
+                   if (s0) { break label$28; }
+                   s0 = l7;
+                   s0 = HEAPU8[s0 + 3 | 0];
+                   s1 = 254;
+                   s0 = s0 & s1;
+                   s1 = 168;
+                   s0 = (s0 | 0) != (s1 | 0) | 0;
+                   if (s0) { break label$28; }
+                   s0 = l4;
+                   s1 = l7;
+                   s2 = 4;
+                   s1 = s1 + s2 | 0;
+                   HEAP32[(s0 + 12 | 0) >> 2] = s1;
+                   break label$2;
+                  }
+                  s0 = l6;
+                  s1 = 226;
+                  HEAP8[s0] = s1;
+                  s0 = l6;
+                  s1 = 1;
+                  s0 = s0 + s1 | 0;
+                  l6 = s0;
+                  break label$2;
+                 }
+                 s0 = -1;
+                 l0 = s0;
+                 label$29 : {
+                  s0 = l8;
+                  s1 = l1;
+                  s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                  if (s0) { break label$29; }
+                  s0 = l8;
+                  s0 = HEAPU8[s0];
+                  s0 = $48(s0) | 0;
+                  l0 = s0;
+                 }
+                 s0 = l1;
+                 s1 = l8;
+                 s0 = s0 - s1 | 0;
+                 s1 = 2;
+                 s0 = (s0 | 0) < (s1 | 0) | 0;
+                 if (s0) { break label$8; }
+                 s0 = l7;
+                 s0 = HEAPU8[s0 + 3 | 0];
+                 s0 = $48(s0) | 0;
+                 l8 = s0;
+                 s0 = l0;
+                 s1 = 0;
+                 s0 = (s0 | 0) < (s1 | 0) | 0;
+                 if (s0) { break label$8; }
+                 s0 = l8;
+                 s1 = 0;
+                 s0 = (s0 | 0) < (s1 | 0) | 0;
+                 if (s0) { break label$8; }
+                 s0 = l4;
+                 s1 = l7;
+                 s2 = 4;
+                 s1 = s1 + s2 | 0;
+                 HEAP32[(s0 + 12 | 0) >> 2] = s1;
+                 s0 = l8;
+                 s1 = l0;
+                 s2 = 4;
+                 s1 = s1 << s2;
+                 s0 = s0 + s1 | 0;
+                 l0 = s0;
+                 break label$14;
+                }
+                s0 = l4;
+                s1 = 12;
+                s0 = s0 + s1 | 0;
+                s1 = l1;
+                s2 = l4;
+                s3 = 8;
+                s2 = s2 + s3 | 0;
+                s0 = $49(s0, s1, s2) | 0;
+                s0 = !s0 | 0;
+                if (s0) { break label$8; }
+                s0 = l4;
+                s0 = HEAP32[(s0 + 8 | 0) >> 2];
+                l0 = s0;
+                s1 = -1024;
+                s0 = s0 & s1;
+                s1 = 55296;
+                s0 = (s0 | 0) != (s1 | 0) | 0;
+                if (s0) { break label$13; }
+                s0 = l1;
+                s1 = l4;
+                s1 = HEAP32[(s1 + 12 | 0) >> 2];
+                l7 = s1;
+                s0 = s0 - s1 | 0;
+                s1 = 2;
+                s0 = (s0 | 0) < (s1 | 0) | 0;
+                if (s0) { break label$5; }
+                s0 = l7;
+                s0 = HEAPU8[s0];
+                s1 = 92;
+                s0 = (s0 | 0) != (s1 | 0) | 0;
+                if (s0) { break label$5; }
+                s0 = l7;
+                s0 = HEAPU8[s0 + 1 | 0];
+                s1 = 117;
+                s0 = (s0 | 0) != (s1 | 0) | 0;
+                if (s0) { break label$5; }
+                s0 = l4;
+                s1 = l7;
+                s2 = 2;
+                s1 = s1 + s2 | 0;
+                HEAP32[(s0 + 4 | 0) >> 2] = s1;
+                s0 = l4;
+                s1 = 4;
+                s0 = s0 + s1 | 0;
+                s1 = l1;
+                s2 = l4;
+                s0 = $49(s0, s1, s2) | 0;
+                s0 = !s0 | 0;
+                if (s0) { break label$6; }
+                s0 = l4;
+                s0 = HEAP32[s0 >> 2];
+                l7 = s0;
+                s1 = 56320;
+                s0 = s0 >>> 0 < s1 >>> 0 | 0;
+                if (s0) { break label$6; }
+                s0 = l7;
+                s1 = 57343;
+                s0 = s0 >>> 0 > s1 >>> 0 | 0;
+                if (s0) { break label$6; }
+                s0 = l4;
+                s1 = l4;
+                s1 = HEAP32[(s1 + 4 | 0) >> 2];
+                HEAP32[(s0 + 12 | 0) >> 2] = s1;
+                s0 = l4;
+                s1 = l0;
+                s2 = 10;
+                s1 = s1 << s2;
+                s2 = l7;
+                s1 = s1 + s2 | 0;
+                s2 = -56613888;
+                s1 = s1 + s2 | 0;
+                l0 = s1;
+                HEAP32[(s0 + 8 | 0) >> 2] = s1;
+                break label$6;
+               }
+               label$30 : {
+                s0 = l2;
+                s0 = !s0 | 0;
+                if (s0) { break label$30; }
+                s0 = l0;
+                if (s0) { break label$8; }
+                s0 = 0;
+                l0 = s0;
+                s0 = l8;
+                s1 = l1;
+                s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+                if (s0) { break label$7; }
+                s0 = l8;
+                s0 = HEAPU8[s0];
+                s1 = -48;
+                s0 = s0 + s1 | 0;
+                s1 = 255;
+                s0 = s0 & s1;
+                s1 = 10;
+                s0 = s0 >>> 0 < s1 >>> 0 | 0;
+                if (s0) { break label$8; }
+                break label$7;
+               }
+               s0 = l8;
+               s1 = l1;
+               s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+               if (s0) { break label$7; }
+               s0 = l8;
+               s0 = HEAPU8[s0];
+               l8 = s0;
+               s1 = 248;
+               s0 = s0 & s1;
+               s1 = 48;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$7; }
+               s0 = l4;
+               s1 = l7;
+               s2 = 3;
+               s1 = s1 + s2 | 0;
+               l9 = s1;
+               HEAP32[(s0 + 12 | 0) >> 2] = s1;
+               s0 = l0;
+               s1 = 3;
+               s0 = s0 << s1;
+               s1 = l8;
+               s0 = s0 + s1 | 0;
+               s1 = -48;
+               s0 = s0 + s1 | 0;
+               l0 = s0;
+               s0 = l10;
+               s1 = 51;
+               s0 = s0 >>> 0 > s1 >>> 0 | 0;
+               if (s0) { break label$7; }
+               s0 = l9;
+               s1 = l1;
+               s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+               if (s0) { break label$7; }
+               s0 = l9;
+               s0 = HEAPU8[s0];
+               l8 = s0;
+               s1 = 248;
+               s0 = s0 & s1;
+               s1 = 48;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$7; }
+               s0 = l4;
+               s1 = l7;
+               s2 = 4;
+               s1 = s1 + s2 | 0;
+               HEAP32[(s0 + 12 | 0) >> 2] = s1;
+               s0 = l0;
+               s1 = 3;
+               s0 = s0 << s1;
+               s1 = l8;
+               s0 = s0 + s1 | 0;
+               s1 = -48;
+               s0 = s0 + s1 | 0;
+               l0 = s0;
+              }
+              s0 = l4;
+              s1 = l0;
+              HEAP32[(s0 + 8 | 0) >> 2] = s1;
+             }
+             s0 = l0;
+             s1 = 127;
+             s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+             if (s0) { break label$7; }
+             s0 = l0;
+             s1 = 2047;
+             s0 = s0 >>> 0 > s1 >>> 0 | 0;
+             if (s0) { break label$6; }
+             s0 = l6;
+             s1 = l0;
+             s2 = 63;
+             s1 = s1 & s2;
+             s2 = 128;
+             s1 = s1 | s2;
+             HEAP8[s0 + 1 | 0] = s1;
+             s0 = l6;
+             s1 = l0;
+             s2 = 6;
+             s1 = s1 >>> s2 | 0;
+             s2 = 192;
+             s1 = s1 | s2;
+             HEAP8[s0] = s1;
+             s0 = l6;
+             s1 = 2;
+             s0 = s0 + s1 | 0;
+             l6 = s0;
+             break label$2;
+            }
+            s0 = l2;
+            if (s0) { break label$8; }
+           }
+           s0 = l6;
+           s1 = l10;
+           HEAP8[s0] = s1;
+           s0 = l6;
+           s1 = 1;
+           s0 = s0 + s1 | 0;
+           l6 = s0;
+           break label$2;
+          }
+          s0 = l6;
+          s1 = l3;
+          s0 = s0 - s1 | 0;
+          l9 = s0;
+         }
+         s0 = l4;
+         s1 = 16;
+         s0 = s0 + s1 | 0;
+         global$0 = s0;
+         s0 = l9;
+         return s0;
+        }
+        s0 = l6;
+        s1 = l0;
+        HEAP8[s0] = s1;
+        s0 = l6;
+        s1 = 1;
+        s0 = s0 + s1 | 0;
+        l6 = s0;
+        break label$2;
+       }
+       s0 = l0;
+       s1 = 65535;
+       s0 = s0 >>> 0 > s1 >>> 0 | 0;
+       if (s0) { break label$4; }
+      }
+      s0 = l6;
+      s1 = l0;
+      s2 = 63;
+      s1 = s1 & s2;
+      s2 = 128;
+      s1 = s1 | s2;
+      HEAP8[s0 + 2 | 0] = s1;
+      s0 = l6;
+      s1 = l0;
+      s2 = 12;
+      s1 = s1 >>> s2 | 0;
+      s2 = 224;
+      s1 = s1 | s2;
+      HEAP8[s0] = s1;
+      s0 = l6;
+      s1 = l0;
+      s2 = 6;
+      s1 = s1 >>> s2 | 0;
+      s2 = 63;
+      s1 = s1 & s2;
+      s2 = 128;
+      s1 = s1 | s2;
+      HEAP8[s0 + 1 | 0] = s1;
+      s0 = l6;
+      s1 = 3;
+      s0 = s0 + s1 | 0;
+      l6 = s0;
+      break label$2;
+     }
+     s0 = l6;
+     s1 = l0;
+     s2 = 63;
+     s1 = s1 & s2;
+     s2 = 128;
+     s1 = s1 | s2;
+     HEAP8[s0 + 3 | 0] = s1;
+     s0 = l6;
+     s1 = l0;
+     s2 = 18;
+     s1 = s1 >>> s2 | 0;
+     s2 = 240;
+     s1 = s1 | s2;
+     HEAP8[s0] = s1;
+     s0 = l6;
+     s1 = l0;
+     s2 = 6;
+     s1 = s1 >>> s2 | 0;
+     s2 = 63;
+     s1 = s1 & s2;
+     s2 = 128;
+     s1 = s1 | s2;
+     HEAP8[s0 + 2 | 0] = s1;
+     s0 = l6;
+     s1 = l0;
+     s2 = 12;
+     s1 = s1 >>> s2 | 0;
+     s2 = 63;
+     s1 = s1 & s2;
+     s2 = 128;
+     s1 = s1 | s2;
+     HEAP8[s0 + 1 | 0] = s1;
+     s0 = l6;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     l6 = s0;
+     break label$2;
+    }
+    s0 = l6;
+    s1 = 10;
+    HEAP8[s0] = s1;
+    s0 = l6;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l6 = s0;
+   }
+   s0 = l4;
+   s0 = HEAP32[(s0 + 12 | 0) >> 2];
+   l0 = s0;
+   continue label$1;
+  }
+  return s0;
+ }
+ function $48(l0) {
+  var l1 = 0, s0 = 0, s1 = 0;
+  label$1 : {
+   s0 = l0;
+   s1 = -48;
+   s0 = s0 + s1 | 0;
+   l1 = s0;
+   s1 = 255;
+   s0 = s0 & s1;
+   s1 = 9;
+   s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = -1;
+   l1 = s0;
+   s0 = l0;
+   s1 = 32;
+   s0 = s0 | s1;
+   l0 = s0;
+   s1 = -97;
+   s0 = s0 + s1 | 0;
+   s1 = 255;
+   s0 = s0 & s1;
+   s1 = 5;
+   s0 = s0 >>> 0 > s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = -87;
+   s0 = s0 + s1 | 0;
+   l1 = s0;
+  }
+  s0 = l1;
+  return s0;
+ }
+ function $49(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, l6 = 0, l7 = 0, l8 = 0, l9 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      s0 = l0;
+      s0 = HEAP32[s0 >> 2];
+      l3 = s0;
+      s1 = l1;
+      s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+      if (s0) { break label$4; }
+      s0 = l3;
+      s0 = HEAPU8[s0];
+      s1 = 123;
+      s0 = (s0 | 0) != (s1 | 0) | 0;
+      if (s0) { break label$4; }
+      s0 = l1;
+      s1 = l3;
+      s0 = s0 - s1 | 0;
+      l4 = s0;
+      s0 = 0;
+      l5 = s0;
+      s0 = 1;
+      l6 = s0;
+      label$5 : while (1) {
+       label$6 : {
+        s0 = l4;
+        s1 = l6;
+        s0 = (s0 | 0) != (s1 | 0) | 0;
+        if (s0) { break label$6; }
+        s0 = l4;
+        l6 = s0;
+        s0 = l1;
+        l7 = s0;
+        break label$3;
+       }
+       s0 = l3;
+       s1 = l6;
+       s0 = s0 + s1 | 0;
+       l7 = s0;
+       s0 = HEAPU8[s0];
+       l8 = s0;
+       s1 = 125;
+       s0 = (s0 | 0) == (s1 | 0) | 0;
+       if (s0) { break label$3; }
+       s0 = 0;
+       l9 = s0;
+       s0 = l8;
+       s0 = $48(s0) | 0;
+       l8 = s0;
+       s1 = 0;
+       s0 = (s0 | 0) < (s1 | 0) | 0;
+       if (s0) { break label$1; }
+       s0 = l8;
+       s1 = l5;
+       s2 = 4;
+       s1 = s1 << s2;
+       s0 = s0 + s1 | 0;
+       l7 = s0;
+       s1 = 1114111;
+       s0 = s0 >>> 0 > s1 >>> 0 | 0;
+       if (s0) { break label$1; }
+       s0 = l5;
+       s1 = l7;
+       s2 = l8;
+       s3 = 0;
+       s2 = (s2 | 0) < (s3 | 0) | 0;
+       s0 = s2 ? s0 : s1;
+       l5 = s0;
+       s0 = l6;
+       s1 = 1;
+       s0 = s0 + s1 | 0;
+       l6 = s0;
+       continue label$5;
+      }
+     }
+     s0 = 0;
+     l9 = s0;
+     s0 = l1;
+     s1 = l3;
+     s0 = s0 - s1 | 0;
+     s1 = 4;
+     s0 = (s0 | 0) < (s1 | 0) | 0;
+     if (s0) { break label$1; }
+     s0 = l3;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     l7 = s0;
+     s0 = 0;
+     l5 = s0;
+     s0 = 0;
+     l6 = s0;
+     label$7 : while (1) {
+      s0 = l6;
+      s1 = 4;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$2; }
+      s0 = 0;
+      l9 = s0;
+      s0 = l3;
+      s1 = l6;
+      s0 = s0 + s1 | 0;
+      s0 = HEAPU8[s0];
+      s0 = $48(s0) | 0;
+      l8 = s0;
+      s1 = 0;
+      s0 = (s0 | 0) < (s1 | 0) | 0;
+      if (s0) { break label$1; }
+      s0 = l6;
+      s1 = 1;
+      s0 = s0 + s1 | 0;
+      l6 = s0;
+      s0 = l8;
+      s1 = l5;
+      s2 = 4;
+      s1 = s1 << s2;
+      s0 = s0 + s1 | 0;
+      l5 = s0;
+      continue label$7;
+     }
+    }
+    s0 = 0;
+    l9 = s0;
+    s0 = l6;
+    s1 = 1;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$1; }
+    s0 = l7;
+    s1 = l1;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$1; }
+    s0 = l7;
+    s1 = l6;
+    s2 = 1;
+    s1 = (s1 | 0) != (s2 | 0) | 0;
+    s2 = l7;
+    s3 = l1;
+    s2 = (s2 | 0) != (s3 | 0) | 0;
+    s1 = s1 & s2;
+    s0 = s0 + s1 | 0;
+    l7 = s0;
+   }
+   s0 = l2;
+   s1 = l5;
+   HEAP32[s0 >> 2] = s1;
+   s0 = l0;
+   s1 = l7;
+   HEAP32[s0 >> 2] = s1;
+   s0 = 1;
+   l9 = s0;
+  }
+  s0 = l9;
+  return s0;
+ }
+ function $50(l0) {
+  var s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  s0 = 8960;
+  s1 = 8964;
+  s2 = l0;
+  s3 = 1;
+  s2 = s2 + s3 | 0;
+  s0 = $51(s0, s1, s2) | 0;
+  l0 = s0;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8960 | 0) >> 2];
+  s1 = 0;
+  s2 = l0;
+  s0 = s2 ? s0 : s1;
+  return s0;
+ }
+ function $51(l0, l1, l2) {
+  var l3 = 0, s0 = 0, s1 = 0;
+  s0 = 1;
+  l3 = s0;
+  label$1 : {
+   s0 = l1;
+   s0 = HEAP32[s0 >> 2];
+   s1 = l2;
+   s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   label$2 : {
+    s0 = l0;
+    s0 = HEAP32[s0 >> 2];
+    s1 = l2;
+    s0 = $69(s0, s1) | 0;
+    l3 = s0;
+    s0 = !s0 | 0;
+    if (s0) { break label$2; }
+    s0 = l1;
+    s1 = l2;
+    HEAP32[s0 >> 2] = s1;
+    s0 = l0;
+    s1 = l3;
+    HEAP32[s0 >> 2] = s1;
+   }
+   s0 = l3;
+   s1 = 0;
+   s0 = (s0 | 0) != (s1 | 0) | 0;
+   l3 = s0;
+  }
+  s0 = l3;
+  return s0;
+ }
+ function $52(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, l6 = 0, l7 = 0, l8 = 0, l9 = 0, l10 = 0, l11 = 0, l12 = 0, l13 = 0, s0 = 0, s0h = 0, s1 = 0, s1h = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0;
+  s0 = global$0;
+  s1 = 48;
+  s0 = s0 - s1 | 0;
+  l3 = s0;
+  global$0 = s0;
+  label$1 : {
+   s0 = 0;
+   s0 = HEAP32[(s0 + 8968 | 0) >> 2];
+   l4 = s0;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   label$2 : {
+    s0 = l4;
+    s0 = HEAP32[s0 >> 2];
+    s0 = !s0 | 0;
+    if (s0) { break label$2; }
+    s0 = 0;
+    l5 = s0;
+    s0 = l4;
+    l6 = s0;
+    label$3 : while (1) {
+     label$4 : {
+      s0 = l6;
+      if (s0) { break label$4; }
+      label$5 : {
+       label$6 : while (1) {
+        s0 = l4;
+        s0 = !s0 | 0;
+        if (s0) { break label$5; }
+        s0 = l4;
+        s0 = HEAP32[s0 >> 2];
+        l6 = s0;
+        s0 = l4;
+        $68(s0);
+        s0 = 0;
+        s1 = l6;
+        HEAP32[(s0 + 8968 | 0) >> 2] = s1;
+        s0 = l6;
+        l4 = s0;
+        continue label$6;
+       }
+      }
+      s0 = l5;
+      s1 = 8968;
+      s0 = $53(s0, s1) | 0;
+      s0 = !s0 | 0;
+      if (s0) { break label$1; }
+      s0 = 0;
+      s0 = HEAP32[(s0 + 8968 | 0) >> 2];
+      l4 = s0;
+      break label$2;
+     }
+     s0 = l6;
+     s0 = HEAP32[(s0 + 4 | 0) >> 2];
+     s1 = l5;
+     s0 = s0 + s1 | 0;
+     l5 = s0;
+     s0 = l6;
+     s0 = HEAP32[s0 >> 2];
+     l6 = s0;
+     continue label$3;
+    }
+   }
+   s0 = l4;
+   s1 = 0;
+   HEAP32[(s0 + 8 | 0) >> 2] = s1;
+  }
+  s0 = 0;
+  s1 = 1;
+  HEAP32[(s0 + 8972 | 0) >> 2] = s1;
+  s0 = 0;
+  s1 = 0;
+  HEAP32[(s0 + 8976 | 0) >> 2] = s1;
+  s0 = l3;
+  s1 = 32;
+  s0 = s0 + s1 | 0;
+  s1 = 0; s1h = 0;
+  HEAP32[s0 >> 2] = s1; HEAP32[(s0 + 4 | 0) >> 2] = s1h;
+  s0 = l3;
+  s1 = 16;
+  s0 = s0 + s1 | 0;
+  s1 = 8;
+  s0 = s0 + s1 | 0;
+  s1 = 0; s1h = 0;
+  HEAP32[s0 >> 2] = s1; HEAP32[(s0 + 4 | 0) >> 2] = s1h;
+  s0 = l3;
+  s1 = 0; s1h = 0;
+  HEAP32[(s0 + 16 | 0) >> 2] = s1; HEAP32[(s0 + 20 | 0) >> 2] = s1h;
+  s0 = l3;
+  s1 = 0;
+  HEAP32[(s0 + 12 | 0) >> 2] = s1;
+  s0 = l3;
+  s1 = 8;
+  s2 = 0;
+  s3 = l1;
+  s1 = s3 ? s1 : s2;
+  HEAP32[(s0 + 8 | 0) >> 2] = s1;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8960 | 0) >> 2];
+  s1 = l0;
+  s2 = 1;
+  s3 = 8968;
+  s4 = l3;
+  s5 = 16;
+  s4 = s4 + s5 | 0;
+  s5 = l3;
+  s6 = 8;
+  s5 = s5 + s6 | 0;
+  s0 = $8(s0, s1, s2, s3, s4, s5) | 0;
+  l7 = s0;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8960 | 0) >> 2];
+  l5 = s0;
+  s1 = l0;
+  s0 = s0 + s1 | 0;
+  l1 = s0;
+  s0 = l0;
+  l6 = s0;
+  s0 = l5;
+  l4 = s0;
+  label$7 : {
+   label$8 : {
+    label$9 : {
+     label$10 : {
+      label$11 : while (1) {
+       label$12 : {
+        s0 = l6;
+        s1 = 7;
+        s0 = (s0 | 0) > (s1 | 0) | 0;
+        if (s0) { break label$12; }
+        label$13 : while (1) {
+         label$14 : {
+          s0 = l4;
+          s1 = l1;
+          s0 = s0 >>> 0 < s1 >>> 0 | 0;
+          if (s0) { break label$14; }
+          s0 = 0;
+          l8 = s0;
+          break label$9;
+         }
+         s0 = l4;
+         s0 = HEAP8[s0];
+         l6 = s0;
+         s0 = l4;
+         s1 = 1;
+         s0 = s0 + s1 | 0;
+         l4 = s0;
+         s0 = l6;
+         s1 = -1;
+         s0 = (s0 | 0) > (s1 | 0) | 0;
+         if (s0) { continue label$13; }
+         break label$10;
+        }
+       }
+       s0 = l4;
+       s0h = load32(s0 + 4 | 0); s0 = load32(s0);
+       s1 = -2139062144; s1h = -2139062144;
+       s0 = s0 & s1; s0h = s0h & s1h;
+       s1 = 0; s1h = 0;
+       s0 = (s0 | 0) != (s1 | 0) | (s0h | 0) != (s1h | 0);
+       if (s0) { break label$10; }
+       s0 = l6;
+       s1 = -8;
+       s0 = s0 + s1 | 0;
+       l6 = s0;
+       s0 = l4;
+       s1 = 8;
+       s0 = s0 + s1 | 0;
+       l4 = s0;
+       continue label$11;
+      }
+     }
+     s0 = l3;
+     s1 = l0;
+     s2 = 6;
+     s1 = s1 >>> s2 | 0;
+     l9 = s1;
+     s2 = 2;
+     s1 = s1 << s2;
+     s2 = 4;
+     s1 = s1 + s2 | 0;
+     s2 = 8968;
+     s1 = $53(s1, s2) | 0;
+     l1 = s1;
+     HEAP32[s0 >> 2] = s1;
+     s0 = l1;
+     s0 = !s0 | 0;
+     if (s0) { break label$8; }
+     s0 = 0;
+     l6 = s0;
+     s0 = 0;
+     l4 = s0;
+     label$15 : while (1) {
+      label$16 : {
+       s0 = l0;
+       s1 = l4;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$16; }
+       s0 = l3;
+       l8 = s0;
+       s0 = l0;
+       s1 = 63;
+       s0 = s0 & s1;
+       if (s0) { break label$9; }
+       s0 = l1;
+       s1 = l9;
+       s2 = 2;
+       s1 = s1 << s2;
+       s0 = s0 + s1 | 0;
+       s1 = l6;
+       HEAP32[s0 >> 2] = s1;
+       break label$9;
+      }
+      label$17 : {
+       s0 = l4;
+       s1 = 63;
+       s0 = s0 & s1;
+       if (s0) { break label$17; }
+       s0 = l1;
+       s1 = l4;
+       s2 = 4;
+       s1 = s1 >>> s2 | 0;
+       s2 = 268435452;
+       s1 = s1 & s2;
+       s0 = s0 + s1 | 0;
+       s1 = l6;
+       HEAP32[s0 >> 2] = s1;
+      }
+      s0 = l5;
+      s1 = l4;
+      s0 = s0 + s1 | 0;
+      s0 = HEAPU8[s0];
+      s0 = $54(s0) | 0;
+      s1 = l6;
+      s0 = s0 + s1 | 0;
+      l6 = s0;
+      s0 = l4;
+      s1 = 1;
+      s0 = s0 + s1 | 0;
+      l4 = s0;
+      continue label$15;
+     }
+    }
+    label$18 : {
+     s0 = l7;
+     if (s0) { break label$18; }
+     s0 = l8;
+     s1 = 0;
+     s1 = HEAP32[(s1 + 8960 | 0) >> 2];
+     l1 = s1;
+     s2 = l1;
+     s3 = l3;
+     s3 = HEAP32[(s3 + 24 | 0) >> 2];
+     l4 = s3;
+     s4 = l0;
+     s5 = l4;
+     s6 = l0;
+     s5 = s5 >>> 0 < s6 >>> 0 | 0;
+     s3 = s5 ? s3 : s4;
+     s2 = s2 + s3 | 0;
+     l0 = s2;
+     s0 = $55(s0, s1, s2) | 0;
+     l4 = s0;
+     s0 = 0;
+     s1 = 1;
+     HEAP32[(s0 + 8972 | 0) >> 2] = s1;
+     s0 = 0;
+     s1 = l4;
+     HEAP32[(s0 + 8980 | 0) >> 2] = s1;
+     s0 = 2;
+     l6 = s0;
+     s0 = l1;
+     l4 = s0;
+     label$19 : {
+      label$20 : while (1) {
+       s0 = l4;
+       s1 = 10;
+       s2 = l0;
+       s3 = l4;
+       s2 = s2 - s3 | 0;
+       s0 = $66(s0, s1, s2) | 0;
+       l5 = s0;
+       s0 = !s0 | 0;
+       if (s0) { break label$19; }
+       s0 = 0;
+       s1 = l6;
+       HEAP32[(s0 + 8972 | 0) >> 2] = s1;
+       s0 = l6;
+       s1 = 1;
+       s0 = s0 + s1 | 0;
+       l6 = s0;
+       s0 = l5;
+       s1 = 1;
+       s0 = s0 + s1 | 0;
+       l4 = s0;
+       continue label$20;
+      }
+     }
+     s0 = 0;
+     l6 = s0;
+     s0 = 0;
+     s1 = l8;
+     s2 = l1;
+     s3 = l0;
+     s1 = $55(s1, s2, s3) | 0;
+     s2 = l8;
+     s3 = l1;
+     s4 = l4;
+     s2 = $55(s2, s3, s4) | 0;
+     s1 = s1 - s2 | 0;
+     HEAP32[(s0 + 8976 | 0) >> 2] = s1;
+     break label$7;
+    }
+    s0 = 0;
+    l6 = s0;
+    s0 = 0;
+    s0 = HEAP32[(s0 + 8948 | 0) >> 2];
+    l10 = s0;
+    s0 = 12;
+    l0 = s0;
+    s0 = 4;
+    l5 = s0;
+    s0 = l3;
+    s1 = 16;
+    s0 = s0 + s1 | 0;
+    l4 = s0;
+    s0 = 0;
+    l7 = s0;
+    s0 = 0;
+    l1 = s0;
+    label$21 : while (1) {
+     label$22 : {
+      s0 = l4;
+      s0 = HEAP32[s0 >> 2];
+      l4 = s0;
+      if (s0) { break label$22; }
+      s0 = 0;
+      l9 = s0;
+      s0 = l3;
+      s1 = 16;
+      s0 = s0 + s1 | 0;
+      s1 = 4;
+      s0 = s0 | s1;
+      l11 = s0;
+      l4 = s0;
+      label$23 : while (1) {
+       label$24 : {
+        s0 = l4;
+        s0 = HEAP32[s0 >> 2];
+        l4 = s0;
+        if (s0) { break label$24; }
+        s0 = 8984;
+        s1 = 8988;
+        s2 = l1;
+        s3 = l6;
+        s2 = s2 + s3 | 0;
+        s3 = l1;
+        s4 = l2;
+        s2 = s4 ? s2 : s3;
+        s3 = l3;
+        s3 = HEAP32[(s3 + 36 | 0) >> 2];
+        s2 = s2 + s3 | 0;
+        s3 = l5;
+        s2 = s2 + s3 | 0;
+        s3 = 2;
+        s2 = s2 << s3;
+        s0 = $51(s0, s1, s2) | 0;
+        s0 = !s0 | 0;
+        if (s0) { break label$8; }
+        s0 = 0;
+        s0 = HEAP32[(s0 + 8960 | 0) >> 2];
+        l5 = s0;
+        s0 = 0;
+        s0 = HEAP32[(s0 + 8984 | 0) >> 2];
+        l12 = s0;
+        s1 = l9;
+        HEAP32[(s0 + 8 | 0) >> 2] = s1;
+        s0 = l12;
+        s1 = l7;
+        HEAP32[(s0 + 4 | 0) >> 2] = s1;
+        s0 = l12;
+        s1 = l3;
+        s1 = HEAPU8[s1 + 28 | 0];
+        HEAP32[s0 >> 2] = s1;
+        s0 = l3;
+        s1 = l12;
+        s2 = l6;
+        s3 = 0;
+        s4 = l2;
+        s2 = s4 ? s2 : s3;
+        s3 = 2;
+        s2 = s2 << s3;
+        s1 = s1 + s2 | 0;
+        s2 = l0;
+        s1 = s1 + s2 | 0;
+        HEAP32[(s0 + 44 | 0) >> 2] = s1;
+        s0 = l12;
+        s1 = 36;
+        s0 = s0 + s1 | 0;
+        l6 = s0;
+        s0 = l12;
+        s1 = l0;
+        s0 = s0 + s1 | 0;
+        l0 = s0;
+        s0 = l3;
+        s1 = 16;
+        s0 = s0 + s1 | 0;
+        l4 = s0;
+        label$25 : {
+         label$26 : while (1) {
+          label$27 : {
+           s0 = l4;
+           s0 = HEAP32[s0 >> 2];
+           l4 = s0;
+           if (s0) { break label$27; }
+           s0 = l6;
+           s1 = -24;
+           s0 = s0 + s1 | 0;
+           l6 = s0;
+           label$28 : {
+            label$29 : while (1) {
+             s0 = l11;
+             s0 = HEAP32[s0 >> 2];
+             l4 = s0;
+             s0 = !s0 | 0;
+             if (s0) { break label$28; }
+             s0 = l6;
+             s1 = l8;
+             s2 = l5;
+             s3 = l4;
+             s3 = HEAP32[s3 >> 2];
+             l13 = s3;
+             s1 = $55(s1, s2, s3) | 0;
+             HEAP32[s0 >> 2] = s1;
+             s0 = l6;
+             s1 = 4;
+             s0 = s0 + s1 | 0;
+             s1 = l8;
+             s2 = l5;
+             s3 = l4;
+             s3 = HEAP32[(s3 + 4 | 0) >> 2];
+             l10 = s3;
+             s1 = $55(s1, s2, s3) | 0;
+             HEAP32[s0 >> 2] = s1;
+             s0 = l6;
+             s1 = 8;
+             s0 = s0 + s1 | 0;
+             s1 = l8;
+             s2 = l5;
+             s3 = l4;
+             s3 = HEAP32[(s3 + 8 | 0) >> 2];
+             l1 = s3;
+             s1 = $56(s1, s2, s3) | 0;
+             HEAP32[s0 >> 2] = s1;
+             s0 = l6;
+             s1 = 12;
+             s0 = s0 + s1 | 0;
+             s1 = l8;
+             s2 = l5;
+             s3 = l4;
+             s3 = HEAP32[(s3 + 12 | 0) >> 2];
+             s1 = $56(s1, s2, s3) | 0;
+             HEAP32[s0 >> 2] = s1;
+             s0 = 0;
+             l7 = s0;
+             label$30 : {
+              label$31 : {
+               s0 = l10;
+               s1 = l13;
+               s0 = s0 - s1 | 0;
+               s1 = 2;
+               s0 = (s0 | 0) >= (s1 | 0) | 0;
+               if (s0) { break label$31; }
+               s0 = 0;
+               l9 = s0;
+               break label$30;
+              }
+              label$32 : {
+               s0 = l13;
+               s0 = HEAPU8[s0];
+               l11 = s0;
+               s1 = 39;
+               s0 = (s0 | 0) == (s1 | 0) | 0;
+               if (s0) { break label$32; }
+               s0 = 0;
+               l9 = s0;
+               s0 = l11;
+               s1 = 34;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$30; }
+              }
+              s0 = l13;
+              s1 = 1;
+              s0 = s0 + s1 | 0;
+              s1 = l10;
+              s2 = -1;
+              s1 = s1 + s2 | 0;
+              s2 = 0;
+              s3 = l4;
+              s3 = HEAPU8[s3 + 16 | 0];
+              s4 = l3;
+              s5 = 44;
+              s4 = s4 + s5 | 0;
+              s0 = $57(s0, s1, s2, s3, s4) | 0;
+              l9 = s0;
+              s0 = l4;
+              s0 = HEAP32[(s0 + 8 | 0) >> 2];
+              l1 = s0;
+             }
+             label$33 : {
+              s0 = l1;
+              s0 = !s0 | 0;
+              if (s0) { break label$33; }
+              s0 = l4;
+              s0 = HEAP32[(s0 + 12 | 0) >> 2];
+              l13 = s0;
+              s1 = l1;
+              s0 = s0 - s1 | 0;
+              s1 = 2;
+              s0 = (s0 | 0) < (s1 | 0) | 0;
+              if (s0) { break label$33; }
+              label$34 : {
+               s0 = l1;
+               s0 = HEAPU8[s0];
+               l10 = s0;
+               s1 = 39;
+               s0 = (s0 | 0) == (s1 | 0) | 0;
+               if (s0) { break label$34; }
+               s0 = l10;
+               s1 = 34;
+               s0 = (s0 | 0) != (s1 | 0) | 0;
+               if (s0) { break label$33; }
+              }
+              s0 = l1;
+              s1 = 1;
+              s0 = s0 + s1 | 0;
+              s1 = l13;
+              s2 = -1;
+              s1 = s1 + s2 | 0;
+              s2 = 0;
+              s3 = l4;
+              s3 = HEAPU8[s3 + 17 | 0];
+              s4 = l3;
+              s5 = 44;
+              s4 = s4 + s5 | 0;
+              s0 = $57(s0, s1, s2, s3, s4) | 0;
+              l7 = s0;
+             }
+             s0 = l9;
+             s1 = 0;
+             s0 = (s0 | 0) < (s1 | 0) | 0;
+             if (s0) { break label$25; }
+             s0 = l7;
+             s1 = 0;
+             s0 = (s0 | 0) < (s1 | 0) | 0;
+             if (s0) { break label$25; }
+             s0 = l6;
+             s1 = 16;
+             s0 = s0 + s1 | 0;
+             s1 = l7;
+             s2 = 2;
+             s1 = s1 << s2;
+             s2 = l9;
+             s1 = s1 | s2;
+             HEAP32[s0 >> 2] = s1;
+             label$35 : {
+              s0 = l2;
+              s0 = !s0 | 0;
+              if (s0) { break label$35; }
+              s0 = l0;
+              s1 = l4;
+              s1 = HEAP32[s1 >> 2];
+              s2 = l5;
+              s1 = s1 - s2 | 0;
+              HEAP32[s0 >> 2] = s1;
+              s0 = l0;
+              s1 = l4;
+              s1 = HEAP32[(s1 + 4 | 0) >> 2];
+              s2 = l5;
+              s1 = s1 - s2 | 0;
+              HEAP32[(s0 + 4 | 0) >> 2] = s1;
+              s0 = l0;
+              s1 = l4;
+              s1 = HEAP32[(s1 + 8 | 0) >> 2];
+              l1 = s1;
+              s2 = l5;
+              s1 = s1 - s2 | 0;
+              s2 = -1;
+              s3 = l1;
+              s1 = s3 ? s1 : s2;
+              HEAP32[(s0 + 8 | 0) >> 2] = s1;
+              s0 = l0;
+              s1 = l4;
+              s1 = HEAP32[(s1 + 12 | 0) >> 2];
+              l1 = s1;
+              s2 = l5;
+              s1 = s1 - s2 | 0;
+              s2 = -1;
+              s3 = l1;
+              s1 = s3 ? s1 : s2;
+              HEAP32[(s0 + 12 | 0) >> 2] = s1;
+              s0 = l0;
+              s1 = 16;
+              s0 = s0 + s1 | 0;
+              l0 = s0;
+             }
+             s0 = l6;
+             s1 = 20;
+             s0 = s0 + s1 | 0;
+             l6 = s0;
+             s0 = l4;
+             s1 = 20;
+             s0 = s0 + s1 | 0;
+             l11 = s0;
+             continue label$29;
+            }
+           }
+           s0 = l12;
+           s1 = l3;
+           s1 = HEAP32[(s1 + 44 | 0) >> 2];
+           l4 = s1;
+           s0 = s0 - s1 | 0;
+           s1 = -4;
+           s0 = s0 + s1 | 0;
+           l1 = s0;
+           s0 = 0;
+           l6 = s0;
+           s0 = l3;
+           s0 = HEAP32[(s0 + 32 | 0) >> 2];
+           l0 = s0;
+           label$36 : {
+            label$37 : while (1) {
+             s0 = l6;
+             s1 = l3;
+             s1 = HEAP32[(s1 + 36 | 0) >> 2];
+             l7 = s1;
+             s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+             if (s0) { break label$36; }
+             s0 = l4;
+             s1 = l8;
+             s2 = l5;
+             s3 = l5;
+             s4 = l0;
+             s4 = HEAP32[s4 >> 2];
+             s3 = s3 + s4 | 0;
+             s1 = $55(s1, s2, s3) | 0;
+             HEAP32[s0 >> 2] = s1;
+             s0 = l0;
+             s1 = 4;
+             s0 = s0 + s1 | 0;
+             l0 = s0;
+             s0 = l1;
+             s1 = -4;
+             s0 = s0 + s1 | 0;
+             l1 = s0;
+             s0 = l6;
+             s1 = 1;
+             s0 = s0 + s1 | 0;
+             l6 = s0;
+             s0 = l4;
+             s1 = 4;
+             s0 = s0 + s1 | 0;
+             l4 = s0;
+             continue label$37;
+            }
+           }
+           s0 = l4;
+           s1 = l7;
+           HEAP32[s0 >> 2] = s1;
+           s0 = 0;
+           s1 = 0;
+           s2 = l1;
+           s1 = s1 - s2 | 0;
+           s2 = 2;
+           s1 = s1 >> s2;
+           HEAP32[(s0 + 8992 | 0) >> 2] = s1;
+           s0 = 1;
+           l6 = s0;
+           s0 = l1;
+           if (s0) { break label$7; }
+           break label$8;
+          }
+          s0 = l6;
+          s1 = -24;
+          s0 = s0 + s1 | 0;
+          s1 = l8;
+          s2 = l5;
+          s3 = l4;
+          s3 = HEAP32[s3 >> 2];
+          l7 = s3;
+          s1 = $55(s1, s2, s3) | 0;
+          HEAP32[s0 >> 2] = s1;
+          s0 = l6;
+          s1 = -20;
+          s0 = s0 + s1 | 0;
+          s1 = l8;
+          s2 = l5;
+          s3 = l4;
+          s3 = HEAP32[(s3 + 4 | 0) >> 2];
+          l10 = s3;
+          s1 = $55(s1, s2, s3) | 0;
+          HEAP32[s0 >> 2] = s1;
+          s0 = l6;
+          s1 = -16;
+          s0 = s0 + s1 | 0;
+          s1 = l8;
+          s2 = l5;
+          s3 = l4;
+          s3 = HEAP32[(s3 + 8 | 0) >> 2];
+          s1 = $55(s1, s2, s3) | 0;
+          HEAP32[s0 >> 2] = s1;
+          s0 = l6;
+          s1 = -12;
+          s0 = s0 + s1 | 0;
+          l9 = s0;
+          label$38 : {
+           label$39 : {
+            s0 = l4;
+            s0 = HEAP32[(s0 + 12 | 0) >> 2];
+            l1 = s0;
+            if (s0) { break label$39; }
+            s0 = 0;
+            l1 = s0;
+            break label$38;
+           }
+           s0 = l8;
+           s1 = l5;
+           s2 = l1;
+           s0 = $55(s0, s1, s2) | 0;
+           l1 = s0;
+          }
+          s0 = l9;
+          s1 = l1;
+          HEAP32[s0 >> 2] = s1;
+          s0 = l6;
+          s1 = -8;
+          s0 = s0 + s1 | 0;
+          l9 = s0;
+          label$40 : {
+           label$41 : {
+            s0 = l4;
+            s0 = HEAP32[(s0 + 20 | 0) >> 2];
+            l1 = s0;
+            s1 = 0;
+            s1 = HEAP32[(s1 + 8948 | 0) >> 2];
+            s0 = (s0 | 0) == (s1 | 0) | 0;
+            l13 = s0;
+            s0 = !s0 | 0;
+            if (s0) { break label$41; }
+            s0 = -1;
+            l1 = s0;
+            break label$40;
+           }
+           label$42 : {
+            s0 = l1;
+            s1 = 0;
+            s1 = HEAP32[(s1 + 8952 | 0) >> 2];
+            s0 = (s0 | 0) != (s1 | 0) | 0;
+            if (s0) { break label$42; }
+            s0 = -2;
+            l1 = s0;
+            break label$40;
+           }
+           s0 = l8;
+           s1 = l5;
+           s2 = l1;
+           s0 = $55(s0, s1, s2) | 0;
+           l1 = s0;
+          }
+          s0 = l9;
+          s1 = l1;
+          HEAP32[s0 >> 2] = s1;
+          s0 = l6;
+          s1 = -4;
+          s0 = s0 + s1 | 0;
+          s1 = l8;
+          s2 = l5;
+          s3 = l4;
+          s3 = HEAP32[(s3 + 16 | 0) >> 2];
+          s1 = $56(s1, s2, s3) | 0;
+          HEAP32[s0 >> 2] = s1;
+          label$43 : {
+           label$44 : {
+            s0 = l4;
+            s0 = HEAPU8[s0 + 24 | 0];
+            if (s0) { break label$44; }
+            s0 = 0;
+            l1 = s0;
+            break label$43;
+           }
+           label$45 : {
+            label$46 : {
+             s0 = l13;
+             if (s0) { break label$46; }
+             s0 = l7;
+             s1 = 1;
+             s0 = s0 + s1 | 0;
+             s1 = l10;
+             s2 = -1;
+             s1 = s1 + s2 | 0;
+             s2 = l7;
+             s2 = HEAPU8[s2];
+             s3 = 96;
+             s2 = (s2 | 0) == (s3 | 0) | 0;
+             s3 = l4;
+             s3 = HEAPU8[s3 + 25 | 0];
+             s4 = l3;
+             s5 = 44;
+             s4 = s4 + s5 | 0;
+             s0 = $57(s0, s1, s2, s3, s4) | 0;
+             l1 = s0;
+             break label$45;
+            }
+            s0 = l7;
+            s1 = l10;
+            s2 = 0;
+            s3 = l4;
+            s3 = HEAPU8[s3 + 25 | 0];
+            s4 = l3;
+            s5 = 44;
+            s4 = s4 + s5 | 0;
+            s0 = $57(s0, s1, s2, s3, s4) | 0;
+            l1 = s0;
+           }
+           s0 = l1;
+           s1 = 0;
+           s0 = (s0 | 0) < (s1 | 0) | 0;
+           if (s0) { break label$25; }
+          }
+          s0 = l6;
+          s1 = l1;
+          HEAP32[s0 >> 2] = s1;
+          label$47 : {
+           s0 = l2;
+           s0 = !s0 | 0;
+           if (s0) { break label$47; }
+           s0 = l0;
+           s1 = l4;
+           s1 = HEAP32[s1 >> 2];
+           s2 = l5;
+           s1 = s1 - s2 | 0;
+           HEAP32[s0 >> 2] = s1;
+           s0 = l0;
+           s1 = l4;
+           s1 = HEAP32[(s1 + 4 | 0) >> 2];
+           s2 = l5;
+           s1 = s1 - s2 | 0;
+           HEAP32[(s0 + 4 | 0) >> 2] = s1;
+           s0 = l0;
+           s1 = 8;
+           s0 = s0 + s1 | 0;
+           l0 = s0;
+          }
+          s0 = l6;
+          s1 = 28;
+          s0 = s0 + s1 | 0;
+          l6 = s0;
+          s0 = l4;
+          s1 = 28;
+          s0 = s0 + s1 | 0;
+          l4 = s0;
+          continue label$26;
+         }
+        }
+        s0 = 0;
+        s1 = 0;
+        HEAP32[(s0 + 8992 | 0) >> 2] = s1;
+        break label$8;
+       }
+       label$48 : {
+        s0 = l4;
+        s0 = HEAPU8[s0 + 16 | 0];
+        s0 = !s0 | 0;
+        if (s0) { break label$48; }
+        s0 = l1;
+        s1 = l4;
+        s1 = HEAP32[s1 >> 2];
+        s2 = -1;
+        s1 = s1 ^ s2;
+        s2 = l4;
+        s2 = HEAP32[(s2 + 4 | 0) >> 2];
+        s1 = s1 + s2 | 0;
+        s2 = 1;
+        s1 = s1 >>> s2 | 0;
+        s0 = s0 + s1 | 0;
+        s1 = 1;
+        s0 = s0 + s1 | 0;
+        l1 = s0;
+       }
+       label$49 : {
+        s0 = l4;
+        s0 = HEAPU8[s0 + 17 | 0];
+        s0 = !s0 | 0;
+        if (s0) { break label$49; }
+        s0 = l1;
+        s1 = l4;
+        s1 = HEAP32[(s1 + 8 | 0) >> 2];
+        s2 = -1;
+        s1 = s1 ^ s2;
+        s2 = l4;
+        s2 = HEAP32[(s2 + 12 | 0) >> 2];
+        s1 = s1 + s2 | 0;
+        s2 = 1;
+        s1 = s1 >>> s2 | 0;
+        s0 = s0 + s1 | 0;
+        s1 = 1;
+        s0 = s0 + s1 | 0;
+        l1 = s0;
+       }
+       s0 = l9;
+       s1 = 1;
+       s0 = s0 + s1 | 0;
+       l9 = s0;
+       s0 = l6;
+       s1 = 4;
+       s0 = s0 + s1 | 0;
+       l6 = s0;
+       s0 = l5;
+       s1 = 5;
+       s0 = s0 + s1 | 0;
+       l5 = s0;
+       s0 = l0;
+       s1 = 20;
+       s0 = s0 + s1 | 0;
+       l0 = s0;
+       s0 = l4;
+       s1 = 20;
+       s0 = s0 + s1 | 0;
+       l4 = s0;
+       continue label$23;
+      }
+     }
+     label$50 : {
+      s0 = l4;
+      s0 = HEAPU8[s0 + 25 | 0];
+      s0 = !s0 | 0;
+      if (s0) { break label$50; }
+      label$51 : {
+       label$52 : {
+        s0 = l4;
+        s0 = HEAPU8[s0 + 24 | 0];
+        s0 = !s0 | 0;
+        if (s0) { break label$52; }
+        s0 = l4;
+        s0 = HEAP32[(s0 + 20 | 0) >> 2];
+        s1 = l10;
+        s0 = (s0 | 0) == (s1 | 0) | 0;
+        if (s0) { break label$52; }
+        s0 = l4;
+        s0 = HEAP32[(s0 + 4 | 0) >> 2];
+        s1 = -1;
+        s0 = s0 + s1 | 0;
+        l9 = s0;
+        s0 = l4;
+        s0 = HEAP32[s0 >> 2];
+        s1 = 1;
+        s0 = s0 + s1 | 0;
+        l13 = s0;
+        break label$51;
+       }
+       s0 = l4;
+       s0 = HEAP32[(s0 + 4 | 0) >> 2];
+       l9 = s0;
+       s0 = l4;
+       s0 = HEAP32[s0 >> 2];
+       l13 = s0;
+      }
+      s0 = l1;
+      s1 = l9;
+      s2 = l13;
+      s1 = s1 - s2 | 0;
+      s2 = 1;
+      s1 = s1 + s2 | 0;
+      s2 = 1;
+      s1 = s1 >>> s2 | 0;
+      s0 = s0 + s1 | 0;
+      s1 = 1;
+      s0 = s0 + s1 | 0;
+      l1 = s0;
+     }
+     s0 = l7;
+     s1 = 1;
+     s0 = s0 + s1 | 0;
+     l7 = s0;
+     s0 = l6;
+     s1 = 2;
+     s0 = s0 + s1 | 0;
+     l6 = s0;
+     s0 = l5;
+     s1 = 7;
+     s0 = s0 + s1 | 0;
+     l5 = s0;
+     s0 = l0;
+     s1 = 28;
+     s0 = s0 + s1 | 0;
+     l0 = s0;
+     s0 = l4;
+     s1 = 28;
+     s0 = s0 + s1 | 0;
+     l4 = s0;
+     continue label$21;
+    }
+   }
+   s0 = 0;
+   l6 = s0;
+   s0 = 0;
+   s1 = 0;
+   HEAP32[(s0 + 8980 | 0) >> 2] = s1;
+  }
+  s0 = l3;
+  s1 = 48;
+  s0 = s0 + s1 | 0;
+  global$0 = s0;
+  s0 = l6;
+  return s0;
+ }
+ function $53(l0, l1) {
+  var l2 = 0, l3 = 0, l4 = 0, l5 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  s0 = l0;
+  s1 = 31;
+  s0 = s0 + s1 | 0;
+  s1 = -32;
+  s0 = s0 & s1;
+  l2 = s0;
+  label$1 : {
+   label$2 : {
+    s0 = l1;
+    s0 = HEAP32[s0 >> 2];
+    l3 = s0;
+    s0 = !s0 | 0;
+    if (s0) { break label$2; }
+    s0 = l3;
+    s0 = HEAP32[(s0 + 4 | 0) >> 2];
+    s1 = l3;
+    s1 = HEAP32[(s1 + 8 | 0) >> 2];
+    l4 = s1;
+    s0 = s0 - s1 | 0;
+    s1 = l2;
+    s0 = s0 >>> 0 < s1 >>> 0 | 0;
+    if (s0) { break label$2; }
+    s0 = l3;
+    l0 = s0;
+    break label$1;
+   }
+   label$3 : {
+    s0 = l2;
+    s1 = 65536;
+    s2 = l2;
+    s3 = 65536;
+    s2 = s2 >>> 0 > s3 >>> 0 | 0;
+    s0 = s2 ? s0 : s1;
+    l5 = s0;
+    s1 = 16;
+    s0 = s0 | s1;
+    s0 = $67(s0) | 0;
+    l0 = s0;
+    if (s0) { break label$3; }
+    s0 = 0;
+    return s0;
+   }
+   s0 = 0;
+   l4 = s0;
+   s0 = l0;
+   s1 = 0;
+   HEAP32[(s0 + 8 | 0) >> 2] = s1;
+   s0 = l0;
+   s1 = l5;
+   HEAP32[(s0 + 4 | 0) >> 2] = s1;
+   s0 = l0;
+   s1 = l3;
+   HEAP32[s0 >> 2] = s1;
+   s0 = l1;
+   s1 = l0;
+   HEAP32[s0 >> 2] = s1;
+  }
+  s0 = l0;
+  s1 = l4;
+  s2 = l2;
+  s1 = s1 + s2 | 0;
+  HEAP32[(s0 + 8 | 0) >> 2] = s1;
+  s0 = l0;
+  s1 = l4;
+  s0 = s0 + s1 | 0;
+  s1 = 16;
+  s0 = s0 + s1 | 0;
+  return s0;
+ }
+ function $54(l0) {
+  var s0 = 0, s1 = 0, s2 = 0;
+  s0 = l0;
+  s1 = 192;
+  s0 = s0 & s1;
+  s1 = 128;
+  s0 = (s0 | 0) != (s1 | 0) | 0;
+  s1 = l0;
+  s2 = 248;
+  s1 = s1 & s2;
+  s2 = 240;
+  s1 = (s1 | 0) == (s2 | 0) | 0;
+  s0 = s0 + s1 | 0;
+  return s0;
+ }
+ function $55(l0, l1, l2) {
+  var l3 = 0, s0 = 0, s1 = 0, s2 = 0;
+  s0 = l2;
+  s1 = l1;
+  s0 = s0 - s1 | 0;
+  l3 = s0;
+  label$1 : {
+   s0 = l0;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   s0 = l3;
+   s1 = -64;
+   s0 = s0 & s1;
+   l2 = s0;
+   s0 = l0;
+   s0 = HEAP32[s0 >> 2];
+   s1 = l3;
+   s2 = 4;
+   s1 = s1 >>> s2 | 0;
+   s2 = 268435452;
+   s1 = s1 & s2;
+   s0 = s0 + s1 | 0;
+   s0 = HEAP32[s0 >> 2];
+   l0 = s0;
+   label$2 : while (1) {
+    label$3 : {
+     s0 = l2;
+     s1 = l3;
+     s0 = s0 >>> 0 < s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     s0 = l0;
+     l3 = s0;
+     break label$1;
+    }
+    s0 = l1;
+    s1 = l2;
+    s0 = s0 + s1 | 0;
+    s0 = HEAPU8[s0];
+    s0 = $54(s0) | 0;
+    s1 = l0;
+    s0 = s0 + s1 | 0;
+    l0 = s0;
+    s0 = l2;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l2 = s0;
+    continue label$2;
+   }
+  }
+  s0 = l3;
+  return s0;
+ }
+ function $56(l0, l1, l2) {
+  var s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   s0 = l2;
+   if (s0) { break label$1; }
+   s0 = -1;
+   return s0;
+  }
+  s0 = l0;
+  s1 = l1;
+  s2 = l2;
+  s0 = $55(s0, s1, s2) | 0;
+  return s0;
+ }
+ function $57(l0, l1, l2, l3, l4) {
+  var l5 = 0, l6 = 0, l7 = 0, l8 = 0, l9 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+  s0 = 1;
+  l5 = s0;
+  label$1 : {
+   s0 = l3;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   label$2 : {
+    s0 = l1;
+    s1 = l0;
+    s0 = s0 - s1 | 0;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    s1 = 8968;
+    s0 = $53(s0, s1) | 0;
+    l3 = s0;
+    if (s0) { break label$2; }
+    s0 = -1;
+    return s0;
+   }
+   label$3 : {
+    s0 = l0;
+    s1 = l1;
+    s2 = l2;
+    s3 = l3;
+    s0 = $47(s0, s1, s2, s3) | 0;
+    l5 = s0;
+    s1 = -1;
+    s0 = (s0 | 0) != (s1 | 0) | 0;
+    if (s0) { break label$3; }
+    s0 = 3;
+    return s0;
+   }
+   s0 = l3;
+   s1 = l5;
+   s0 = s0 + s1 | 0;
+   l6 = s0;
+   s0 = l4;
+   s0 = HEAP32[s0 >> 2];
+   l7 = s0;
+   s1 = 4;
+   s0 = s0 + s1 | 0;
+   l8 = s0;
+   l9 = s0;
+   label$4 : while (1) {
+    label$5 : {
+     label$6 : {
+      s0 = l3;
+      s1 = l6;
+      s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+      if (s0) { break label$6; }
+      s0 = l3;
+      s1 = 1;
+      s0 = s0 + s1 | 0;
+      l1 = s0;
+      s0 = l3;
+      s0 = HEAP8[s0];
+      l3 = s0;
+      s1 = 255;
+      s0 = s0 & s1;
+      l5 = s0;
+      label$7 : {
+       s0 = l3;
+       s1 = 0;
+       s0 = (s0 | 0) < (s1 | 0) | 0;
+       if (s0) { break label$7; }
+       s0 = l9;
+       s1 = l5;
+       HEAP16[s0 >> 1] = s1;
+       s0 = l1;
+       l3 = s0;
+       break label$5;
+      }
+      s0 = 63;
+      s1 = 3;
+      s2 = 2;
+      s3 = 1;
+      s4 = l3;
+      s5 = -33;
+      s4 = s4 >>> 0 > s5 >>> 0 | 0;
+      s2 = s4 ? s2 : s3;
+      s3 = l3;
+      s4 = -17;
+      s3 = s3 >>> 0 > s4 >>> 0 | 0;
+      s1 = s3 ? s1 : s2;
+      l2 = s1;
+      s0 = s0 >>> s1 | 0;
+      s1 = l5;
+      s0 = s0 & s1;
+      l5 = s0;
+      s0 = l3;
+      s1 = 62;
+      s0 = s0 + s1 | 0;
+      s1 = 255;
+      s0 = s0 & s1;
+      s1 = 51;
+      s0 = s0 >>> 0 < s1 >>> 0 | 0;
+      s1 = l6;
+      s2 = l1;
+      s1 = s1 - s2 | 0;
+      s2 = l2;
+      s1 = s1 >>> 0 >= s2 >>> 0 | 0;
+      s0 = s0 & s1;
+      l0 = s0;
+      s0 = 0;
+      l3 = s0;
+      label$8 : while (1) {
+       label$9 : {
+        label$10 : {
+         s0 = l0;
+         s1 = 1;
+         s0 = s0 & s1;
+         l0 = s0;
+         s0 = !s0 | 0;
+         if (s0) { break label$10; }
+         s0 = l3;
+         s1 = l2;
+         s0 = s0 >>> 0 < s1 >>> 0 | 0;
+         if (s0) { break label$9; }
+        }
+        label$11 : {
+         s0 = l0;
+         if (s0) { break label$11; }
+         s0 = l9;
+         s1 = 65533;
+         HEAP16[s0 >> 1] = s1;
+         s0 = l1;
+         l3 = s0;
+         break label$5;
+        }
+        s0 = l1;
+        s1 = l2;
+        s0 = s0 + s1 | 0;
+        l3 = s0;
+        label$12 : {
+         s0 = l5;
+         s1 = 65536;
+         s0 = s0 >>> 0 < s1 >>> 0 | 0;
+         if (s0) { break label$12; }
+         s0 = l9;
+         s1 = l5;
+         s2 = 1023;
+         s1 = s1 & s2;
+         s2 = 56320;
+         s1 = s1 | s2;
+         HEAP16[(s0 + 2 | 0) >> 1] = s1;
+         s0 = l9;
+         s1 = l5;
+         s2 = 16711680;
+         s1 = s1 + s2 | 0;
+         s2 = 10;
+         s1 = s1 >>> s2 | 0;
+         s2 = 55296;
+         s1 = s1 | s2;
+         HEAP16[s0 >> 1] = s1;
+         s0 = l9;
+         s1 = 2;
+         s0 = s0 + s1 | 0;
+         l9 = s0;
+         break label$5;
+        }
+        s0 = l9;
+        s1 = l5;
+        HEAP16[s0 >> 1] = s1;
+        break label$5;
+       }
+       s0 = l1;
+       s1 = l3;
+       s0 = s0 + s1 | 0;
+       s0 = HEAPU8[s0];
+       l0 = s0;
+       s1 = 63;
+       s0 = s0 & s1;
+       s1 = l5;
+       s2 = 6;
+       s1 = s1 << s2;
+       s0 = s0 | s1;
+       l5 = s0;
+       s0 = l3;
+       s1 = 1;
+       s0 = s0 + s1 | 0;
+       l3 = s0;
+       s0 = l0;
+       s1 = 192;
+       s0 = s0 & s1;
+       s1 = 128;
+       s0 = (s0 | 0) == (s1 | 0) | 0;
+       l0 = s0;
+       continue label$8;
+      }
+     }
+     s0 = l7;
+     s1 = l9;
+     s2 = l8;
+     s1 = s1 - s2 | 0;
+     l3 = s1;
+     s2 = 1;
+     s1 = s1 >> s2;
+     HEAP32[s0 >> 2] = s1;
+     s0 = 2;
+     l5 = s0;
+     s0 = l4;
+     s1 = l8;
+     s2 = l3;
+     s3 = 2;
+     s2 = s2 + s3 | 0;
+     s3 = -4;
+     s2 = s2 & s3;
+     s1 = s1 + s2 | 0;
+     HEAP32[s0 >> 2] = s1;
+     break label$1;
+    }
+    s0 = l9;
+    s1 = 2;
+    s0 = s0 + s1 | 0;
+    l9 = s0;
+    continue label$4;
+   }
+  }
+  s0 = l5;
+  return s0;
+ }
+ function $58() {
+  var s0 = 0;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8980 | 0) >> 2];
+  return s0;
+ }
+ function $59() {
+  var s0 = 0;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8972 | 0) >> 2];
+  return s0;
+ }
+ function $60() {
+  var s0 = 0;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8976 | 0) >> 2];
+  return s0;
+ }
+ function $61() {
+  var s0 = 0;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8984 | 0) >> 2];
+  return s0;
+ }
+ function $62() {
+  var s0 = 0;
+  s0 = 0;
+  s0 = HEAP32[(s0 + 8992 | 0) >> 2];
+  return s0;
+ }
+ function $63(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, l6 = 0, l7 = 0, l8 = 0, s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      s0 = l2;
+      s1 = 4;
+      s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+      if (s0) { break label$4; }
+      s0 = l0;
+      l3 = s0;
+      s0 = l1;
+      l4 = s0;
+      break label$3;
+     }
+     s0 = l0;
+     l5 = s0;
+     s0 = l1;
+     l4 = s0;
+     s0 = l0;
+     l3 = s0;
+     label$5 : while (1) {
+      s0 = l1;
+      s1 = l5;
+      s0 = s0 | s1;
+      s1 = 3;
+      s0 = s0 & s1;
+      if (s0) { break label$2; }
+      s0 = l3;
+      s1 = l4;
+      s1 = HEAP32[s1 >> 2];
+      HEAP32[s0 >> 2] = s1;
+      s0 = l5;
+      s1 = 4;
+      s0 = s0 + s1 | 0;
+      l5 = s0;
+      s0 = l1;
+      s1 = 4;
+      s0 = s0 + s1 | 0;
+      l1 = s0;
+      s0 = l4;
+      s1 = 4;
+      s0 = s0 + s1 | 0;
+      l4 = s0;
+      s0 = l3;
+      s1 = 4;
+      s0 = s0 + s1 | 0;
+      l3 = s0;
+      s0 = l2;
+      s1 = -4;
+      s0 = s0 + s1 | 0;
+      l2 = s0;
+      s1 = 3;
+      s0 = s0 >>> 0 > s1 >>> 0 | 0;
+      if (s0) { continue label$5; }
+      break label$5;
+     }
+    }
+    s0 = l2;
+    s0 = !s0 | 0;
+    if (s0) { break label$1; }
+   }
+   label$6 : {
+    label$7 : {
+     s0 = l2;
+     s1 = 4;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$7; }
+     s0 = l4;
+     l1 = s0;
+     s0 = l3;
+     l5 = s0;
+     s0 = l2;
+     l6 = s0;
+     break label$6;
+    }
+    s0 = l2;
+    s1 = 3;
+    s0 = s0 & s1;
+    l6 = s0;
+    s0 = l3;
+    s1 = l2;
+    s2 = -4;
+    s1 = s1 & s2;
+    l7 = s1;
+    s0 = s0 + s1 | 0;
+    l5 = s0;
+    s0 = l4;
+    s1 = l7;
+    s0 = s0 + s1 | 0;
+    l1 = s0;
+    s0 = l7;
+    l8 = s0;
+    label$8 : while (1) {
+     s0 = l3;
+     s1 = l4;
+     s1 = load32(s1);
+     store32(s0, s1);
+     s0 = l4;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     l4 = s0;
+     s0 = l3;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     l3 = s0;
+     s0 = l8;
+     s1 = -4;
+     s0 = s0 + s1 | 0;
+     l8 = s0;
+     if (s0) { continue label$8; }
+     break label$8;
+    }
+    s0 = l2;
+    s1 = l7;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$1; }
+   }
+   label$9 : while (1) {
+    s0 = l5;
+    s1 = l1;
+    s1 = HEAPU8[s1];
+    HEAP8[s0] = s1;
+    s0 = l5;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l5 = s0;
+    s0 = l1;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l1 = s0;
+    s0 = l6;
+    s1 = -1;
+    s0 = s0 + s1 | 0;
+    l6 = s0;
+    if (s0) { continue label$9; }
+    break label$9;
+   }
+  }
+  s0 = l0;
+  return s0;
+ }
+ function $64(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, l6 = 0, l7 = 0, l8 = 0, s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   label$2 : {
+    label$3 : {
+     label$4 : {
+      label$5 : {
+       s0 = l0;
+       s1 = l1;
+       s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+       if (s0) { break label$5; }
+       s0 = l1;
+       s1 = l2;
+       s0 = s0 + s1 | 0;
+       l3 = s0;
+       s1 = l0;
+       s0 = s0 >>> 0 > s1 >>> 0 | 0;
+       if (s0) { break label$4; }
+      }
+      s0 = l2;
+      s0 = !s0 | 0;
+      if (s0) { break label$1; }
+      s0 = l2;
+      s1 = 4;
+      s0 = s0 >>> 0 < s1 >>> 0 | 0;
+      if (s0) { break label$3; }
+      label$6 : {
+       s0 = l1;
+       s1 = l2;
+       s0 = s0 + s1 | 0;
+       s1 = l0;
+       s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+       if (s0) { break label$6; }
+       s0 = l0;
+       s1 = l2;
+       s0 = s0 + s1 | 0;
+       s1 = l1;
+       s0 = s0 >>> 0 > s1 >>> 0 | 0;
+       if (s0) { break label$3; }
+      }
+      s0 = l2;
+      s1 = 3;
+      s0 = s0 & s1;
+      l4 = s0;
+      s0 = l0;
+      s1 = l2;
+      s2 = -4;
+      s1 = s1 & s2;
+      l5 = s1;
+      s0 = s0 + s1 | 0;
+      l6 = s0;
+      s0 = l1;
+      s1 = l5;
+      s0 = s0 + s1 | 0;
+      l7 = s0;
+      s0 = l0;
+      l3 = s0;
+      s0 = l5;
+      l8 = s0;
+      label$7 : while (1) {
+       s0 = l3;
+       s1 = l1;
+       s1 = load32(s1);
+       store32(s0, s1);
+       s0 = l1;
+       s1 = 4;
+       s0 = s0 + s1 | 0;
+       l1 = s0;
+       s0 = l3;
+       s1 = 4;
+       s0 = s0 + s1 | 0;
+       l3 = s0;
+       s0 = l8;
+       s1 = -4;
+       s0 = s0 + s1 | 0;
+       l8 = s0;
+       if (s0) { continue label$7; }
+       break label$7;
+      }
+      s0 = l5;
+      s1 = l2;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$1; }
+      break label$2;
+     }
+     s0 = l2;
+     s0 = !s0 | 0;
+     if (s0) { break label$1; }
+     s0 = l0;
+     s1 = l2;
+     s0 = s0 + s1 | 0;
+     l8 = s0;
+     label$8 : {
+      label$9 : {
+       s0 = l2;
+       s1 = 4;
+       s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+       if (s0) { break label$9; }
+       s0 = l2;
+       l4 = s0;
+       break label$8;
+      }
+      label$10 : {
+       s0 = l3;
+       s1 = l0;
+       s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+       if (s0) { break label$10; }
+       s0 = l8;
+       s1 = l1;
+       s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+       if (s0) { break label$10; }
+       s0 = l2;
+       l4 = s0;
+       break label$8;
+      }
+      s0 = l8;
+      s1 = -4;
+      s0 = s0 + s1 | 0;
+      l7 = s0;
+      s0 = l3;
+      s1 = -4;
+      s0 = s0 + s1 | 0;
+      l6 = s0;
+      s0 = l2;
+      s1 = 3;
+      s0 = s0 & s1;
+      l4 = s0;
+      s0 = l8;
+      s1 = l2;
+      s2 = -4;
+      s1 = s1 & s2;
+      l5 = s1;
+      s0 = s0 - s1 | 0;
+      l8 = s0;
+      s0 = l3;
+      s1 = l5;
+      s0 = s0 - s1 | 0;
+      l3 = s0;
+      s0 = l5;
+      l1 = s0;
+      label$11 : while (1) {
+       s0 = l7;
+       s1 = l6;
+       s1 = load32(s1);
+       store32(s0, s1);
+       s0 = l6;
+       s1 = -4;
+       s0 = s0 + s1 | 0;
+       l6 = s0;
+       s0 = l7;
+       s1 = -4;
+       s0 = s0 + s1 | 0;
+       l7 = s0;
+       s0 = l1;
+       s1 = -4;
+       s0 = s0 + s1 | 0;
+       l1 = s0;
+       if (s0) { continue label$11; }
+       break label$11;
+      }
+      s0 = l5;
+      s1 = l2;
+      s0 = (s0 | 0) == (s1 | 0) | 0;
+      if (s0) { break label$1; }
+     }
+     s0 = l8;
+     s1 = -1;
+     s0 = s0 + s1 | 0;
+     l7 = s0;
+     s0 = l3;
+     s1 = -1;
+     s0 = s0 + s1 | 0;
+     l6 = s0;
+     label$12 : while (1) {
+      s0 = l7;
+      s1 = l6;
+      s1 = HEAPU8[s1];
+      HEAP8[s0] = s1;
+      s0 = l7;
+      s1 = -1;
+      s0 = s0 + s1 | 0;
+      l7 = s0;
+      s0 = l6;
+      s1 = -1;
+      s0 = s0 + s1 | 0;
+      l6 = s0;
+      s0 = l4;
+      s1 = -1;
+      s0 = s0 + s1 | 0;
+      l4 = s0;
+      if (s0) { continue label$12; }
+      break label$1;
+     }
+    }
+    s0 = l1;
+    l7 = s0;
+    s0 = l0;
+    l6 = s0;
+    s0 = l2;
+    l4 = s0;
+   }
+   label$13 : while (1) {
+    s0 = l6;
+    s1 = l7;
+    s1 = HEAPU8[s1];
+    HEAP8[s0] = s1;
+    s0 = l6;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l6 = s0;
+    s0 = l7;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l7 = s0;
+    s0 = l4;
+    s1 = -1;
+    s0 = s0 + s1 | 0;
+    l4 = s0;
+    if (s0) { continue label$13; }
+    break label$13;
+   }
+  }
+  s0 = l0;
+  return s0;
+ }
+ function $65(l0, l1, l2) {
+  var l3 = 0, l4 = 0, l5 = 0, l6 = 0, l7 = 0, s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   s0 = l2;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   label$2 : {
+    label$3 : {
+     s0 = l2;
+     s1 = 4;
+     s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+     if (s0) { break label$3; }
+     s0 = l0;
+     l3 = s0;
+     s0 = l2;
+     l4 = s0;
+     break label$2;
+    }
+    s0 = l2;
+    s1 = 3;
+    s0 = s0 & s1;
+    l4 = s0;
+    s0 = l0;
+    s1 = l2;
+    s2 = -4;
+    s1 = s1 & s2;
+    l5 = s1;
+    s0 = s0 + s1 | 0;
+    l3 = s0;
+    s0 = l0;
+    l6 = s0;
+    s0 = l5;
+    l7 = s0;
+    label$4 : while (1) {
+     s0 = l6;
+     s1 = l1;
+     HEAP8[s0] = s1;
+     s0 = l6;
+     s1 = l1;
+     HEAP8[s0 + 1 | 0] = s1;
+     s0 = l6;
+     s1 = l1;
+     HEAP8[s0 + 2 | 0] = s1;
+     s0 = l6;
+     s1 = 3;
+     s0 = s0 + s1 | 0;
+     s1 = l1;
+     HEAP8[s0] = s1;
+     s0 = l6;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     l6 = s0;
+     s0 = l7;
+     s1 = -4;
+     s0 = s0 + s1 | 0;
+     l7 = s0;
+     if (s0) { continue label$4; }
+     break label$4;
+    }
+    s0 = l5;
+    s1 = l2;
+    s0 = (s0 | 0) == (s1 | 0) | 0;
+    if (s0) { break label$1; }
+   }
+   label$5 : while (1) {
+    s0 = l3;
+    s1 = l1;
+    HEAP8[s0] = s1;
+    s0 = l3;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l3 = s0;
+    s0 = l4;
+    s1 = -1;
+    s0 = s0 + s1 | 0;
+    l4 = s0;
+    if (s0) { continue label$5; }
+    break label$5;
+   }
+  }
+  s0 = l0;
+  return s0;
+ }
+ function $66(l0, l1, l2) {
+  var s0 = 0, s1 = 0;
+  label$1 : {
+   s0 = l2;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   s0 = l1;
+   s1 = 255;
+   s0 = s0 & s1;
+   l1 = s0;
+   label$2 : while (1) {
+    label$3 : {
+     s0 = l0;
+     s0 = HEAPU8[s0];
+     s1 = l1;
+     s0 = (s0 | 0) != (s1 | 0) | 0;
+     if (s0) { break label$3; }
+     s0 = l0;
+     return s0;
+    }
+    s0 = l0;
+    s1 = 1;
+    s0 = s0 + s1 | 0;
+    l0 = s0;
+    s0 = l2;
+    s1 = -1;
+    s0 = s0 + s1 | 0;
+    l2 = s0;
+    if (s0) { continue label$2; }
+    break label$2;
+   }
+  }
+  s0 = 0;
+  return s0;
+ }
+ function $67(l0) {
+  var l1 = 0, l2 = 0, l3 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  s0 = 0;
+  l1 = s0;
+  label$1 : {
+   s0 = l0;
+   s1 = 2147483631;
+   s0 = s0 >>> 0 > s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = 16;
+   s0 = s0 + s1 | 0;
+   l2 = s0;
+   s0 = 9024;
+   l0 = s0;
+   s0 = 4;
+   l1 = s0;
+   label$2 : while (1) {
+    s0 = l0;
+    s1 = 4;
+    s0 = s0 + s1 | 0;
+    l0 = s0;
+    s0 = 1;
+    s1 = l1;
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    l1 = s1;
+    s0 = s0 << s1;
+    l3 = s0;
+    s1 = l2;
+    s0 = s0 >>> 0 < s1 >>> 0 | 0;
+    if (s0) { continue label$2; }
+    break label$2;
+   }
+   label$3 : {
+    label$4 : {
+     s0 = l0;
+     s0 = HEAP32[s0 >> 2];
+     l2 = s0;
+     s0 = !s0 | 0;
+     if (s0) { break label$4; }
+     s0 = l0;
+     s1 = l2;
+     s1 = HEAP32[(s1 + 16 | 0) >> 2];
+     HEAP32[s0 >> 2] = s1;
+     break label$3;
+    }
+    label$5 : {
+     label$6 : {
+      s0 = 0;
+      s0 = HEAP32[(s0 + 9136 | 0) >> 2];
+      l0 = s0;
+      s0 = !s0 | 0;
+      if (s0) { break label$6; }
+      s0 = 0;
+      s0 = HEAP32[(s0 + 9140 | 0) >> 2];
+      l2 = s0;
+      break label$5;
+     }
+     s0 = 0;
+     s1 = 22464;
+     s2 = 15;
+     s1 = s1 + s2 | 0;
+     s2 = -16;
+     s1 = s1 & s2;
+     l2 = s1;
+     HEAP32[(s0 + 9140 | 0) >> 2] = s1;
+     s0 = 0;
+     s1 = __wasm_memory_size();
+     s2 = 16;
+     s1 = s1 << s2;
+     l0 = s1;
+     HEAP32[(s0 + 9136 | 0) >> 2] = s1;
+    }
+    label$7 : {
+     s0 = l3;
+     s1 = l0;
+     s2 = l2;
+     s1 = s1 - s2 | 0;
+     l0 = s1;
+     s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+     if (s0) { break label$7; }
+     label$8 : {
+      s0 = l3;
+      s1 = l0;
+      s0 = s0 - s1 | 0;
+      s1 = 65535;
+      s0 = s0 + s1 | 0;
+      l0 = s0;
+      s1 = 16;
+      s0 = s0 >>> s1 | 0;
+      s0 = __wasm_memory_grow(s0);
+      s1 = -1;
+      s0 = (s0 | 0) != (s1 | 0) | 0;
+      if (s0) { break label$8; }
+      s0 = 0;
+      return s0;
+     }
+     s0 = 0;
+     s1 = 0;
+     s1 = HEAP32[(s1 + 9136 | 0) >> 2];
+     s2 = l0;
+     s3 = -65536;
+     s2 = s2 & s3;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 9136 | 0) >> 2] = s1;
+     s0 = 0;
+     s0 = HEAP32[(s0 + 9140 | 0) >> 2];
+     l2 = s0;
+    }
+    s0 = 0;
+    s1 = l2;
+    s2 = l3;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 9140 | 0) >> 2] = s1;
+   }
+   s0 = l2;
+   s1 = l1;
+   HEAP32[s0 >> 2] = s1;
+   s0 = l2;
+   s1 = 16;
+   s0 = s0 + s1 | 0;
+   l1 = s0;
+  }
+  s0 = l1;
+  return s0;
+ }
+ function $68(l0) {
+  var l1 = 0, l2 = 0, s0 = 0, s1 = 0, s2 = 0;
+  label$1 : {
+   s0 = l0;
+   s0 = !s0 | 0;
+   if (s0) { break label$1; }
+   s0 = l0;
+   s1 = l0;
+   s2 = -16;
+   s1 = s1 + s2 | 0;
+   l1 = s1;
+   s1 = HEAP32[s1 >> 2];
+   s2 = 2;
+   s1 = s1 << s2;
+   s2 = 9008;
+   s1 = s1 + s2 | 0;
+   l2 = s1;
+   s1 = HEAP32[s1 >> 2];
+   HEAP32[s0 >> 2] = s1;
+   s0 = l2;
+   s1 = l1;
+   HEAP32[s0 >> 2] = s1;
+  }
+ }
+ function $69(l0, l1) {
+  var l2 = 0, l3 = 0, l4 = 0, l5 = 0, l6 = 0, l7 = 0, l8 = 0, l9 = 0, l10 = 0, s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  label$1 : {
+   label$2 : {
+    s0 = l0;
+    if (s0) { break label$2; }
+    s0 = 0;
+    l2 = s0;
+    s0 = l1;
+    s1 = 2147483631;
+    s0 = s0 >>> 0 > s1 >>> 0 | 0;
+    if (s0) { break label$1; }
+    s0 = l1;
+    s1 = 16;
+    s0 = s0 + s1 | 0;
+    l3 = s0;
+    s0 = 9024;
+    l1 = s0;
+    s0 = 4;
+    l4 = s0;
+    label$3 : while (1) {
+     s0 = l1;
+     s1 = 4;
+     s0 = s0 + s1 | 0;
+     l1 = s0;
+     s0 = 1;
+     s1 = l4;
+     s2 = 1;
+     s1 = s1 + s2 | 0;
+     l4 = s1;
+     s0 = s0 << s1;
+     l5 = s0;
+     s1 = l3;
+     s0 = s0 >>> 0 < s1 >>> 0 | 0;
+     if (s0) { continue label$3; }
+     break label$3;
+    }
+    label$4 : {
+     label$5 : {
+      s0 = l1;
+      s0 = HEAP32[s0 >> 2];
+      l3 = s0;
+      s0 = !s0 | 0;
+      if (s0) { break label$5; }
+      s0 = l1;
+      s1 = l3;
+      s1 = HEAP32[(s1 + 16 | 0) >> 2];
+      HEAP32[s0 >> 2] = s1;
+      break label$4;
+     }
+     label$6 : {
+      label$7 : {
+       s0 = 0;
+       s0 = HEAP32[(s0 + 9136 | 0) >> 2];
+       l1 = s0;
+       s0 = !s0 | 0;
+       if (s0) { break label$7; }
+       s0 = 0;
+       s0 = HEAP32[(s0 + 9140 | 0) >> 2];
+       l3 = s0;
+       break label$6;
+      }
+      s0 = 0;
+      s1 = 22464;
+      s2 = 15;
+      s1 = s1 + s2 | 0;
+      s2 = -16;
+      s1 = s1 & s2;
+      l3 = s1;
+      HEAP32[(s0 + 9140 | 0) >> 2] = s1;
+      s0 = 0;
+      s1 = __wasm_memory_size();
+      s2 = 16;
+      s1 = s1 << s2;
+      l1 = s1;
+      HEAP32[(s0 + 9136 | 0) >> 2] = s1;
+     }
+     label$8 : {
+      s0 = l5;
+      s1 = l1;
+      s2 = l3;
+      s1 = s1 - s2 | 0;
+      l1 = s1;
+      s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+      if (s0) { break label$8; }
+      label$9 : {
+       s0 = l5;
+       s1 = l1;
+       s0 = s0 - s1 | 0;
+       s1 = 65535;
+       s0 = s0 + s1 | 0;
+       l1 = s0;
+       s1 = 16;
+       s0 = s0 >>> s1 | 0;
+       s0 = __wasm_memory_grow(s0);
+       s1 = -1;
+       s0 = (s0 | 0) != (s1 | 0) | 0;
+       if (s0) { break label$9; }
+       s0 = 0;
+       return s0;
+      }
+      s0 = 0;
+      s1 = 0;
+      s1 = HEAP32[(s1 + 9136 | 0) >> 2];
+      s2 = l1;
+      s3 = -65536;
+      s2 = s2 & s3;
+      s1 = s1 + s2 | 0;
+      HEAP32[(s0 + 9136 | 0) >> 2] = s1;
+      s0 = 0;
+      s0 = HEAP32[(s0 + 9140 | 0) >> 2];
+      l3 = s0;
+     }
+     s0 = 0;
+     s1 = l3;
+     s2 = l5;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 9140 | 0) >> 2] = s1;
+    }
+    s0 = l3;
+    s1 = l4;
+    HEAP32[s0 >> 2] = s1;
+    s0 = l3;
+    s1 = 16;
+    s0 = s0 + s1 | 0;
+    return s0;
+   }
+   label$10 : {
+    s0 = 1;
+    s1 = l0;
+    s2 = -16;
+    s1 = s1 + s2 | 0;
+    l6 = s1;
+    s1 = HEAP32[s1 >> 2];
+    s0 = s0 << s1;
+    s1 = -16;
+    s0 = s0 + s1 | 0;
+    l7 = s0;
+    s1 = l1;
+    s0 = s0 >>> 0 < s1 >>> 0 | 0;
+    if (s0) { break label$10; }
+    s0 = l0;
+    return s0;
+   }
+   s0 = 0;
+   l2 = s0;
+   s0 = l1;
+   s1 = 2147483631;
+   s0 = s0 >>> 0 > s1 >>> 0 | 0;
+   if (s0) { break label$1; }
+   s0 = l1;
+   s1 = 16;
+   s0 = s0 + s1 | 0;
+   l3 = s0;
+   s0 = 9024;
+   l1 = s0;
+   s0 = 4;
+   l4 = s0;
+   label$11 : while (1) {
+    s0 = l1;
+    s1 = 4;
+    s0 = s0 + s1 | 0;
+    l1 = s0;
+    s0 = 1;
+    s1 = l4;
+    s2 = 1;
+    s1 = s1 + s2 | 0;
+    l4 = s1;
+    s0 = s0 << s1;
+    l5 = s0;
+    s1 = l3;
+    s0 = s0 >>> 0 < s1 >>> 0 | 0;
+    if (s0) { continue label$11; }
+    break label$11;
+   }
+   label$12 : {
+    label$13 : {
+     s0 = l1;
+     s0 = HEAP32[s0 >> 2];
+     l3 = s0;
+     s0 = !s0 | 0;
+     if (s0) { break label$13; }
+     s0 = l1;
+     s1 = l3;
+     s1 = HEAP32[(s1 + 16 | 0) >> 2];
+     HEAP32[s0 >> 2] = s1;
+     break label$12;
+    }
+    label$14 : {
+     label$15 : {
+      s0 = 0;
+      s0 = HEAP32[(s0 + 9136 | 0) >> 2];
+      l1 = s0;
+      s0 = !s0 | 0;
+      if (s0) { break label$15; }
+      s0 = 0;
+      s0 = HEAP32[(s0 + 9140 | 0) >> 2];
+      l3 = s0;
+      break label$14;
+     }
+     s0 = 0;
+     s1 = 22464;
+     s2 = 15;
+     s1 = s1 + s2 | 0;
+     s2 = -16;
+     s1 = s1 & s2;
+     l3 = s1;
+     HEAP32[(s0 + 9140 | 0) >> 2] = s1;
+     s0 = 0;
+     s1 = __wasm_memory_size();
+     s2 = 16;
+     s1 = s1 << s2;
+     l1 = s1;
+     HEAP32[(s0 + 9136 | 0) >> 2] = s1;
+    }
+    label$16 : {
+     s0 = l5;
+     s1 = l1;
+     s2 = l3;
+     s1 = s1 - s2 | 0;
+     l1 = s1;
+     s0 = s0 >>> 0 <= s1 >>> 0 | 0;
+     if (s0) { break label$16; }
+     label$17 : {
+      s0 = l5;
+      s1 = l1;
+      s0 = s0 - s1 | 0;
+      s1 = 65535;
+      s0 = s0 + s1 | 0;
+      l1 = s0;
+      s1 = 16;
+      s0 = s0 >>> s1 | 0;
+      s0 = __wasm_memory_grow(s0);
+      s1 = -1;
+      s0 = (s0 | 0) != (s1 | 0) | 0;
+      if (s0) { break label$17; }
+      s0 = 0;
+      return s0;
+     }
+     s0 = 0;
+     s1 = 0;
+     s1 = HEAP32[(s1 + 9136 | 0) >> 2];
+     s2 = l1;
+     s3 = -65536;
+     s2 = s2 & s3;
+     s1 = s1 + s2 | 0;
+     HEAP32[(s0 + 9136 | 0) >> 2] = s1;
+     s0 = 0;
+     s0 = HEAP32[(s0 + 9140 | 0) >> 2];
+     l3 = s0;
+    }
+    s0 = 0;
+    s1 = l3;
+    s2 = l5;
+    s1 = s1 + s2 | 0;
+    HEAP32[(s0 + 9140 | 0) >> 2] = s1;
+   }
+   s0 = l3;
+   s1 = l4;
+   HEAP32[s0 >> 2] = s1;
+   s0 = l3;
+   s1 = 16;
+   s0 = s0 + s1 | 0;
+   l2 = s0;
+   label$18 : {
+    label$19 : {
+     label$20 : {
+      label$21 : {
+       s0 = l7;
+       s1 = 4;
+       s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+       if (s0) { break label$21; }
+       s0 = l2;
+       l1 = s0;
+       s0 = l0;
+       l4 = s0;
+       break label$20;
+      }
+      s0 = l3;
+      s1 = 16;
+      s0 = s0 + s1 | 0;
+      l3 = s0;
+      s0 = l0;
+      l5 = s0;
+      s0 = l0;
+      l4 = s0;
+      s0 = l2;
+      l1 = s0;
+      label$22 : while (1) {
+       s0 = l3;
+       s1 = l5;
+       s0 = s0 | s1;
+       s1 = 3;
+       s0 = s0 & s1;
+       if (s0) { break label$19; }
+       s0 = l1;
+       s1 = l4;
+       s1 = HEAP32[s1 >> 2];
+       HEAP32[s0 >> 2] = s1;
+       s0 = l3;
+       s1 = 4;
+       s0 = s0 + s1 | 0;
+       l3 = s0;
+       s0 = l5;
+       s1 = 4;
+       s0 = s0 + s1 | 0;
+       l5 = s0;
+       s0 = l4;
+       s1 = 4;
+       s0 = s0 + s1 | 0;
+       l4 = s0;
+       s0 = l1;
+       s1 = 4;
+       s0 = s0 + s1 | 0;
+       l1 = s0;
+       s0 = l7;
+       s1 = -4;
+       s0 = s0 + s1 | 0;
+       l7 = s0;
+       s1 = 3;
+       s0 = s0 >>> 0 > s1 >>> 0 | 0;
+       if (s0) { continue label$22; }
+       break label$22;
+      }
+     }
+     s0 = l7;
+     s0 = !s0 | 0;
+     if (s0) { break label$18; }
+    }
+    label$23 : {
+     label$24 : {
+      s0 = l7;
+      s1 = 4;
+      s0 = s0 >>> 0 >= s1 >>> 0 | 0;
+      if (s0) { break label$24; }
+      s0 = l4;
+      l3 = s0;
+      s0 = l1;
+      l5 = s0;
+      s0 = l7;
+      l8 = s0;
+      break label$23;
+     }
+     s0 = l7;
+     s1 = 3;
+     s0 = s0 & s1;
+     l8 = s0;
+     s0 = l1;
+     s1 = l7;
+     s2 = -4;
+     s1 = s1 & s2;
+     l9 = s1;
+     s0 = s0 + s1 | 0;
+     l5 = s0;
+     s0 = l4;
+     s1 = l9;
+     s0 = s0 + s1 | 0;
+     l3 = s0;
+     s0 = l9;
+     l10 = s0;
+     label$25 : while (1) {
+      s0 = l1;
+      s1 = l4;
+      s1 = load32(s1);
+      store32(s0, s1);
+      s0 = l4;
+      s1 = 4;
+      s0 = s0 + s1 | 0;
+      l4 = s0;
+      s0 = l1;
+      s1 = 4;
+      s0 = s0 + s1 | 0;
+      l1 = s0;
+      s0 = l10;
+      s1 = -4;
+      s0 = s0 + s1 | 0;
+      l10 = s0;
+      if (s0) { continue label$25; }
+      break label$25;
+     }
+     s0 = l7;
+     s1 = l9;
+     s0 = (s0 | 0) == (s1 | 0) | 0;
+     if (s0) { break label$18; }
+    }
+    label$26 : while (1) {
+     s0 = l5;
+     s1 = l3;
+     s1 = HEAPU8[s1];
+     HEAP8[s0] = s1;
+     s0 = l5;
+     s1 = 1;
+     s0 = s0 + s1 | 0;
+     l5 = s0;
+     s0 = l3;
+     s1 = 1;
+     s0 = s0 + s1 | 0;
+     l3 = s0;
+     s0 = l8;
+     s1 = -1;
+     s0 = s0 + s1 | 0;
+     l8 = s0;
+     if (s0) { continue label$26; }
+     break label$26;
+    }
+   }
+   s0 = l0;
+   s1 = l6;
+   s1 = HEAP32[s1 >> 2];
+   s2 = 2;
+   s1 = s1 << s2;
+   s2 = 9008;
+   s1 = s1 + s2 | 0;
+   l1 = s1;
+   s1 = HEAP32[s1 >> 2];
+   HEAP32[s0 >> 2] = s1;
+   s0 = l1;
+   s1 = l6;
+   HEAP32[s0 >> 2] = s1;
+  }
+  s0 = l2;
+  return s0;
+ }
+ function load32(a) {
+  return HEAPU8[a] | HEAPU8[a + 1 | 0] << 8 | HEAPU8[a + 2 | 0] << 16 | HEAPU8[a + 3 | 0] << 24;
+ }
+ function load16_s(a) {
+  return (HEAPU8[a] | HEAPU8[a + 1 | 0] << 8) << 16 >> 16;
+ }
+ function load16_u(a) {
+  return HEAPU8[a] | HEAPU8[a + 1 | 0] << 8;
+ }
+ function store32(a, v) {
+  HEAP8[a] = v;
+  HEAP8[a + 1 | 0] = v >>> 8;
+  HEAP8[a + 2 | 0] = v >>> 16;
+  HEAP8[a + 3 | 0] = v >>> 24;
+ }
+ function store16(a, v) {
+  HEAP8[a] = v;
+  HEAP8[a + 1 | 0] = v >>> 8;
+ }
+ function __wasm_ctz_i32(a) {
+  return a ? 31 - Math_clz32(a & -a) : 32;
+ }
+ function __wasm_popcnt_i32(a) {
+  var n = 0;
+  for (; a; a &= a - 1) n = n + 1 | 0;
+  return n;
+ }
+ function __wasm_rotl_i32(a, b) {
+  return a << (b & 31) | a >>> (32 - b & 31);
+ }
+ function __wasm_rotr_i32(a, b) {
+  return a >>> (b & 31) | a << (32 - b & 31);
+ }
+ function base64DecodeToExistingUint8Array(uint8Array, offset, b64) {
+  var bytes = typeof Buffer !== 'undefined' ? Buffer.from(b64, 'base64') : Uint8Array.from(atob(b64), function (c) { return c.charCodeAt(0); });
+  uint8Array.set(bytes, offset);
+ }
+ base64DecodeToExistingUint8Array(HEAPU8, 1024, "AAAAAAAAAAAAAAAAAAAAAAECAwQFBgcICQoLDA0ODxARAhITFAIVFhcYGRobHAIdHh8AAAAAAAAAAAAAICEAACIjAAACAgICAgICAgICAgICAgICAgICAgICAgICJAICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJQImJygpKisCAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICLAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAItLgIvMDEyMzQ1NjcCODk6Ozw9Pj9AQUJDREVGR0hJSktMTU5PUAICAlFSUwAAAAAAAAAAAFQCAgICVQICAgICAgICAgICAgICVgICVwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAWAAAAAAAAAICWVoAW1xdAgICAgICAgICAgICAgICAgICAgICAgJeAgICAl9gAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAYQJiYwAAAAAAAAAAAGQAAAAAAAAAAAAAAAAAAABlAABmAGdoAGlqa2wAAG0AAAAAbm9wcQBycwB0dXYAAAAAdwAAAAAAAAAAAAAAAGUAAAAAAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAngCAgICAgICAgICAgICAgICeXoCAgICAgICAgICAgICAgICAgICAgJ7AgICAgICAgICAgICAgICAgICAgICAgICAgICAnwCAn0AAAAAAAAAAAACAn4AAAAAAAICAgICAgICAgICAgICAgICAgJ/AgICAgICAgICAgICAgICgAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAIEAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABAA/wP+//+H/v//BwAAAAAABKAE//9/////f////////////////////////////////////////////////////////////////////////////8P/AwAfUAAA///////////////////fvMDX///7////////////v///////////////////////+/z///////////////////////////7///9/Av//////Af7/////v7YA////hwcAAAD/B////////////8P////////////////vn//9/58AAP/////////n////////////////AwD///////8/JP//////PwAA////D/8H////foD////////////7////////////////////z//+/++f+f///cXzn3mAsM//A1Duh/n///1t04c5Al7A/z8A7r/7///97fO/OwEAz/8A/u6f+f///e3znzngsM//AgDsxz3WGMf/w8c9gQDA/wAA/9/9///9//PfPWAnz/8AAO/f/f///e/z3z1gYM//DgD/3/3//////9998IDP/wD87v9//P//+y9/hF//wP8MAP7///////8H/3//AwAAAADW9///r///P19///MAAAAAAQAAA/8DoML//v///x/+/9////7///8fQAAAAAAAAAD///////////8D////////////P/////+/IP//////9////////////z1/Pf//////Pf////89fz3/f/////////89///////////nAP4DAP//AAD/////////////Pz/+//////////////////////////////////////////////////////////+f///+//8H////////////x/8B//8/gP//HwD//w8A/98NAP////////////+PMP8DAAAAuP8D//////////////8B//////8H//////////8/AP///3//D/8PwP////8/HwD//////w////8D/wcAAAAA////D/////////9/////n/8D/wOAAP+//38AAAAAAAD///////////8f/wMA+A8A//////////////////8PAP////////8A/+P//////z//B///////5wAA9/////8H/////////////////////////////////////////////z8//////z8//6r///8/////////31/cH88P/x/cHwAwAAAAAACAAQAQAAAAAoAAAP8fAAAAAAAA/x/i/wEAhPwvP1D9//PgQwAA//////8BAAAAAAAAAAAAAAAAAAD/////////////////////////////////////H/gPAP////+/IP////////+AAID//38Af39/f39/f3//////4AAAAP7/Ph/+////////////f/7+///////////////g///////+/////////////38AAP////8AAAAAAAD//////////////////////////////////wAAAAAAAAAA//////////////////////8fAAAAAAAAAAD//////z//H////w8AAP////////C///////////////////8DAAAAgP/8////////////////+f////////8/6x8AAPz///////8QAAD///////8PAP//////////PwD/A////+j//////z//////DwD///8f//////////8BgP8D////f////////38A/z//A///f/z//////////wcAADj//3wAfn5+AH9////////3/wP///////////////////83/wP//////////////////////////w8A//9/+P//////D/////////////////8//////////////////wMAAAAAfwD44P/9f1/b/////////////////wMAAAD4////////////////PwAA///////////8////////AAAAAAD/D///AAD//xgAAOAAAAAA3/////////////////////8fAAD/A/7//4f+//8H4P////////////9//Pz8HAAAAAD/7///f///t/8//z8AAAAA////////////////////BwAAAAAAAAAA////////HwAAAAAAAAAAAAAAAAAAAAAgAAAAAAAAAAAAAAAAAAAAAP///x////////8BAAEAAAD/////AOD///8H//////8H////P/////8P/z4AAAAAAP////////////////////////8//wP/////D/////8P//////8A////////DwD/9//3t//7//sb////////DwD///////9/AP//PwD/AAAAv////////QcAAAAAAAAAAD/9/////7+R//8/AP//fwD///9/AAAAAAAAAAD//zcA//8/AP///wMAAAAAAAAAAP/////////AAAAAAAAAAABv8O/+//8/hwAAAAD///8f////HwAAAAD//v//fwAAAP///////z8A//8/AP//BwD//wMAAAAAAAAAAAAAAAAA////////////AQAAAAAAAP///////wcA////////BwD//////wD/A/////8/vv//PwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD//////xsDABwAAAAAAADw////H4AA/////wEAAAD//z8AAAAAAP//HwAAAP//fwD//////////38AAADA/z+A/////////wcEAP///wH/A////////9//8AD/////TwD//////////x/e/xcAAAAA///7/////8ADAAAAAAAAAH+9/7//Af////////8H/wPvn/n///3t+585geDPHx8A/0v/////v/+l9w8ABgAAAP///////////wf/wwMAAAD//////////78A/wMAAAAAAAAAAAAAAAAAAAAAAAAAAP///////z//AQAAPwAAAAD//////////xEA/wMAAAAA/////////wH/A///DwAAAP///+f/D/8DfwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA/////////wcAAAAAAAAAAAAAAAD///////////8DAIB/8m////+/+Q8A/wMAAAAAAAAAAP/8///////8GwAAAP////////9/gAD///////////8jAAD///////////8BAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA/////wEA/wP//f////9//wEA/wMAAPz////8///+fwAAAAAAAAAAAH/7/////3+0/wD/A7/9////f/sB/wMAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAP//fwD///3/////xwcA/wcAAAAAAAAAAAAAAQAAAAAAAAAAAP////////////////////////8DAAAAAAAAAAAAAAAA/////////////////38AAP///////////////////////////////w8AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAP///////////////wEA////////AAD//z8A////////////////////////////////////////////////////////////////////B///////////fwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA/////////wMAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD/////////Af///3//A////////////3//A////z8fAP///////38ADwD/A/j//+D//wAAAAAAAAAAAAAAAAAAAAAAAAAAAAD//////x//AwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAP//////////AAAAAAAAAAAAAAAAAAAAAP///////////4f/////////gP//AAAAAAAAAAAbAAMA/////////////////////////////////////////wD//////////////////////////////////z8AAAAAgP8BAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA72//////BwAEAAAAJwDwAP////////////////////////////////////////////////////////////////8P/////////////////wf/H/8B/2MAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD/A///////P///fwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA4OMH+OcPAAAAPAAAAAAAAAAAAAAAAAAAAAAAABwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAP/////////////f///////////fZN7/6+//////////v+ff3////3tf/P3//////////////////////////////////////////////////////z/////9///3////9///3////9///3////9//////f////3///fP////////////////f/j//////x8gABAAAPj+/wAAAAAAAAAAAAD///9/4AcAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAH////nbB/////////8/AAAAgAAAAAAAAAAAAAAAAAAA//////8f/z//QwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD///9/AAD/////////AwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA//////8DAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD//////wcAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAf2//f////////////////////////////////x8AfwAAAAAA////////////D/8DAAAAAAAAAAAAAAAAAAAAAAAAAADv////lv73CoTqlqqW9/de//v/D+77/w8AAAAAAAAAAP////////////////////////////////////8AAAAA/////////wP///////////////////////////////////8/////////////////////////////////////////////////////////////////AwD//////////////////////////////////////////////////wEA/////////////////z8AAAAAAAAAAAAAAAAAAAAAAAAAAP///z8AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA////////////B///////////////////////////////////////////////////////////AAAAAAAAAAAAAP///////////////////////////////////////wAAAQEBAQEBAQEBAQEBAQEBAQAAAAAAAAAAAgICAgMDBAAAAAAAfwAAAB8AAAAPAAAABwAAAAAAAAAAAAAAAAAAAAAAQAAAAAAAgAAAAAAIAAAAAAEAAAAAAAAAAAAAAAAAAAAAABIAAAAMAAAABgAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABgAAAAQAAAACAAAAAAAAAA==");
+ base64DecodeToExistingUint8Array(HEAPU8, 8948, "AQAAAAIAAAAABAAA");
+ var FUNCTION_TABLE = [null, $53];
+ function __wasm_memory_size() {
+  return buffer.byteLength / 65536 | 0;
+ }
+ function __wasm_memory_grow(pagesToAdd) {
+  pagesToAdd = pagesToAdd | 0;
+  var oldPages = __wasm_memory_size() | 0;
+  var newPages = oldPages + pagesToAdd | 0;
+  if (oldPages < newPages && newPages < 65536) {
+   var newBuffer = new ArrayBuffer(Math_imul(newPages, 65536));
+   var newHEAP8 = new Int8Array(newBuffer);
+   newHEAP8.set(HEAP8);
+   HEAP8 = newHEAP8;
+   HEAP16 = new Int16Array(newBuffer);
+   HEAP32 = new Int32Array(newBuffer);
+   HEAPU8 = new Uint8Array(newBuffer);
+   HEAPU16 = new Uint16Array(newBuffer);
+   HEAPU32 = new Uint32Array(newBuffer);
+   buffer = newBuffer;
+  }
+  return oldPages < newPages || !pagesToAdd ? oldPages : -1;
+ }
+ return {
+  "memory": Object.create(Object.prototype, {
+   "grow": {
+    "value": __wasm_memory_grow
+   }, 
+   "buffer": {
+    "get": function () {
+     return buffer;
+    }
+   }
+  }), 
+  "sa": $50, 
+  "parse": $52, 
+  "e": $58, 
+  "el": $59, 
+  "ec": $60, 
+  "rd": $61, 
+  "rl": $62
+ };
+}
 
+var retasmFunc = asmFunc({});
+export var memory = retasmFunc.memory;
+export var sa = retasmFunc.sa;
+export var parse = retasmFunc.parse;
+export var e = retasmFunc.e;
+export var el = retasmFunc.el;
+export var ec = retasmFunc.ec;
+export var rd = retasmFunc.rd;
+export var rl = retasmFunc.rl;
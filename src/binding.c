@@ -0,0 +1,141 @@
+// Node-API binding for the lexer, built by binding.gyp and loaded through
+// src/native.ts.
+//
+// parse(source, lines) lexes a string or a Uint8Array (including Buffer),
+// recording the line starts when lines is true, and returns the records as
+// one Int32Array laid out as in binding.h, or on a parse error an array of
+// the error offset, line and column. Uint8Array sources are lexed in place,
+// with the byte ranges of their names recorded as well, and string sources
+// are copied out as UTF-8. Offsets are mapped back to UTF-16 indices either
+// way when the source is not ASCII.
+
+#include <node_api.h>
+// the lexer's byte type shares its name with the Node-API UTF-16 unit
+#define char16_t lexer_char16_t
+#include "lexer.c"
+#undef char16_t
+#include "binding.h"
+
+// Per-instance state, so that worker threads each get their own
+struct Binding {
+  Arena arena;
+  char* source;
+  size_t sourceCapacity;
+};
+typedef struct Binding Binding;
+
+static void finalize (napi_env env, void* data, void* hint) {
+  Binding* binding = data;
+  arenaFree(&binding->arena);
+  free(binding->source);
+  free(binding);
+}
+
+static napi_value throwError (napi_env env, bool range, const char* msg) {
+  if (range)
+    napi_throw_range_error(env, NULL, msg);
+  else
+    napi_throw_type_error(env, NULL, msg);
+  return NULL;
+}
+
+static napi_value parseSource (napi_env env, napi_callback_info info) {
+  size_t argc = 2;
+  napi_value args[2];
+  Binding* binding;
+  if (napi_get_cb_info(env, info, &argc, args, NULL, NULL) != napi_ok || argc < 1)
+    return throwError(env, false, "parse expects a source");
+  napi_get_instance_data(env, (void**)&binding);
+  napi_value arg = args[0];
+  bool lines = false;
+  if (argc > 1)
+    napi_get_value_bool(env, args[1], &lines);
+
+  napi_valuetype type;
+  napi_typeof(env, arg, &type);
+  unsigned char* source;
+  size_t len;
+  bool isString = type == napi_string;
+  bool ascii = true;
+  if (isString) {
+    size_t utf16Len;
+    napi_get_value_string_utf8(env, arg, NULL, 0, &len);
+    napi_get_value_string_utf16(env, arg, NULL, 0, &utf16Len);
+    if (len + 1 > binding->sourceCapacity) {
+      char* grown = realloc(binding->source, len + 1);
+      if (grown == NULL)
+        return throwError(env, true, "source too large");
+      binding->source = grown;
+      binding->sourceCapacity = len + 1;
+    }
+    napi_get_value_string_utf8(env, arg, binding->source, len + 1, &len);
+    source = (unsigned char*)binding->source;
+    ascii = len == utf16Len;
+  }
+  else {
+    bool isTypedArray = false;
+    napi_typedarray_type arrayType;
+    napi_is_typedarray(env, arg, &isTypedArray);
+    if (!isTypedArray)
+      return throwError(env, false, "source must be a string or a Uint8Array");
+    napi_get_typedarray_info(env, arg, &arrayType, &len, (void**)&source, NULL, NULL);
+    if (arrayType != napi_uint8_array)
+      return throwError(env, false, "source must be a string or a Uint8Array");
+    if (len == 0)
+      source = (unsigned char*)"";
+  }
+  if (len > UINT32_MAX)
+    return throwError(env, true, "source too large");
+  if (!isString)
+    ascii = isAscii(source, (uint32_t)len);
+
+  arenaReset(&binding->arena);
+  ParseResult result = { 0 };
+  LexOptions options = { lines ? LineStarts : 0, 0 };
+  bool success = parse_options(source, (uint32_t)len, arenaAlloc, &binding->arena, &result, &options);
+
+  Remap remapStorage;
+  Remap* remap = NULL;
+  if (!ascii) {
+    if (!buildRemap(&binding->arena, &remapStorage, source, (uint32_t)len))
+      return throwError(env, true, "out of memory");
+    remap = &remapStorage;
+  }
+
+  napi_value out;
+  if (!success) {
+    const unsigned char* error = source + (result.parse_error < len ? result.parse_error : len);
+    int32_t position[3];
+    position[0] = offset(remap, source, error);
+    errorPosition(remap, source, error, &position[1], &position[2]);
+    napi_create_array_with_length(env, 3, &out);
+    for (uint32_t i = 0; i < 3; i++) {
+      napi_value field;
+      napi_create_int32(env, position[i], &field);
+      napi_set_element(env, out, i, field);
+    }
+    return out;
+  }
+
+  uint32_t importCount, exportCount;
+  size_t fields = recordFields(&result, !isString, &importCount, &exportCount);
+  napi_value buffer;
+  int32_t* data;
+  if (napi_create_arraybuffer(env, fields * sizeof(int32_t), (void**)&data, &buffer) != napi_ok)
+    return NULL;
+  fields = writeRecords(&result, source, remap, !isString, &binding->arena, importCount, exportCount, data);
+  if (fields == 0)
+    return throwError(env, true, "out of memory");
+  napi_create_typedarray(env, napi_int32_array, fields, buffer, 0, &out);
+  return out;
+}
+
+NAPI_MODULE_INIT() {
+  Binding* binding = calloc(1, sizeof(Binding));
+  if (binding == NULL || napi_set_instance_data(env, binding, finalize, NULL) != napi_ok)
+    return NULL;
+  napi_value fn;
+  napi_create_function(env, "parse", NAPI_AUTO_LENGTH, parseSource, NULL, &fn);
+  napi_set_named_property(env, exports, "parse", fn);
+  return exports;
+}
@@ -0,0 +1,314 @@
+// Shared by the host bindings of the lexer, src/binding.c (Node-API) and
+// src/wasm.c (WebAssembly), which include it after lexer.c.
+//
+// Records are handed to JS as one array of int32 fields:
+//
+//   [facade, importCount, exportCount,
+//    (s, e, ss, se, d, a, n) per import, (s, e, ls, le, n) per export,
+//    byte ranges, decoded strings, line starts, lineCount]
+//
+// with d -1 for a static import and -2 for import.meta, a and ls/le -1 when
+// absent, and se 0 for an unterminated dynamic import.
+//
+// n says how the value of the specifier, or of the exported name with the
+// local name's in bits 2-3, is read: from the source as it stands for an
+// unquoted name (VALUE_NONE, which leaves an import without a value), from
+// the source between the quotes (VALUE_PLAIN), from the next decoded string
+// (VALUE_DECODED) or not at all for an invalid escape (VALUE_INVALID).
+// Decoded strings are a length in UTF-16 units followed by the units, two per
+// field, so that escapes are decoded here once rather than by eval in JS.
+//
+// Offsets are UTF-16 indices, mapped from byte offsets when the source is not
+// ASCII. For a source given as bytes, the byte ranges of the names follow the
+// records, (s, e) per import and (s, e, ls, le) per export, so that names read
+// from the source as it stands are decoded from its bytes.
+//
+// The line starts, recorded when lexing with LineStarts, are offsets like the
+// others. Their count comes last, 0 without LineStarts, so that they are read
+// back from the end.
+
+#define HEADER_FIELDS 3
+#define IMPORT_FIELDS 7
+#define EXPORT_FIELDS 5
+#define IMPORT_RANGE_FIELDS 2
+#define EXPORT_RANGE_FIELDS 4
+
+#define VALUE_NONE 0
+#define VALUE_PLAIN 1
+#define VALUE_DECODED 2
+#define VALUE_INVALID 3
+
+// UTF-16 index of every REMAP_BLOCK-th byte, for mapping UTF-8 offsets
+#define REMAP_BLOCK 64
+
+#define ARENA_CHUNK 65536
+
+struct Chunk {
+  struct Chunk* next;
+  size_t size;
+  size_t used;
+  max_align_t data[];
+};
+typedef struct Chunk Chunk;
+
+// Bump allocator for the lexer's records, reset before every parse
+struct Arena {
+  Chunk* chunks;
+};
+typedef struct Arena Arena;
+
+struct Remap {
+  uint32_t* blocks;
+};
+typedef struct Remap Remap;
+
+static void* arenaAlloc (uint32_t bytes, void* user_data) {
+  Arena* arena = user_data;
+  size_t size = (bytes + sizeof(max_align_t) - 1) & ~(sizeof(max_align_t) - 1);
+  Chunk* chunk = arena->chunks;
+  if (chunk == NULL || chunk->size - chunk->used < size) {
+    size_t chunkSize = size > ARENA_CHUNK ? size : ARENA_CHUNK;
+    Chunk* next = malloc(sizeof(Chunk) + chunkSize);
+    if (next == NULL)
+      return NULL;
+    next->next = chunk;
+    next->size = chunkSize;
+    next->used = 0;
+    arena->chunks = chunk = next;
+  }
+  void* ptr = (char*)chunk->data + chunk->used;
+  chunk->used += size;
+  return ptr;
+}
+
+static void arenaFree (Arena* arena) {
+  while (arena->chunks) {
+    Chunk* next = arena->chunks->next;
+    free(arena->chunks);
+    arena->chunks = next;
+  }
+}
+
+// Releases the previous parse's records. When they spilled into several
+// chunks, these are replaced by one chunk of their total size.
+static void arenaReset (Arena* arena) {
+  Chunk* chunk = arena->chunks;
+  if (chunk == NULL)
+    return;
+  if (chunk->next == NULL) {
+    chunk->used = 0;
+    return;
+  }
+  size_t total = 0;
+  for (; chunk; chunk = chunk->next)
+    total += chunk->size;
+  arenaFree(arena);
+  if (arenaAlloc(total, arena))
+    arena->chunks->used = 0;
+}
+
+static bool isAscii (const unsigned char* p, uint32_t len) {
+  const unsigned char* end = p + len;
+  for (; end - p >= 8; p += 8) {
+    uint64_t word;
+    memcpy(&word, p, 8);
+    if (word & 0x8080808080808080ull)
+      return false;
+  }
+  for (; p < end; p++) {
+    if (*p & 0x80)
+      return false;
+  }
+  return true;
+}
+
+static inline uint32_t utf16Width (unsigned char c) {
+  // continuation bytes add nothing, four byte sequences a surrogate pair
+  return ((c & 0xC0) != 0x80) + ((c & 0xF8) == 0xF0);
+}
+
+static bool buildRemap (Arena* arena, Remap* remap, const unsigned char* source, uint32_t len) {
+  remap->blocks = arenaAlloc((len / REMAP_BLOCK + 1) * sizeof(uint32_t), arena);
+  if (remap->blocks == NULL)
+    return false;
+  uint32_t index = 0;
+  for (uint32_t i = 0; i < len; i++) {
+    if (i % REMAP_BLOCK == 0)
+      remap->blocks[i / REMAP_BLOCK] = index;
+    index += utf16Width(source[i]);
+  }
+  if (len % REMAP_BLOCK == 0)
+    remap->blocks[len / REMAP_BLOCK] = index;
+  return true;
+}
+
+// The offset of p, as a UTF-16 index when remap is given
+static int32_t offset (const Remap* remap, const unsigned char* source, const unsigned char* p) {
+  uint32_t byte = (uint32_t)(p - source);
+  if (remap == NULL)
+    return (int32_t)byte;
+  uint32_t index = remap->blocks[byte / REMAP_BLOCK];
+  for (uint32_t i = byte - byte % REMAP_BLOCK; i < byte; i++)
+    index += utf16Width(source[i]);
+  return (int32_t)index;
+}
+
+static int32_t offsetOrNone (const Remap* remap, const unsigned char* source, const unsigned char* p) {
+  return p == NULL ? -1 : offset(remap, source, p);
+}
+
+// Converts the output of unescape_string to UTF-16, with U+FFFD for each
+// byte that does not start a sequence, which a Uint8Array source may hold.
+// Never writes more units than there are bytes.
+static uint32_t wtf8ToUtf16 (const unsigned char* p, uint32_t len, uint16_t* out) {
+  const unsigned char* end = p + len;
+  uint16_t* start = out;
+  while (p < end) {
+    uint32_t c = *p++;
+    if (c < 0x80) {
+      *out++ = c;
+      continue;
+    }
+    uint32_t n = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : 1;
+    bool valid = c >= 0xC2 && c <= 0xF4 && (uint32_t)(end - p) >= n;
+    c &= 0x3F >> n;
+    for (uint32_t i = 0; valid && i < n; i++) {
+      valid = (p[i] & 0xC0) == 0x80;
+      c = c << 6 | (p[i] & 0x3F);
+    }
+    if (!valid) {
+      *out++ = 0xFFFD;
+      continue;
+    }
+    p += n;
+    if (c >= 0x10000) {
+      c -= 0x10000;
+      *out++ = 0xD800 | c >> 10;
+      *out++ = 0xDC00 | (c & 0x3FF);
+    }
+    else {
+      *out++ = c;
+    }
+  }
+  return (uint32_t)(out - start);
+}
+
+// Fields taken by the decoded string of [start, end), at most
+static inline size_t decodedFields (const unsigned char* start, const unsigned char* end) {
+  return 1 + ((size_t)(end - start) + 1) / 2;
+}
+
+// Returns how the string value [start, end) is read, appending it to
+// *strings when it has to be decoded, or -1 when out of memory
+static int32_t writeValue (const unsigned char* start, const unsigned char* end, bool template, bool escaped, Arena* arena, int32_t** strings) {
+  if (!escaped)
+    return VALUE_PLAIN;
+  unsigned char* decoded = arenaAlloc((uint32_t)(end - start) + 1, arena);
+  if (decoded == NULL)
+    return -1;
+  uint32_t len = unescape_string(start, end, template, decoded);
+  if (len == UINT32_MAX)
+    return VALUE_INVALID;
+  int32_t* slot = *strings;
+  uint32_t units = wtf8ToUtf16(decoded, len, (uint16_t*)(slot + 1));
+  *slot = (int32_t)units;
+  *strings = slot + 1 + (units + 1) / 2;
+  return VALUE_DECODED;
+}
+
+static inline bool isDynamicString (const Import* import) {
+  return import->safe && import->dynamic != STANDARD_IMPORT;
+}
+
+// Counts the records, returning the number of fields they take at most, with
+// the byte ranges when ranges is set
+static size_t recordFields (const ParseResult* result, bool ranges, uint32_t* importCount, uint32_t* exportCount) {
+  size_t strings = 0;
+  *importCount = *exportCount = 0;
+  for (Import* import = result->first_import; import; import = import->next) {
+    (*importCount)++;
+    if (import->escaped)
+      strings += isDynamicString(import) ? decodedFields(import->start + 1, import->end - 1) : decodedFields(import->start, import->end);
+  }
+  for (Export* export = result->first_export; export; export = export->next) {
+    (*exportCount)++;
+    if (export->escaped)
+      strings += decodedFields(export->start + 1, export->end - 1);
+    if (export->local_escaped)
+      strings += decodedFields(export->local_start + 1, export->local_end - 1);
+  }
+  if (ranges)
+    strings += (size_t)*importCount * IMPORT_RANGE_FIELDS + (size_t)*exportCount * EXPORT_RANGE_FIELDS;
+  return HEADER_FIELDS + (size_t)*importCount * IMPORT_FIELDS + (size_t)*exportCount * EXPORT_FIELDS + strings + result->line_count + 1;
+}
+
+static inline int32_t byteOffsetOrNone (const unsigned char* source, const unsigned char* p) {
+  return p == NULL ? -1 : (int32_t)(p - source);
+}
+
+// Returns the number of fields written, or 0 when out of memory
+static size_t writeRecords (const ParseResult* result, const unsigned char* source, const Remap* remap, bool ranges, Arena* arena, uint32_t importCount, uint32_t exportCount, int32_t* data) {
+  int32_t* start = data;
+  int32_t* byteRanges = data + HEADER_FIELDS + (size_t)importCount * IMPORT_FIELDS + (size_t)exportCount * EXPORT_FIELDS;
+  int32_t* strings = byteRanges;
+  if (ranges)
+    strings += (size_t)importCount * IMPORT_RANGE_FIELDS + (size_t)exportCount * EXPORT_RANGE_FIELDS;
+  *data++ = result->facade;
+  *data++ = (int32_t)importCount;
+  *data++ = (int32_t)exportCount;
+  for (Import* import = result->first_import; import; import = import->next) {
+    *data++ = offset(remap, source, import->start);
+    *data++ = offset(remap, source, import->end);
+    *data++ = offset(remap, source, import->statement_start);
+    *data++ = import->statement_end == NULL ? 0 : offset(remap, source, import->statement_end);
+    *data++ = import->dynamic == STANDARD_IMPORT ? -1 : import->dynamic == IMPORT_META ? -2 : offset(remap, source, import->dynamic);
+    *data++ = offsetOrNone(remap, source, import->assert_index);
+    int32_t value = VALUE_NONE;
+    if (isDynamicString(import))
+      value = writeValue(import->start + 1, import->end - 1, *import->start == '`', import->escaped, arena, &strings);
+    else if (import->safe)
+      value = writeValue(import->start, import->end, false, import->escaped, arena, &strings);
+    if (value < 0)
+      return 0;
+    *data++ = value;
+    if (ranges) {
+      *byteRanges++ = (int32_t)(import->start - source);
+      *byteRanges++ = (int32_t)(import->end - source);
+    }
+  }
+  for (Export* export = result->first_export; export; export = export->next) {
+    *data++ = offset(remap, source, export->start);
+    *data++ = offset(remap, source, export->end);
+    *data++ = offsetOrNone(remap, source, export->local_start);
+    *data++ = offsetOrNone(remap, source, export->local_end);
+    int32_t name = VALUE_NONE, local = VALUE_NONE;
+    if (export->end - export->start >= 2 && (*export->start == '\'' || *export->start == '"'))
+      name = writeValue(export->start + 1, export->end - 1, false, export->escaped, arena, &strings);
+    if (export->local_start != NULL && export->local_end - export->local_start >= 2 && (*export->local_start == '\'' || *export->local_start == '"'))
+      local = writeValue(export->local_start + 1, export->local_end - 1, false, export->local_escaped, arena, &strings);
+    if (name < 0 || local < 0)
+      return 0;
+    *data++ = name | local << 2;
+    if (ranges) {
+      *byteRanges++ = (int32_t)(export->start - source);
+      *byteRanges++ = (int32_t)(export->end - source);
+      *byteRanges++ = byteOffsetOrNone(source, export->local_start);
+      *byteRanges++ = byteOffsetOrNone(source, export->local_end);
+    }
+  }
+  int32_t* lines = strings;
+  for (uint32_t i = 0; i < result->line_count; i++)
+    *lines++ = offset(remap, source, source + result->line_starts[i]);
+  *lines++ = (int32_t)result->line_count;
+  return (size_t)(lines - start);
+}
+
+// The line, from 1, and the column, from 0, of the error at error. Lines end
+// at each '\n', as for LineStarts.
+static void errorPosition (const Remap* remap, const unsigned char* source, const unsigned char* error, int32_t* line, int32_t* column) {
+  const unsigned char* lineStart = source;
+  *line = 1;
+  for (const unsigned char* nl; (nl = memchr(lineStart, '\n', (size_t)(error - lineStart))) != NULL; lineStart = nl + 1)
+    (*line)++;
+  *column = offset(remap, source, error) - offset(remap, source, lineStart);
+}
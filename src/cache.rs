@@ -0,0 +1,465 @@
+//! A persistent cache of lex results, shared by the processes of a build.
+//!
+//! Results are keyed by a 128-bit XXH3 hash of the source and stored as
+//! compact records of `u32` offsets in a single append-only index file. Each
+//! process maps the index read-only and builds an in-memory table of the
+//! records in it, so a warm lookup is a hash and a table probe with no
+//! parsing. New results are buffered and appended in one write by
+//! [`LexCache::flush`], under an exclusive lock on a separate lock file.
+//!
+//! The index is never truncated or rewritten in place. When it would grow
+//! past its size bound, or when it holds a torn record from a crashed writer
+//! or was written by another lexer build, it is compacted into a temporary
+//! file that is renamed over it. Processes that still map the old file keep
+//! reading it until their next flush picks up the new one.
+//!
+//! Cross-process locking uses `flock` and is only available on unix; on
+//! other platforms a cache directory must not be shared by concurrent
+//! processes.
+
+use crate::{FileSource, ImportKind, Lexer, ModuleColumns, NONE};
+use std::{
+  collections::HashMap,
+  fs::{self, File, OpenOptions},
+  hash::{BuildHasherDefault, Hasher},
+  io::{self, Write},
+  path::{Path, PathBuf},
+};
+use xxhash_rust::xxh3::{xxh3_128, xxh3_64};
+
+const MAGIC: [u8; 8] = *b"ESMLXC01";
+/// Magic, lexer key and generation.
+const HEADER_LEN: usize = 24;
+const RECORD_TAG: u32 = 0x4345_5258;
+/// Tag, length, hash, source length, import and export counts, checksum.
+const RECORD_FIXED_LEN: usize = 4 + 4 + 16 + 4 + 4 + 4 + 4;
+const IMPORT_WORDS: usize = 7;
+const EXPORT_WORDS: usize = 4;
+/// Pending records are written out once they reach this size.
+const FLUSH_THRESHOLD: usize = 1 << 20;
+
+/// Index size bound used unless configured otherwise.
+pub const DEFAULT_MAX_BYTES: u64 = 256 << 20;
+
+/// Identifies the lexer build, so that an index written by a different
+/// version is discarded rather than trusted.
+fn lexer_key() -> u64 {
+  let mut key = Vec::new();
+  key.extend_from_slice(env!("CARGO_PKG_VERSION").as_bytes());
+  key.extend_from_slice(&xxh3_128(include_bytes!("lexer.h")).to_le_bytes());
+  key.extend_from_slice(&xxh3_128(include_bytes!("lexer.c")).to_le_bytes());
+  key.extend_from_slice(&xxh3_128(include_bytes!("keywords.h")).to_le_bytes());
+  key.extend_from_slice(&xxh3_128(include_bytes!("identifiers.h")).to_le_bytes());
+  xxh3_64(&key)
+}
+
+/// The keys are already hashes, so the table uses their low bits directly.
+#[derive(Default)]
+struct KeyHasher(u64);
+
+impl Hasher for KeyHasher {
+  fn finish(&self) -> u64 {
+    self.0
+  }
+
+  fn write(&mut self, bytes: &[u8]) {
+    for &b in bytes {
+      self.0 = self.0.rotate_left(8) ^ b as u64;
+    }
+  }
+
+  fn write_u128(&mut self, n: u128) {
+    self.0 = n as u64;
+  }
+}
+
+type KeyMap = HashMap<u128, usize, BuildHasherDefault<KeyHasher>>;
+
+/// An on-disk cache of lex results in a directory.
+///
+/// Results that are not yet in the index are buffered and written by
+/// [`LexCache::flush`], which also runs when the buffer grows large and when
+/// the cache is dropped.
+pub struct LexCache {
+  dir: PathBuf,
+  max_bytes: u64,
+  key: u64,
+  lexer: Lexer,
+  map: FileSource,
+  header_valid: bool,
+  generation: u64,
+  /// End of the valid records in `map`.
+  scanned: usize,
+  index: KeyMap,
+  pending: Vec<u8>,
+  pending_index: KeyMap,
+}
+
+impl LexCache {
+  /// Opens the cache in `dir`, creating the directory if needed, with the
+  /// index bounded to [`DEFAULT_MAX_BYTES`].
+  pub fn open<P: AsRef<Path>>(dir: P) -> io::Result<Self> {
+    Self::with_max_bytes(dir, DEFAULT_MAX_BYTES)
+  }
+
+  /// Opens the cache in `dir` with the index bounded to about `max_bytes`.
+  /// Once the bound would be exceeded, the oldest records are evicted until
+  /// the index is half that size.
+  pub fn with_max_bytes<P: AsRef<Path>>(dir: P, max_bytes: u64) -> io::Result<Self> {
+    let dir = dir.as_ref().to_path_buf();
+    fs::create_dir_all(&dir)?;
+    let mut cache = LexCache {
+      dir,
+      max_bytes,
+      key: lexer_key(),
+      lexer: Lexer::new(),
+      map: FileSource::empty(),
+      header_valid: false,
+      generation: 0,
+      scanned: 0,
+      index: KeyMap::default(),
+      pending: Vec::new(),
+      pending_index: KeyMap::default(),
+    };
+    cache.refresh()?;
+    Ok(cache)
+  }
+
+  /// Looks `code` up without lexing it. On a hit returns the cached result,
+  /// which is an error offset if the source failed to lex.
+  pub fn get<'a>(&self, code: &'a str) -> Option<Result<ModuleColumns<'a>, usize>> {
+    self.lookup(xxh3_128(code.as_bytes()), code)
+  }
+
+  /// Returns the cached result for `code`, lexing and recording it on a miss.
+  pub fn lex<'a>(&mut self, code: &'a str) -> Result<ModuleColumns<'a>, usize> {
+    let hash = xxh3_128(code.as_bytes());
+    if let Some(res) = self.lookup(hash, code) {
+      return res;
+    }
+
+    let res = self.lexer.lex_columns(code);
+    self.pending_index.insert(hash, self.pending.len());
+    encode(&mut self.pending, hash, code.len(), &res);
+    if self.pending.len() >= FLUSH_THRESHOLD {
+      // a failed write only loses cache entries, not results
+      let _ = self.flush();
+    }
+    res
+  }
+
+  /// Number of results in the index or waiting to be written.
+  pub fn len(&self) -> usize {
+    self.index.len() + self.pending_index.keys().filter(|hash| !self.index.contains_key(hash)).count()
+  }
+
+  pub fn is_empty(&self) -> bool {
+    self.len() == 0
+  }
+
+  /// Writes buffered results to the index, skipping any that another process
+  /// has written meanwhile, and picks up records appended by other processes.
+  pub fn flush(&mut self) -> io::Result<()> {
+    if self.pending.is_empty() {
+      return Ok(());
+    }
+
+    let _lock = Lock::acquire(&self.dir.join("lock"))?;
+    self.refresh()?;
+
+    let mut fresh = Vec::with_capacity(self.pending.len());
+    for record in Records::new(&self.pending, 0) {
+      if !self.index.contains_key(&record_hash(record)) {
+        fresh.extend_from_slice(record);
+      }
+    }
+
+    let over_budget = (self.scanned + fresh.len()) as u64 > self.max_bytes;
+    let torn = self.scanned != self.map.as_bytes().len();
+    if !self.header_valid || over_budget || torn {
+      self.compact(&fresh, over_budget)?;
+    } else if !fresh.is_empty() {
+      let mut file = OpenOptions::new().append(true).open(self.index_path())?;
+      file.write_all(&fresh)?;
+    }
+
+    self.pending.clear();
+    self.pending_index.clear();
+    self.refresh()
+  }
+
+  fn index_path(&self) -> PathBuf {
+    self.dir.join("index")
+  }
+
+  fn lookup<'a>(&self, hash: u128, code: &'a str) -> Option<Result<ModuleColumns<'a>, usize>> {
+    let record = if let Some(&offset) = self.index.get(&hash) {
+      &self.map.as_bytes()[offset..]
+    } else {
+      &self.pending[*self.pending_index.get(&hash)?..]
+    };
+    decode(record, code)
+  }
+
+  /// Maps the index again and indexes the records added since it was last
+  /// mapped. A new generation means the file was
+  /// replaced by a compaction, so it is indexed from the start.
+  fn refresh(&mut self) -> io::Result<()> {
+    let file = match File::open(self.index_path()) {
+      Ok(file) => file,
+      Err(err) if err.kind() == io::ErrorKind::NotFound => {
+        self.map = FileSource::empty();
+        self.header_valid = false;
+        self.scanned = 0;
+        self.index.clear();
+        return Ok(());
+      }
+      Err(err) => return Err(err),
+    };
+    self.map = FileSource::map(&file)?;
+    let bytes = self.map.as_bytes();
+    let header_valid = bytes.len() >= HEADER_LEN && bytes[..8] == MAGIC && read_u64(bytes, 8) == self.key;
+    let generation = if header_valid { read_u64(bytes, 16) } else { 0 };
+    if !header_valid || !self.header_valid || generation != self.generation || bytes.len() < self.scanned {
+      self.index.clear();
+      self.scanned = HEADER_LEN.min(bytes.len());
+    }
+    self.header_valid = header_valid;
+    self.generation = generation;
+    if !header_valid {
+      return Ok(());
+    }
+
+    let mut records = Records::new(bytes, self.scanned);
+    while let Some(record) = records.next() {
+      self.index.insert(record_hash(record), records.offset - record.len());
+    }
+    self.scanned = records.offset;
+    Ok(())
+  }
+
+  /// Rewrites the index with its valid records followed by `fresh`. When
+  /// `evict` is set only the newest records that fit in half the size bound
+  /// are kept.
+  fn compact(&self, fresh: &[u8], evict: bool) -> io::Result<()> {
+    let existing = if self.header_valid {
+      &self.map.as_bytes()[..self.scanned]
+    } else {
+      &[]
+    };
+    let mut records: Vec<&[u8]> = Records::new(existing, HEADER_LEN.min(existing.len())).collect();
+    records.extend(Records::new(fresh, 0));
+
+    let mut first = records.len();
+    if evict {
+      let budget = (self.max_bytes / 2) as usize;
+      let mut size = HEADER_LEN;
+      while first > 0 && size + records[first - 1].len() <= budget {
+        first -= 1;
+        size += records[first].len();
+      }
+    } else {
+      first = 0;
+    }
+
+    let mut out = Vec::with_capacity(HEADER_LEN + records[first..].iter().map(|r| r.len()).sum::<usize>());
+    out.extend_from_slice(&MAGIC);
+    out.extend_from_slice(&self.key.to_le_bytes());
+    out.extend_from_slice(&self.generation.wrapping_add(1).to_le_bytes());
+    for record in &records[first..] {
+      out.extend_from_slice(record);
+    }
+
+    let tmp = self.dir.join(format!("index.{}.tmp", std::process::id()));
+    fs::write(&tmp, &out)?;
+    fs::rename(&tmp, self.index_path())
+  }
+}
+
+impl Drop for LexCache {
+  fn drop(&mut self) {
+    let _ = self.flush();
+  }
+}
+
+fn read_u32(bytes: &[u8], at: usize) -> u32 {
+  u32::from_le_bytes(bytes[at..at + 4].try_into().unwrap())
+}
+
+fn read_u64(bytes: &[u8], at: usize) -> u64 {
+  u64::from_le_bytes(bytes[at..at + 8].try_into().unwrap())
+}
+
+fn record_hash(record: &[u8]) -> u128 {
+  u128::from_le_bytes(record[8..24].try_into().unwrap())
+}
+
+fn kind_code(kind: ImportKind) -> u32 {
+  match kind {
+    ImportKind::Standard => 0,
+    ImportKind::DynamicString => 1,
+    ImportKind::DynamicExpression => 2,
+    ImportKind::Meta => 3,
+  }
+}
+
+fn kind_from_code(code: u32) -> Option<ImportKind> {
+  Some(match code {
+    0 => ImportKind::Standard,
+    1 => ImportKind::DynamicString,
+    2 => ImportKind::DynamicExpression,
+    3 => ImportKind::Meta,
+    _ => return None,
+  })
+}
+
+/// Appends a record for `res` to `out`. A parse error is stored as an import
+/// count of [`NONE`] with the error offset in place of the export count.
+fn encode(out: &mut Vec<u8>, hash: u128, source_len: usize, res: &Result<ModuleColumns<'_>, usize>) {
+  let start = out.len();
+  let push = |out: &mut Vec<u8>, word: u32| out.extend_from_slice(&word.to_le_bytes());
+  push(out, RECORD_TAG);
+  push(out, 0);
+  out.extend_from_slice(&hash.to_le_bytes());
+  push(out, source_len as u32);
+  match res {
+    Ok(columns) => {
+      let (imports, exports) = (&columns.imports, &columns.exports);
+      push(out, imports.len() as u32);
+      push(out, exports.len() as u32);
+      for i in 0..imports.len() {
+        push(out, imports.start[i]);
+        push(out, imports.end[i]);
+        push(out, imports.statement_start[i]);
+        push(out, imports.statement_end[i]);
+        push(out, imports.assert_index[i]);
+        push(out, imports.dynamic_start[i]);
+        // the kind, with the escaped flag in bit 8
+        push(out, kind_code(imports.kind[i]) | (imports.escaped[i] as u32) << 8);
+      }
+      for i in 0..exports.len() {
+        push(out, exports.start[i]);
+        push(out, exports.end[i]);
+        push(out, exports.local_start[i]);
+        push(out, exports.local_end[i]);
+      }
+    }
+    Err(offset) => {
+      push(out, NONE);
+      push(out, *offset as u32);
+    }
+  }
+  let len = (out.len() - start + 4) as u32;
+  out[start + 4..start + 8].copy_from_slice(&len.to_le_bytes());
+  let checksum = xxh3_64(&out[start..]) as u32;
+  push(out, checksum);
+}
+
+/// Reads the record at the start of `record` back as a result for `code`.
+fn decode<'a>(record: &[u8], code: &'a str) -> Option<Result<ModuleColumns<'a>, usize>> {
+  if read_u32(record, 24) as usize != code.len() {
+    return None;
+  }
+  let import_count = read_u32(record, 28);
+  if import_count == NONE {
+    return Some(Err(read_u32(record, 32) as usize));
+  }
+  let export_count = read_u32(record, 32) as usize;
+
+  let mut columns = ModuleColumns {
+    source: code,
+    ..Default::default()
+  };
+  let mut words = record[36..].chunks_exact(4).map(|w| u32::from_le_bytes(w.try_into().unwrap()));
+  let mut next = || words.next().unwrap();
+  let imports = &mut columns.imports;
+  for _ in 0..import_count {
+    imports.start.push(next());
+    imports.end.push(next());
+    imports.statement_start.push(next());
+    imports.statement_end.push(next());
+    imports.assert_index.push(next());
+    imports.dynamic_start.push(next());
+    let kind = next();
+    imports.kind.push(kind_from_code(kind & 0xff)?);
+    imports.escaped.push(kind & 0x100 != 0);
+  }
+  let exports = &mut columns.exports;
+  for _ in 0..export_count {
+    exports.start.push(next());
+    exports.end.push(next());
+    exports.local_start.push(next());
+    exports.local_end.push(next());
+  }
+  Some(Ok(columns))
+}
+
+/// Iterates over the well-formed records of `bytes` from `offset`, stopping
+/// at the first torn, partially written or corrupt one.
+struct Records<'a> {
+  bytes: &'a [u8],
+  offset: usize,
+}
+
+impl<'a> Records<'a> {
+  fn new(bytes: &'a [u8], offset: usize) -> Self {
+    Records { bytes, offset }
+  }
+}
+
+impl<'a> Iterator for Records<'a> {
+  type Item = &'a [u8];
+
+  fn next(&mut self) -> Option<&'a [u8]> {
+    let rest = &self.bytes[self.offset..];
+    if rest.len() < RECORD_FIXED_LEN || read_u32(rest, 0) != RECORD_TAG {
+      return None;
+    }
+    let len = read_u32(rest, 4) as usize;
+    if len < RECORD_FIXED_LEN || len > rest.len() || len % 4 != 0 {
+      return None;
+    }
+    let import_count = read_u32(rest, 28);
+    let words = if import_count == NONE {
+      0
+    } else {
+      import_count as usize * IMPORT_WORDS + read_u32(rest, 32) as usize * EXPORT_WORDS
+    };
+    if len != RECORD_FIXED_LEN + words * 4 || xxh3_64(&rest[..len - 4]) as u32 != read_u32(rest, len - 4) {
+      return None;
+    }
+    self.offset += len;
+    Some(&rest[..len])
+  }
+}
+
+/// An exclusive lock on the cache directory, held while writing the index.
+#[cfg(unix)]
+struct Lock(File);
+
+#[cfg(unix)]
+impl Lock {
+  fn acquire(path: &Path) -> io::Result<Self> {
+    use std::os::unix::io::AsRawFd;
+    let file = OpenOptions::new().create(true).write(true).open(path)?;
+    loop {
+      if unsafe { libc::flock(file.as_raw_fd(), libc::LOCK_EX) } == 0 {
+        return Ok(Lock(file));
+      }
+      let err = io::Error::last_os_error();
+      if err.kind() != io::ErrorKind::Interrupted {
+        return Err(err);
+      }
+    }
+  }
+}
+
+#[cfg(not(unix))]
+struct Lock;
+
+#[cfg(not(unix))]
+impl Lock {
+  fn acquire(_path: &Path) -> io::Result<Self> {
+    Ok(Lock)
+  }
+}
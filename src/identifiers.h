@@ -0,0 +1,391 @@
+// Generated by `chomp src/identifiers.h` from the ID_Start and ID_Continue
+// properties of Unicode 16.0, do not edit.
+//
+// Two level bitmaps of the code points that start and continue a JavaScript
+// identifier. identifierBlocks maps each block of 256 code points below
+// IDENTIFIER_BLOCKS << 8 to its row of 256 bits in identifierStartBits and
+// identifierPartBits, with equal blocks sharing a row.
+
+#define IDENTIFIER_BLOCKS 3586
+
+static const uint8_t identifierBlocks[IDENTIFIER_BLOCKS] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 2, 18, 19, 20, 2, 21, 22, 23, 24, 25, 26, 27, 28, 2, 29,
+  30, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 33, 0, 0, 34, 35, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 37, 2, 38, 39, 40, 41, 42, 43, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 44, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 45, 46, 2, 47, 48, 49,
+  50, 51, 52, 53, 54, 55, 2, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  2, 2, 2, 81, 82, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 2, 2, 2, 2, 85, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 86, 2, 2, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 88, 0, 0, 0, 0, 0, 0, 2, 2, 89, 90, 0, 91, 92, 93, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 94, 2, 2, 2, 2, 95, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 2, 98, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 102, 0, 103, 104, 0, 105, 106, 107, 108, 0, 0, 109, 0, 0, 0, 0, 110,
+  111, 112, 113, 0, 114, 115, 0, 116, 117, 118, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 120, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 121, 122, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 123, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 124, 2, 2, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 126, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 127, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 129
+};
+
+static const uint32_t identifierStartBits[130][8] = {
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x10, 0x87fffffe, 0x7fffffe, 0x0, 0x4200400, 0xff7fffff, 0xff7fffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3ffc3, 0x501f },
+  { 0x0, 0x0, 0x0, 0xbcdf0000, 0xffffd740, 0xfffffffb, 0xffffffff, 0xffbfffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffc03, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xfffeffff, 0x27fffff, 0xffffffff, 0x1ff, 0x0, 0xffff0000, 0x787ff },
+  { 0x0, 0xffffffff, 0x7ff, 0xfffec000, 0xffffffff, 0xffffffff, 0x2fffff, 0x9c00c060 },
+  { 0xfffd0000, 0xffff, 0xffffe000, 0xffffffff, 0xffffffff, 0x2003f, 0xfffffc00, 0x43007ff },
+  { 0x43fffff, 0x110, 0x1ffffff, 0xffff07ff, 0x7eff, 0xffffffff, 0x3ff, 0x0 },
+  { 0xfffffff0, 0x23ffffff, 0xff010000, 0xfffe0003, 0xfff99fe1, 0x23c5fdff, 0xb0004000, 0x10030003 },
+  { 0xfff987e0, 0x36dfdff, 0x5e000000, 0x1c0000, 0xfffbbfe0, 0x23edfdff, 0x10000, 0x2000003 },
+  { 0xfff99fe0, 0x23edfdff, 0xb0000000, 0x20003, 0xd63dc7e8, 0x3ffc718, 0x10000, 0x0 },
+  { 0xfffddfe0, 0x23fffdff, 0x27000000, 0x3, 0xfffddfe1, 0x23effdff, 0x60000000, 0x60003 },
+  { 0xfffddff0, 0x27ffffff, 0x80704000, 0xfc000003, 0xfc7fffe0, 0x2ffbffff, 0x7f, 0x0 },
+  { 0xfffffffe, 0xdffff, 0x7f, 0x0, 0xfffff7d6, 0x200dffaf, 0xf000005f, 0x0 },
+  { 0x1, 0x0, 0xfffffeff, 0x1fff, 0x1f00, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0x800007ff, 0x3c3f0000, 0xffe1c062, 0x4003, 0xffffffff, 0xffff20bf, 0xf7ffffff },
+  { 0xffffffff, 0xffffffff, 0x3d7f3dff, 0xffffffff, 0xffff3dff, 0x7f3dffff, 0xff7fff3d, 0xffffffff },
+  { 0xff3dffff, 0xffffffff, 0x7ffffff, 0x0, 0xffff, 0xffffffff, 0xffffffff, 0x3f3fffff },
+  { 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffff9fff, 0x7fffffe, 0xffffffff, 0xffffffff, 0x1ffc7ff },
+  { 0x8003ffff, 0x3ffff, 0x3ffff, 0x1dfff, 0xffffffff, 0xfffff, 0x10800000, 0x0 },
+  { 0x0, 0xffffffff, 0xffffffff, 0x1ffffff, 0xffffffff, 0xffff05ff, 0xffffffff, 0x3fffff },
+  { 0x7fffffff, 0x0, 0xffff0000, 0x1f3fff, 0xffffffff, 0xffff0fff, 0x3ff, 0x0 },
+  { 0x7fffff, 0xffffffff, 0x1fffff, 0x0, 0x0, 0x80, 0x0, 0x0 },
+  { 0xffffffe0, 0xfffff, 0x1fe0, 0x0, 0xfffffff8, 0xfc00c001, 0xffffffff, 0x3f },
+  { 0xffffffff, 0xf, 0xfc00e000, 0x3fffffff, 0xffff07ff, 0xe7ffffff, 0x0, 0x46fde00 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0, 0x0 },
+  { 0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff, 0xffffffff, 0x5fdfffff, 0xfcf1fdc, 0x1fdc1fff },
+  { 0x0, 0x0, 0x0, 0x80020000, 0x1fff0000, 0x0, 0x0, 0x0 },
+  { 0x3f2ffc84, 0xf3fffd50, 0x43e0, 0xffffffff, 0x1ff, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xc781f },
+  { 0xffffffff, 0xffff20bf, 0xffffffff, 0x80ff, 0x7fffff, 0x7f7f7f7f, 0x7f7f7f7f, 0x0 },
+  { 0xe0, 0x1f3e03fe, 0xfffffffe, 0xffffffff, 0xf87fffff, 0xfffffffe, 0xffffffff, 0xf7ffffff },
+  { 0xffffffe0, 0xfffeffff, 0xffffffff, 0xffffffff, 0x7fff, 0xffffffff, 0x0, 0xffff0000 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fff, 0x0, 0xffff0000, 0x3fffffff },
+  { 0xffff1fff, 0xc00, 0xffffffff, 0x80007fff, 0x3fffffff, 0xffffffff, 0xffffffff, 0xffff },
+  { 0xff800000, 0xfffffffc, 0xffffffff, 0xffffffff, 0xfffff9ff, 0xffffffff, 0x1feb3fff, 0xfffc0000 },
+  { 0xfffff7bb, 0x7, 0xffffffff, 0xfffff, 0xfffffffc, 0xfffff, 0x0, 0x68fc0000 },
+  { 0xfffffc00, 0xffff003f, 0x7f, 0x1fffffff, 0xfffffff0, 0x7ffff, 0x8000, 0x7c00ffdf },
+  { 0xffffffff, 0x1ff, 0xff7, 0xc47fffff, 0xffffffff, 0x3e62ffff, 0x38000005, 0x1c07ff },
+  { 0x7e7e7e, 0xffff7f7f, 0xf7ffffff, 0xffff03ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x7 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff000f, 0xfffff87f, 0xfffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffff3fff, 0xffffffff, 0xffffffff, 0x3ffffff, 0x0 },
+  { 0xa0f8007f, 0x5f7ffdff, 0xffffffdb, 0xffffffff, 0xffffffff, 0x3ffff, 0xfff80000, 0xffffffff },
+  { 0xffffffff, 0x3fffffff, 0xffff0000, 0xffffffff, 0xfffcffff, 0xffffffff, 0xff, 0xfff0000 },
+  { 0x0, 0x0, 0x0, 0xffdf0000, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fffffff },
+  { 0x0, 0x7fffffe, 0x7fffffe, 0xffffffc0, 0xffffffff, 0x7fffffff, 0x1cfcfcfc, 0x0 },
+  { 0xffffefff, 0xb7ffff7f, 0x3fff3fff, 0x0, 0xffffffff, 0xffffffff, 0xffffffff, 0x7ffffff },
+  { 0x0, 0x0, 0xffffffff, 0x1fffff, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x1fffffff, 0xffffffff, 0x1ffff, 0x0 },
+  { 0xffffffff, 0xffffe000, 0xffff07ff, 0x3fffff, 0x3fffffff, 0xffffffff, 0x3eff0f, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, 0xffff0000, 0xff0fffff, 0xfffffff },
+  { 0xffffffff, 0xffff00ff, 0xffffffff, 0xf7ff000f, 0xffb7f7ff, 0x1bfbfffb, 0xffffffff, 0xfffff },
+  { 0xffffffff, 0x7fffff, 0x3fffff, 0xff, 0xffffffbf, 0x7fdffff, 0x0, 0x0 },
+  { 0xfffffd3f, 0x91bfffff, 0x3fffff, 0x7fffff, 0x7fffffff, 0x0, 0x0, 0x37ffff },
+  { 0x3fffff, 0x3ffffff, 0x0, 0x0, 0xffffffff, 0xc0ffffff, 0x0, 0x0 },
+  { 0xfeef0001, 0x3fffff, 0x0, 0x1fffffff, 0x1fffffff, 0x0, 0xfffffeff, 0x1f },
+  { 0xffffffff, 0x3fffff, 0x3fffff, 0x7ffff, 0x3ffff, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0x1ff, 0x0, 0xffffffff, 0x7ffff, 0xffffffff, 0x7ffff },
+  { 0xffffffff, 0xf, 0xfffffc00, 0xffff803f, 0x3f, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x303ff, 0x1c, 0x0 },
+  { 0x1fffffff, 0xffff0080, 0x3f, 0xffff0000, 0x3, 0xffff0000, 0x1f, 0x7fffff },
+  { 0xfffffff8, 0xffffff, 0x0, 0x260000, 0xfffffff8, 0xffff, 0xffff0000, 0x1ff },
+  { 0xfffffff8, 0x7f, 0xffff0090, 0x47ffff, 0xfffffff8, 0x7ffff, 0x1400001e, 0x0 },
+  { 0xfffbffff, 0x80000fff, 0x1, 0x0, 0xbfffbd7f, 0xffff01ff, 0x7fffffff, 0x0 },
+  { 0xfff99fe0, 0x23edfdff, 0xe0010000, 0x3, 0xffff4bff, 0xbfffff, 0xa0000, 0x0 },
+  { 0xffffffff, 0x1fffff, 0x80000780, 0x3, 0xffffffff, 0xffff, 0xb0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x7fff, 0xf000000, 0x0 },
+  { 0xffffffff, 0xffff, 0x10, 0x0, 0xffffffff, 0x10007ff, 0x0, 0x0 },
+  { 0x7ffffff, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xfff, 0x0, 0x0, 0x0, 0xffffffff, 0xffffffff, 0x80000000 },
+  { 0xff6ff27f, 0x8000ffff, 0x2, 0x0, 0x0, 0xfffffcff, 0x1ffff, 0xa },
+  { 0xfffff801, 0x407ffff, 0xf0010000, 0xffffffff, 0x200003ff, 0xffff0000, 0xffffffff, 0x1ffffff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x1 },
+  { 0xfffffdff, 0x7fff, 0x1, 0xfffc0000, 0xffff, 0x0, 0x0, 0x0 },
+  { 0xfffffb7f, 0x1ffff, 0x40, 0xfffffdbf, 0x10003ff, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7ffff },
+  { 0xfffdfff4, 0xfffff, 0x0, 0x0, 0x0, 0x10000, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3ffffff, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0x7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0xffffffff, 0xffffffff, 0x1ffff },
+  { 0xffffffff, 0xffff, 0x7e, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x7ffffff },
+  { 0xffffffff, 0xffffffff, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x3fffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0x1ffffff, 0x7fffffff, 0xffff0000, 0xffffffff, 0x7fffffff, 0xffff0000, 0x3fff },
+  { 0xffffffff, 0xffff, 0xf, 0xe0fffff8, 0xffff, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0xffffffff, 0x1fff, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0xffffffff, 0xffffffff, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0x107ff, 0x0, 0xfff80000, 0x0, 0x0, 0xb },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffff, 0x80000000 },
+  { 0x1ff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6fef0000 },
+  { 0xffffffff, 0x40007, 0x270000, 0xffff00f0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0x1fff07ff, 0x3ff01ff, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffdfffff, 0xffffffff, 0xdfffffff, 0xebffde64, 0xffffffef, 0xffffffff },
+  { 0xdfdfe7bf, 0x7bffffff, 0xfffdfc5f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff3f, 0xf7fffffd, 0xf7ffffff },
+  { 0xffdfffff, 0xffdfffff, 0xffff7fff, 0xffff7fff, 0xfffffdff, 0xfffffdff, 0xff7, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x7fffffff, 0x7e0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0xffff0000, 0xffffffff, 0x3fff, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0x3f801fff, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0x3fff, 0xffffffff, 0xfff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0xfff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0x13fff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7fff6f7f },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x1f, 0x0 },
+  { 0xffffffff, 0xffffffff, 0x80f, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffef, 0xaf7fe96, 0xaa96ea84, 0x5ef7f796, 0xffffbff, 0xffffbee, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0 },
+  { 0xffffffff, 0x3ffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff0003, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff0001 },
+  { 0xffffffff, 0xffffffff, 0x3fffffff, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x3fffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffff07ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 }
+};
+
+static const uint32_t identifierPartBits[130][8] = {
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x3ff0010, 0x87fffffe, 0x7fffffe, 0x0, 0x4a00400, 0xff7fffff, 0xff7fffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3ffc3, 0x501f },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xbcdfffff, 0xffffd7c0, 0xfffffffb, 0xffffffff, 0xffbfffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffcfb, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xfffeffff, 0x27fffff, 0xffffffff, 0xfffe01ff, 0xbfffffff, 0xffff00b6, 0x787ff },
+  { 0x7ff0000, 0xffffffff, 0xffffffff, 0xffffc3ff, 0xffffffff, 0xffffffff, 0x9fefffff, 0x9ffffdff },
+  { 0xffff0000, 0xffffffff, 0xffffe7ff, 0xffffffff, 0xffffffff, 0x3ffff, 0xffffffff, 0x243fffff },
+  { 0xffffffff, 0x3fff, 0xfffffff, 0xffff07ff, 0xff807eff, 0xffffffff, 0xffffffff, 0xfffffffb },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xfffeffcf, 0xfff99fef, 0xf3c5fdff, 0xb080799f, 0x5003ffcf },
+  { 0xfff987ee, 0xd36dfdff, 0x5e023987, 0x3fffc0, 0xfffbbfee, 0xf3edfdff, 0x13bbf, 0xfe00ffcf },
+  { 0xfff99fee, 0xf3edfdff, 0xb0e0399f, 0x2ffcf, 0xd63dc7ec, 0xc3ffc718, 0x813dc7, 0xffc0 },
+  { 0xfffddfff, 0xf3fffdff, 0x27603ddf, 0xffcf, 0xfffddfef, 0xf3effdff, 0x60603ddf, 0xeffcf },
+  { 0xfffddfff, 0xffffffff, 0x80f07ddf, 0xfc00ffcf, 0xfc7fffee, 0x2ffbffff, 0xff5f847f, 0xcffc0 },
+  { 0xfffffffe, 0x7ffffff, 0x3ff7fff, 0x0, 0xfffff7d6, 0x3fffffaf, 0xf3ff7f5f, 0x0 },
+  { 0x3000001, 0xc2a003ff, 0xfffffeff, 0xfffe1fff, 0xfeffffdf, 0x1fffffff, 0x40, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffff03ff, 0xffffffff, 0x3fffffff, 0xffffffff, 0xffff20bf, 0xf7ffffff },
+  { 0xffffffff, 0xffffffff, 0x3d7f3dff, 0xffffffff, 0xffff3dff, 0x7f3dffff, 0xff7fff3d, 0xffffffff },
+  { 0xff3dffff, 0xffffffff, 0xe7ffffff, 0x3fe00, 0xffff, 0xffffffff, 0xffffffff, 0x3f3fffff },
+  { 0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffff9fff, 0x7fffffe, 0xffffffff, 0xffffffff, 0x1ffc7ff },
+  { 0x803fffff, 0x1fffff, 0xfffff, 0xddfff, 0xffffffff, 0xffffffff, 0x308fffff, 0x3ff },
+  { 0x3ffb800, 0xffffffff, 0xffffffff, 0x1ffffff, 0xffffffff, 0xffff07ff, 0xffffffff, 0x3fffff },
+  { 0x7fffffff, 0xfff0fff, 0xffffffc0, 0x1f3fff, 0xffffffff, 0xffff0fff, 0x7ff03ff, 0x0 },
+  { 0xfffffff, 0xffffffff, 0x7fffffff, 0x9fffffff, 0x3ff03ff, 0xbfff0080, 0x7fff, 0x0 },
+  { 0xffffffff, 0xffffffff, 0x3ff1fff, 0xff800, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffff },
+  { 0xffffffff, 0xffffff, 0xffffe3ff, 0x3fffffff, 0xffff07ff, 0xe7ffffff, 0xfff70000, 0x7ffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0x3f3fffff, 0xffffffff, 0xaaff3f3f, 0x3fffffff, 0xffffffff, 0x5fdfffff, 0xfcf1fdc, 0x1fdc1fff },
+  { 0x3000, 0x80000000, 0x100001, 0x80020000, 0x1fff0000, 0x0, 0x1fff0000, 0x1ffe2 },
+  { 0x3f2ffc84, 0xf3fffd50, 0x43e0, 0xffffffff, 0x1ff, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff81f },
+  { 0xffffffff, 0xffff20bf, 0xffffffff, 0x800080ff, 0x7fffff, 0x7f7f7f7f, 0x7f7f7f7f, 0xffffffff },
+  { 0xe0, 0x1f3efffe, 0xfffffffe, 0xffffffff, 0xfe7fffff, 0xfffffffe, 0xffffffff, 0xffffffff },
+  { 0xffffffe0, 0xfffeffff, 0xffffffff, 0xffffffff, 0x7fff, 0xffffffff, 0x0, 0xffff0000 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fff, 0x0, 0xffff0000, 0x3fffffff },
+  { 0xffff1fff, 0xfff, 0xffffffff, 0xbff0ffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3ffff },
+  { 0xff800000, 0xfffffffc, 0xffffffff, 0xffffffff, 0xfffff9ff, 0xffffffff, 0x1feb3fff, 0xfffc0000 },
+  { 0xffffffff, 0x10ff, 0xffffffff, 0xfffff, 0xffffffff, 0xffffffff, 0x3ff003f, 0xe8ffffff },
+  { 0xffffffff, 0xffff3fff, 0xfffff, 0x1fffffff, 0xffffffff, 0xffffffff, 0x3ff8001, 0x7fffffff },
+  { 0xffffffff, 0x7fffff, 0x3ff3fff, 0xfc7fffff, 0xffffffff, 0xffffffff, 0x38000007, 0x7cffff },
+  { 0x7e7e7e, 0xffff7f7f, 0xf7ffffff, 0xffff03ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3ff37ff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff000f, 0xfffff87f, 0xfffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffff3fff, 0xffffffff, 0xffffffff, 0x3ffffff, 0x0 },
+  { 0xe0f8007f, 0x5f7ffdff, 0xffffffdb, 0xffffffff, 0xffffffff, 0x3ffff, 0xfff80000, 0xffffffff },
+  { 0xffffffff, 0x3fffffff, 0xffff0000, 0xffffffff, 0xfffcffff, 0xffffffff, 0xff, 0xfff0000 },
+  { 0xffff, 0x18ffff, 0xe000, 0xffdf0000, 0xffffffff, 0xffffffff, 0xffffffff, 0x1fffffff },
+  { 0x3ff0000, 0x87fffffe, 0x7fffffe, 0xffffffe0, 0xffffffff, 0x7fffffff, 0x1cfcfcfc, 0x0 },
+  { 0xffffefff, 0xb7ffff7f, 0x3fff3fff, 0x0, 0xffffffff, 0xffffffff, 0xffffffff, 0x7ffffff },
+  { 0x0, 0x0, 0xffffffff, 0x1fffff, 0x0, 0x0, 0x0, 0x20000000 },
+  { 0x0, 0x0, 0x0, 0x0, 0x1fffffff, 0xffffffff, 0x1ffff, 0x1 },
+  { 0xffffffff, 0xffffe000, 0xffff07ff, 0x7ffffff, 0x3fffffff, 0xffffffff, 0x3eff0f, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffffff, 0xffff03ff, 0xff0fffff, 0xfffffff },
+  { 0xffffffff, 0xffff00ff, 0xffffffff, 0xf7ff000f, 0xffb7f7ff, 0x1bfbfffb, 0xffffffff, 0xfffff },
+  { 0xffffffff, 0x7fffff, 0x3fffff, 0xff, 0xffffffbf, 0x7fdffff, 0x0, 0x0 },
+  { 0xfffffd3f, 0x91bfffff, 0x3fffff, 0x7fffff, 0x7fffffff, 0x0, 0x0, 0x37ffff },
+  { 0x3fffff, 0x3ffffff, 0x0, 0x0, 0xffffffff, 0xc0ffffff, 0x0, 0x0 },
+  { 0xfeeff06f, 0x873fffff, 0x0, 0x1fffffff, 0x1fffffff, 0x0, 0xfffffeff, 0x7f },
+  { 0xffffffff, 0x3fffff, 0x3fffff, 0x7ffff, 0x3ffff, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0x1ff, 0x0, 0xffffffff, 0x7ffff, 0xffffffff, 0x7ffff },
+  { 0xffffffff, 0x3ff00ff, 0xffffffff, 0xffffbe3f, 0x3f, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x31bff, 0x1c, 0xf0000000 },
+  { 0x1fffffff, 0xffff0080, 0x1ffff, 0xffff0000, 0x3f, 0xffff0000, 0x1f, 0x7fffff },
+  { 0xffffffff, 0xffffffff, 0x7f, 0x803fffc0, 0xffffffff, 0x7ffffff, 0xffff0004, 0x3ff01ff },
+  { 0xffffffff, 0xffdfffff, 0xffff00f0, 0x4fffff, 0xffffffff, 0xffffffff, 0x17ffde1f, 0x0 },
+  { 0xfffbffff, 0xc0ffffff, 0x3, 0x0, 0xbfffbd7f, 0xffff01ff, 0xffffffff, 0x3ff07ff },
+  { 0xfff99fef, 0xfbedfdff, 0xe081399f, 0x1f1fcf, 0xffff4bff, 0xffbfffff, 0xff7a5, 0x6 },
+  { 0xffffffff, 0xffffffff, 0xc3ff07ff, 0x3, 0xffffffff, 0xffffffff, 0x3ff00bf, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0xff3fffff, 0x3f000001, 0x0 },
+  { 0xffffffff, 0xffffffff, 0x3ff0011, 0x0, 0xffffffff, 0x1ffffff, 0xffff03ff, 0xf },
+  { 0xe7ffffff, 0x3ff0fff, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0x7ffffff, 0x0, 0x0, 0x0, 0xffffffff, 0xffffffff, 0x800003ff },
+  { 0xff6ff27f, 0xf9bfffff, 0x3ff000f, 0x0, 0x0, 0xfffffcff, 0xfcffffff, 0x1b },
+  { 0xffffffff, 0x7fffffff, 0xffff0080, 0xffffffff, 0x23ffffff, 0xffff0000, 0xffffffff, 0x1ffffff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffffffff, 0x3ff0001 },
+  { 0xfffffdff, 0xff7fffff, 0x3ff0001, 0xfffc0000, 0xfffcffff, 0x7ffeff, 0x0, 0x0 },
+  { 0xfffffb7f, 0xb47fffff, 0x3ff00ff, 0xfffffdbf, 0x1fb7fff, 0x3ff, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7fffff },
+  { 0xfffdffff, 0xc7ffffff, 0x7ff0007, 0x0, 0x0, 0x10000, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3ffffff, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0x7fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0xffffffff, 0xffffffff, 0x1ffff },
+  { 0xffffffff, 0xffff, 0x3fffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x7ffffff },
+  { 0xffffffff, 0xffffffff, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0x3ffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0x1ffffff, 0x7fffffff, 0xffff03ff, 0xffffffff, 0x7fffffff, 0xffff03ff, 0x1f3fff },
+  { 0xffffffff, 0x7fffff, 0x3ff000f, 0xe0fffff8, 0xffff, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0xffffffff, 0x3ff1fff, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0xffffffff, 0xffffffff, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffff87ff, 0xffffffff, 0xffff80ff, 0x0, 0x0, 0x3001b },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x3fffff, 0x80000000 },
+  { 0x1ff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6fef0000 },
+  { 0xffffffff, 0x40007, 0x270000, 0xffff00f0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0x1fff07ff, 0x63ff01ff, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3ff0000 },
+  { 0xffffffff, 0xffff3fff, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0xf807e3e0, 0xfe7, 0x3c00, 0x0, 0x0 },
+  { 0x0, 0x0, 0x1c, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffdfffff, 0xffffffff, 0xdfffffff, 0xebffde64, 0xffffffef, 0xffffffff },
+  { 0xdfdfe7bf, 0x7bffffff, 0xfffdfc5f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffff3f, 0xf7fffffd, 0xf7ffffff },
+  { 0xffdfffff, 0xffdfffff, 0xffff7fff, 0xffff7fff, 0xfffffdff, 0xfffffdff, 0xffffcff7, 0xffffffff },
+  { 0xffffffff, 0xf87fffff, 0xffffffff, 0x201fff, 0xf8000010, 0xfffe, 0x0, 0x0 },
+  { 0x7fffffff, 0x7e0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xf9ffff7f, 0xffff07db, 0xffffffff, 0x3fff, 0x8000, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0x3fff1fff, 0x43ff, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0x7fff, 0xffffffff, 0x3ffffff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0x3ffffff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xffff0000, 0x7ffffff },
+  { 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7fff6f7f },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x7f001f, 0x0 },
+  { 0xffffffff, 0xffffffff, 0x3ff0fff, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffef, 0xaf7fe96, 0xaa96ea84, 0x5ef7f796, 0xffffbff, 0xffffbee, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0 },
+  { 0xffffffff, 0x3ffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0x3fffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff0003, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff0001 },
+  { 0xffffffff, 0xffffffff, 0x3fffffff, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0x3fffffff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffff07ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff, 0x0, 0x0 },
+  { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff }
+};
@@ -0,0 +1,208 @@
+//! Specifier interning shared by the threads of a batch.
+//!
+//! Every distinct specifier is stored once and named by a [`Symbol`], a `u32`
+//! that stays the same for the life of the interner, so downstream tables can
+//! key on integers instead of strings. Each entry also keeps a 64-bit hash of
+//! its text, computed once when it is first interned.
+//!
+//! The table is split into shards by hash, each behind its own read-write
+//! lock. Lookups of specifiers that are already interned, by far the common
+//! case across a build, only take a shard's read lock.
+
+use crate::{Import, ImportKind};
+use std::sync::{RwLock, RwLockReadGuard};
+
+const SHARD_BITS: u32 = 4;
+const SHARDS: usize = 1 << SHARD_BITS;
+const EMPTY: u32 = u32::MAX;
+
+/// An interned specifier.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
+pub struct Symbol(u32);
+
+impl Symbol {
+  /// The symbol's ID. IDs are not dense: the low bits select a shard.
+  pub fn id(self) -> u32 {
+    self.0
+  }
+
+  fn shard(self) -> usize {
+    self.0 as usize & (SHARDS - 1)
+  }
+
+  fn index(self) -> usize {
+    (self.0 >> SHARD_BITS) as usize
+  }
+}
+
+#[inline]
+fn mum(a: u64, b: u64) -> u64 {
+  let r = a as u128 * b as u128;
+  (r as u64) ^ (r >> 64) as u64
+}
+
+/// The hash [`Interner::hash`] reports for a specifier. It only depends on
+/// the text, so it is the same across processes and platforms.
+pub fn hash_specifier(specifier: &str) -> u64 {
+  const K0: u64 = 0x9e37_79b9_7f4a_7c15;
+  const K1: u64 = 0xbf58_476d_1ce4_e5b9;
+  let bytes = specifier.as_bytes();
+  let mut h = K0 ^ bytes.len() as u64;
+  let mut chunks = bytes.chunks_exact(8);
+  for chunk in &mut chunks {
+    h = mum(h ^ u64::from_le_bytes(chunk.try_into().unwrap()), K1);
+  }
+  let mut tail = [0u8; 8];
+  tail[..chunks.remainder().len()].copy_from_slice(chunks.remainder());
+  h = mum(h ^ u64::from_le_bytes(tail), K1 ^ chunks.remainder().len() as u64);
+  mum(h, K0)
+}
+
+struct Entry {
+  hash: u64,
+  text: Box<str>,
+}
+
+/// One shard: entries in insertion order, indexed by an open addressing
+/// table of entry indices.
+#[derive(Default)]
+struct Shard {
+  slots: Vec<u32>,
+  entries: Vec<Entry>,
+}
+
+impl Shard {
+  fn find(&self, hash: u64, text: &str) -> Option<usize> {
+    if self.slots.is_empty() {
+      return None;
+    }
+    let mask = self.slots.len() - 1;
+    let mut slot = hash as usize & mask;
+    loop {
+      let index = self.slots[slot];
+      if index == EMPTY {
+        return None;
+      }
+      let entry = &self.entries[index as usize];
+      if entry.hash == hash && &*entry.text == text {
+        return Some(index as usize);
+      }
+      slot = (slot + 1) & mask;
+    }
+  }
+
+  fn insert(&mut self, hash: u64, text: &str) -> usize {
+    // keep the table at most half full
+    if (self.entries.len() + 1) * 2 > self.slots.len() {
+      self.grow();
+    }
+    let index = self.entries.len();
+    assert!(index < (u32::MAX >> SHARD_BITS) as usize, "interner shard is full");
+    self.entries.push(Entry { hash, text: text.into() });
+    self.place(hash, index as u32);
+    index
+  }
+
+  fn place(&mut self, hash: u64, index: u32) {
+    let mask = self.slots.len() - 1;
+    let mut slot = hash as usize & mask;
+    while self.slots[slot] != EMPTY {
+      slot = (slot + 1) & mask;
+    }
+    self.slots[slot] = index;
+  }
+
+  fn grow(&mut self) {
+    self.slots = vec![EMPTY; (self.slots.len() * 2).max(64)];
+    for index in 0..self.entries.len() {
+      self.place(self.entries[index].hash, index as u32);
+    }
+  }
+}
+
+/// A concurrent specifier interner, shared by reference between threads.
+pub struct Interner {
+  shards: Box<[RwLock<Shard>]>,
+}
+
+impl Interner {
+  pub fn new() -> Self {
+    Interner {
+      shards: (0..SHARDS).map(|_| RwLock::default()).collect(),
+    }
+  }
+
+  /// Returns the symbol for `specifier`, interning it on first use.
+  pub fn intern(&self, specifier: &str) -> Symbol {
+    let hash = hash_specifier(specifier);
+    let shard = shard_of(hash);
+    if let Some(index) = self.read(shard).find(hash, specifier) {
+      return symbol(shard, index);
+    }
+    let mut table = self.shards[shard].write().unwrap_or_else(|e| e.into_inner());
+    // another thread may have interned it between the two locks
+    let index = match table.find(hash, specifier) {
+      Some(index) => index,
+      None => table.insert(hash, specifier),
+    };
+    symbol(shard, index)
+  }
+
+  /// Interns the unescaped specifier of `import`, or returns `None` for
+  /// `import.meta` and dynamic imports of an expression.
+  pub fn intern_import(&self, import: &Import) -> Option<Symbol> {
+    match import.kind() {
+      ImportKind::Standard | ImportKind::DynamicString => Some(self.intern(&import.specifier())),
+      ImportKind::Meta | ImportKind::DynamicExpression => None,
+    }
+  }
+
+  /// The symbol for `specifier`, if it has been interned.
+  pub fn get(&self, specifier: &str) -> Option<Symbol> {
+    let hash = hash_specifier(specifier);
+    let shard = shard_of(hash);
+    self.read(shard).find(hash, specifier).map(|index| symbol(shard, index))
+  }
+
+  /// The text of a symbol from this interner.
+  pub fn resolve(&self, symbol: Symbol) -> &str {
+    let text: *const str = &*self.read(symbol.shard()).entries[symbol.index()].text;
+    // entries are never removed, and their text does not move when the
+    // entry vector grows, so it lives as long as the interner
+    unsafe { &*text }
+  }
+
+  /// The precomputed [`hash_specifier`] of a symbol from this interner.
+  pub fn hash(&self, symbol: Symbol) -> u64 {
+    self.read(symbol.shard()).entries[symbol.index()].hash
+  }
+
+  /// The number of distinct specifiers interned.
+  pub fn len(&self) -> usize {
+    (0..SHARDS).map(|shard| self.read(shard).entries.len()).sum()
+  }
+
+  pub fn is_empty(&self) -> bool {
+    self.len() == 0
+  }
+
+  fn read(&self, shard: usize) -> RwLockReadGuard<'_, Shard> {
+    self.shards[shard].read().unwrap_or_else(|e| e.into_inner())
+  }
+}
+
+impl Default for Interner {
+  fn default() -> Self {
+    Self::new()
+  }
+}
+
+/// Shards are chosen by the high bits of the hash, leaving the low bits
+/// for the slot within the shard.
+fn shard_of(hash: u64) -> usize {
+  (hash >> (64 - SHARD_BITS)) as usize
+}
+
+fn symbol(shard: usize, index: usize) -> Symbol {
+  Symbol((index as u32) << SHARD_BITS | shard as u32)
+}
@@ -0,0 +1,85 @@
+// Generated from src/keywords.txt by `chomp src/keywords.h`, do not edit.
+//
+// Each KW_ macro expands to a string as a little endian word, followed by its
+// length, as the last two arguments of matchAhead and readPrecedingKeywordn.
+
+// "xport" in export
+#define KW_XPORT 0x74726f7078ull, 5
+
+// "equire" in require
+#define KW_EQUIRE 0x657269757165ull, 6
+
+// "mport" in import
+#define KW_MPORT 0x74726f706dull, 5
+
+// "lass" in class
+#define KW_LASS 0x7373616cull, 4
+
+// "from" in from
+#define KW_FROM 0x6d6f7266ull, 4
+
+// "rom" in from
+#define KW_ROM 0x6d6f72ull, 3
+
+// "eta" in meta
+#define KW_ETA 0x617465ull, 3
+
+// "ssert" in assert
+#define KW_SSERT 0x7472657373ull, 5
+
+// "vo" in void
+#define KW_VO 0x6f76ull, 2
+
+// "yie" in yield
+#define KW_YIE 0x656979ull, 3
+
+// "dele" in delete
+#define KW_DELE 0x656c6564ull, 4
+
+// "instan" in instanceof
+#define KW_INSTAN 0x6e6174736e69ull, 6
+
+// "ty" in typeof
+#define KW_TY 0x7974ull, 2
+
+// "retur" in return
+#define KW_RETUR 0x7275746572ull, 5
+
+// "debugge" in debugger
+#define KW_DEBUGGE 0x65676775626564ull, 7
+
+// "awai" in await
+#define KW_AWAI 0x69617761ull, 4
+
+// "thr" in throw
+#define KW_THR 0x726874ull, 3
+
+// "while" in while
+#define KW_WHILE 0x656c696877ull, 5
+
+// "for" in for
+#define KW_FOR 0x726f66ull, 3
+
+// "if" in if
+#define KW_IF 0x6669ull, 2
+
+// "catc" in catch
+#define KW_CATC 0x63746163ull, 4
+
+// "finall" in finally
+#define KW_FINALL 0x6c6c616e6966ull, 6
+
+// "els" in else
+#define KW_ELS 0x736c65ull, 3
+
+// "brea" in break
+#define KW_BREA 0x61657262ull, 4
+
+// "contin" in continue
+#define KW_CONTIN 0x6e69746e6f63ull, 6
+
+// "sync" in async
+#define KW_SYNC 0x636e7973ull, 4
+
+// "unction" in function
+#define KW_UNCTION 0x6e6f6974636e75ull, 7
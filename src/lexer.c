@@ -1,42 +1,766 @@
 #include "lexer.h"
+#include "keywords.h"
+#include "identifiers.h"
 #include <stdio.h>
 #include <string.h>
 
-// NOTE: MESSING WITH THESE REQUIRES MANUAL ASM DICTIONARY CONSTRUCTION (via lexer.emcc.js base64 decoding)
-static const char16_t XPORT[] = { 'x', 'p', 'o', 'r', 't' };
-static const char16_t EQUIRE[] = { 'e', 'q', 'u', 'i', 'r', 'e' };
-static const char16_t MPORT[] = { 'm', 'p', 'o', 'r', 't' };
-static const char16_t LASS[] = { 'l', 'a', 's', 's' };
-static const char16_t FROM[] = { 'f', 'r', 'o', 'm' };
-static const char16_t ETA[] = { 'e', 't', 'a' };
-static const char16_t SSERT[] = { 's', 's', 'e', 'r', 't' };
-static const char16_t VO[] = { 'v', 'o' };
-static const char16_t YIE[] = { 'y', 'i', 'e' };
-static const char16_t DELE[] = { 'd', 'e', 'l', 'e' };
-static const char16_t INSTAN[] = { 'i', 'n', 's', 't', 'a', 'n' };
-static const char16_t TY[] = { 't', 'y' };
-static const char16_t RETUR[] = { 'r', 'e', 't', 'u', 'r' };
-static const char16_t DEBUGGE[] = { 'd', 'e', 'b', 'u', 'g', 'g', 'e' };
-static const char16_t AWAI[] = { 'a', 'w', 'a', 'i' };
-static const char16_t THR[] = { 't', 'h', 'r' };
-static const char16_t WHILE[] = { 'w', 'h', 'i', 'l', 'e' };
-static const char16_t FOR[] = { 'f', 'o', 'r' };
-static const char16_t IF[] = { 'i', 'f' };
-static const char16_t CATC[] = { 'c', 'a', 't', 'c' };
-static const char16_t FINALL[] = { 'f', 'i', 'n', 'a', 'l', 'l' };
-static const char16_t ELS[] = { 'e', 'l', 's' };
-static const char16_t BREA[] = { 'b', 'r', 'e', 'a' };
-static const char16_t CONTIN[] = { 'c', 'o', 'n', 't', 'i', 'n' };
-static const char16_t SYNC[] = {'s', 'y', 'n', 'c'};
-static const char16_t UNCTION[] = {'u', 'n', 'c', 't', 'i', 'o', 'n'};
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+// The first n bytes at p as a little endian word, to compare with the KW_
+// words of keywords.h. n is a constant once inlined, so this is one or two
+// loads rather than a memcmp.
+static inline uint64_t loadWord (const char16_t* p, size_t n) {
+  uint64_t word = 0;
+  memcpy(&word, p, n);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  word = __builtin_bswap64(word) >> (64 - 8 * n);
+#endif
+  return word;
+}
+
+// Lookahead that stays within the source: reads past state->end see '\0', as
+// if the source were zero padded. A stream's end is provisional, so such
+// reads also mark the current dispatch as depending on unseen input.
+static inline char16_t peekChar (State *state, const char16_t* p) {
+  if (p > state->end) {
+    state->reachedEnd = true;
+    return '\0';
+  }
+  return *p;
+}
+
+static inline bool matchAhead (State *state, const char16_t* p, uint64_t word, size_t n) {
+  if (p > state->end || (size_t)(state->end - p) < n - 1) {
+    state->reachedEnd = true;
+    return false;
+  }
+  return loadWord(p, n) == word;
+}
+
+// Static imports are only recorded by the import and export statement
+// parsers, so the limit is checked after those dispatches alone.
+static inline bool importLimitReached (State *state) {
+  return state->staticImportCount >= state->importLimit;
+}
+
+// Statement parsers that look ahead and then backtrack note how far they
+// read, as incremental lexing must not restart after a position whose
+// lexing depended on edited bytes.
+static inline void backtrack (State *state, const char16_t* pos) {
+  if (state->pos > state->readHorizon)
+    state->readHorizon = state->pos;
+  state->pos = (char16_t*)pos;
+}
+
+// Fast-skip kernels
+// These return the first position in [pos, end] that the calling routine has
+// to look at, or end when there is none. Every byte skipped is one the scalar
+// loop would have stepped over without effect, so the scalar code that follows
+// stays the single source of truth for the actual lexing decisions.
+// Vector loads stop short of end; the remaining tail is handled bytewise.
+
+#if defined(__ARM_NEON)
+// movemask equivalent, 4 bits per lane
+static inline uint64_t neonMask (uint8x16_t m) {
+  return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+}
+#endif
+
+// Finds the next occurrence of any of the five given bytes (repeat a byte
+// to search for fewer)
+static inline char16_t* scanToAny (char16_t* pos, const char16_t* end, char16_t a, char16_t b, char16_t c, char16_t d, char16_t e) {
+#if defined(__AVX2__)
+  {
+    const __m256i va = _mm256_set1_epi8((char)a), vb = _mm256_set1_epi8((char)b), vc = _mm256_set1_epi8((char)c),
+        vd = _mm256_set1_epi8((char)d), ve = _mm256_set1_epi8((char)e);
+    while (end - pos >= 32) {
+      const __m256i v = _mm256_loadu_si256((const __m256i*)pos);
+      const __m256i m = _mm256_or_si256(
+        _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb)), _mm256_or_si256(_mm256_cmpeq_epi8(v, vc), _mm256_cmpeq_epi8(v, vd))),
+        _mm256_cmpeq_epi8(v, ve)
+      );
+      const uint32_t mask = (uint32_t)_mm256_movemask_epi8(m);
+      if (mask)
+        return pos + __builtin_ctz(mask);
+      pos += 32;
+    }
+  }
+#endif
+#if defined(__SSE2__)
+  {
+    const __m128i va = _mm_set1_epi8((char)a), vb = _mm_set1_epi8((char)b), vc = _mm_set1_epi8((char)c),
+        vd = _mm_set1_epi8((char)d), ve = _mm_set1_epi8((char)e);
+    while (end - pos >= 16) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)pos);
+      const __m128i m = _mm_or_si128(
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)), _mm_or_si128(_mm_cmpeq_epi8(v, vc), _mm_cmpeq_epi8(v, vd))),
+        _mm_cmpeq_epi8(v, ve)
+      );
+      const uint32_t mask = (uint32_t)_mm_movemask_epi8(m);
+      if (mask)
+        return pos + __builtin_ctz(mask);
+      pos += 16;
+    }
+  }
+#elif defined(__ARM_NEON)
+  {
+    const uint8x16_t va = vdupq_n_u8(a), vb = vdupq_n_u8(b), vc = vdupq_n_u8(c), vd = vdupq_n_u8(d), ve = vdupq_n_u8(e);
+    while (end - pos >= 16) {
+      const uint8x16_t v = vld1q_u8(pos);
+      const uint8x16_t m = vorrq_u8(
+        vorrq_u8(vorrq_u8(vceqq_u8(v, va), vceqq_u8(v, vb)), vorrq_u8(vceqq_u8(v, vc), vceqq_u8(v, vd))),
+        vceqq_u8(v, ve)
+      );
+      const uint64_t mask = neonMask(m);
+      if (mask)
+        return pos + (__builtin_ctzll(mask) >> 2);
+      pos += 16;
+    }
+  }
+#elif defined(__wasm_simd128__)
+  {
+    const v128_t va = wasm_i8x16_splat(a), vb = wasm_i8x16_splat(b), vc = wasm_i8x16_splat(c), vd = wasm_i8x16_splat(d),
+        ve = wasm_i8x16_splat(e);
+    while (end - pos >= 16) {
+      const v128_t v = wasm_v128_load(pos);
+      const v128_t m = wasm_v128_or(
+        wasm_v128_or(wasm_v128_or(wasm_i8x16_eq(v, va), wasm_i8x16_eq(v, vb)), wasm_v128_or(wasm_i8x16_eq(v, vc), wasm_i8x16_eq(v, vd))),
+        wasm_i8x16_eq(v, ve)
+      );
+      const uint32_t mask = wasm_i8x16_bitmask(m);
+      if (mask)
+        return pos + __builtin_ctz(mask);
+      pos += 16;
+    }
+  }
+#endif
+  while (pos < end) {
+    const char16_t ch = *pos;
+    if (ch == a || ch == b || ch == c || ch == d || ch == e)
+      break;
+    pos++;
+  }
+  return pos;
+}
+
+// Whether pos starts a no-break space, C2 A0 in UTF-8
+static inline bool isNbsp (const char16_t* pos, const char16_t* end) {
+  return end - pos >= 2 && pos[0] == 0xc2 && pos[1] == 0xa0;
+}
+
+// Whether a keyword can start at pos: at the start of the source, or after
+// whitespace or punctuation other than '.'. A no-break space only counts as
+// its whole UTF-8 sequence C2 A0, as an A0 byte also ends other characters,
+// such as 丠 (E4 B8 A0).
+static inline bool keywordBoundary (const char16_t* source, const char16_t* pos) {
+  if (pos == source)
+    return true;
+  return isBrOrWsOrPunctuatorNotDot(*(pos - 1)) || pos - source >= 2 && isNbsp(pos - 2, pos);
+}
+
+// Finds the next byte that is not ASCII whitespace (isBrOrWs / isWsNotBr)
+static inline char16_t* skipAsciiWhitespace (char16_t* pos, const char16_t* end, bool br) {
+  if (pos >= end || !(br ? isBrOrWs(*pos) : isWsNotBr(*pos)))
+    return pos;
+#if defined(__AVX2__)
+  {
+    const __m256i sp = _mm256_set1_epi8(32), tab = _mm256_set1_epi8(9),
+        vt = _mm256_set1_epi8(11), ff = _mm256_set1_epi8(12), four = _mm256_set1_epi8(4);
+    while (end - pos >= 32) {
+      const __m256i v = _mm256_loadu_si256((const __m256i*)pos);
+      __m256i ws = _mm256_cmpeq_epi8(v, sp);
+      if (br) {
+        // 9 - 13
+        const __m256i d = _mm256_sub_epi8(v, tab);
+        ws = _mm256_or_si256(ws, _mm256_cmpeq_epi8(_mm256_min_epu8(d, four), d));
+      }
+      else {
+        ws = _mm256_or_si256(ws, _mm256_or_si256(_mm256_cmpeq_epi8(v, tab), _mm256_or_si256(_mm256_cmpeq_epi8(v, vt), _mm256_cmpeq_epi8(v, ff))));
+      }
+      const uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(ws);
+      if (mask)
+        return pos + __builtin_ctz(mask);
+      pos += 32;
+    }
+  }
+#endif
+#if defined(__SSE2__)
+  {
+    const __m128i sp = _mm_set1_epi8(32), tab = _mm_set1_epi8(9),
+        vt = _mm_set1_epi8(11), ff = _mm_set1_epi8(12), four = _mm_set1_epi8(4);
+    while (end - pos >= 16) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)pos);
+      __m128i ws = _mm_cmpeq_epi8(v, sp);
+      if (br) {
+        // 9 - 13
+        const __m128i d = _mm_sub_epi8(v, tab);
+        ws = _mm_or_si128(ws, _mm_cmpeq_epi8(_mm_min_epu8(d, four), d));
+      }
+      else {
+        ws = _mm_or_si128(ws, _mm_or_si128(_mm_cmpeq_epi8(v, tab), _mm_or_si128(_mm_cmpeq_epi8(v, vt), _mm_cmpeq_epi8(v, ff))));
+      }
+      const uint32_t mask = ~(uint32_t)_mm_movemask_epi8(ws) & 0xffff;
+      if (mask)
+        return pos + __builtin_ctz(mask);
+      pos += 16;
+    }
+  }
+#elif defined(__ARM_NEON)
+  {
+    const uint8x16_t sp = vdupq_n_u8(32), tab = vdupq_n_u8(9), vt = vdupq_n_u8(11),
+        ff = vdupq_n_u8(12), four = vdupq_n_u8(4);
+    while (end - pos >= 16) {
+      const uint8x16_t v = vld1q_u8(pos);
+      uint8x16_t ws = vceqq_u8(v, sp);
+      if (br)
+        // 9 - 13
+        ws = vorrq_u8(ws, vcleq_u8(vsubq_u8(v, tab), four));
+      else
+        ws = vorrq_u8(ws, vorrq_u8(vceqq_u8(v, tab), vorrq_u8(vceqq_u8(v, vt), vceqq_u8(v, ff))));
+      const uint64_t mask = ~neonMask(ws);
+      if (mask)
+        return pos + (__builtin_ctzll(mask) >> 2);
+      pos += 16;
+    }
+  }
+#elif defined(__wasm_simd128__)
+  {
+    const v128_t sp = wasm_i8x16_splat(32), tab = wasm_i8x16_splat(9),
+        vt = wasm_i8x16_splat(11), ff = wasm_i8x16_splat(12), four = wasm_i8x16_splat(4);
+    while (end - pos >= 16) {
+      const v128_t v = wasm_v128_load(pos);
+      v128_t ws = wasm_i8x16_eq(v, sp);
+      if (br)
+        // 9 - 13
+        ws = wasm_v128_or(ws, wasm_u8x16_le(wasm_i8x16_sub(v, tab), four));
+      else
+        ws = wasm_v128_or(ws, wasm_v128_or(wasm_i8x16_eq(v, tab), wasm_v128_or(wasm_i8x16_eq(v, vt), wasm_i8x16_eq(v, ff))));
+      const uint32_t mask = ~wasm_i8x16_bitmask(ws) & 0xffff;
+      if (mask)
+        return pos + __builtin_ctz(mask);
+      pos += 16;
+    }
+  }
+#endif
+  while (pos < end && (br ? isBrOrWs(*pos) : isWsNotBr(*pos)))
+    pos++;
+  return pos;
+}
+
+// Finds the next byte that is not whitespace, stepping over no-break spaces
+static inline char16_t* skipWhitespace (char16_t* pos, const char16_t* end, bool br) {
+  while (isNbsp(pos = skipAsciiWhitespace(pos, end, br), end))
+    pos += 2;
+  return pos;
+}
+
+// Finds the next byte the main parse loop has to dispatch on: brackets,
+// quotes, '/', '`', or an 'e', 'i', 'r' or 'c' that may start a keyword.
+// Any other non-whitespace byte would only have moved lastTokenPos, so the last
+// such byte skipped is written back to *lastTokenPos to keep the regex /
+// division lookbehind exact. Tokens are dense enough that 16 byte blocks beat
+// 32 byte ones here.
+static inline char16_t* scanToToken (char16_t* pos, const char16_t* end, const char16_t* source, char16_t** lastTokenPos) {
+  char16_t* lastToken = *lastTokenPos;
+  // the keyword start check needs the preceding byte
+  if (pos == source)
+    return pos;
+#if defined(__SSE2__)
+  {
+    const __m128i e = _mm_set1_epi8('e'), i = _mm_set1_epi8('i'), r = _mm_set1_epi8('r'), c = _mm_set1_epi8('c'),
+        lparen = _mm_set1_epi8('('), rparen = _mm_set1_epi8(')'), lbrace = _mm_set1_epi8('{'), rbrace = _mm_set1_epi8('}'),
+        squote = _mm_set1_epi8('\''), dquote = _mm_set1_epi8('"'), slash = _mm_set1_epi8('/'), tick = _mm_set1_epi8('`'),
+        lower = _mm_set1_epi8(0x20), a = _mm_set1_epi8('a'), zero = _mm_set1_epi8('0'), underscore = _mm_set1_epi8('_'),
+        dollar = _mm_set1_epi8('$'), dot = _mm_set1_epi8('.'), sp = _mm_set1_epi8(32), tab = _mm_set1_epi8(9),
+        four = _mm_set1_epi8(4), nine = _mm_set1_epi8(9), twentyFive = _mm_set1_epi8(25);
+    while (end - pos >= 16) {
+      const __m128i v = _mm_loadu_si128((const __m128i*)pos);
+      const __m128i prev = _mm_loadu_si128((const __m128i*)(pos - 1));
+      // keyword candidates are only those not preceded by [A-Za-z0-9_$.]
+      const __m128i alpha = _mm_sub_epi8(_mm_or_si128(prev, lower), a);
+      const __m128i digit = _mm_sub_epi8(prev, zero);
+      const __m128i word = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(alpha, twentyFive), alpha), _mm_cmpeq_epi8(_mm_min_epu8(digit, nine), digit)),
+        _mm_or_si128(_mm_cmpeq_epi8(prev, underscore), _mm_or_si128(_mm_cmpeq_epi8(prev, dollar), _mm_cmpeq_epi8(prev, dot)))
+      );
+      const __m128i keyword = _mm_andnot_si128(word, _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, e), _mm_cmpeq_epi8(v, i)),
+        _mm_or_si128(_mm_cmpeq_epi8(v, r), _mm_cmpeq_epi8(v, c))
+      ));
+      const __m128i token = _mm_or_si128(keyword, _mm_or_si128(
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, lparen), _mm_cmpeq_epi8(v, rparen)), _mm_or_si128(_mm_cmpeq_epi8(v, lbrace), _mm_cmpeq_epi8(v, rbrace))),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, squote), _mm_cmpeq_epi8(v, dquote)), _mm_or_si128(_mm_cmpeq_epi8(v, slash), _mm_cmpeq_epi8(v, tick)))
+      ));
+      // 9 - 13, 32
+      const __m128i d = _mm_sub_epi8(v, tab);
+      const __m128i ws = _mm_or_si128(_mm_cmpeq_epi8(v, sp), _mm_cmpeq_epi8(_mm_min_epu8(d, four), d));
+      const uint32_t tokenMask = (uint32_t)_mm_movemask_epi8(token);
+      uint32_t nonWsMask = ~(uint32_t)_mm_movemask_epi8(ws) & 0xffff;
+      if (tokenMask) {
+        const uint32_t idx = __builtin_ctz(tokenMask);
+        nonWsMask &= (1u << idx) - 1;
+        if (nonWsMask)
+          lastToken = pos + 31 - __builtin_clz(nonWsMask);
+        *lastTokenPos = lastToken;
+        return pos + idx;
+      }
+      if (nonWsMask)
+        lastToken = pos + 31 - __builtin_clz(nonWsMask);
+      pos += 16;
+    }
+  }
+#elif defined(__ARM_NEON)
+  {
+    const uint8x16_t e = vdupq_n_u8('e'), i = vdupq_n_u8('i'), r = vdupq_n_u8('r'), c = vdupq_n_u8('c'),
+        lparen = vdupq_n_u8('('), rparen = vdupq_n_u8(')'), lbrace = vdupq_n_u8('{'), rbrace = vdupq_n_u8('}'),
+        squote = vdupq_n_u8('\''), dquote = vdupq_n_u8('"'), slash = vdupq_n_u8('/'), tick = vdupq_n_u8('`'),
+        lower = vdupq_n_u8(0x20), a = vdupq_n_u8('a'), zero = vdupq_n_u8('0'), underscore = vdupq_n_u8('_'),
+        dollar = vdupq_n_u8('$'), dot = vdupq_n_u8('.'), sp = vdupq_n_u8(32), tab = vdupq_n_u8(9),
+        four = vdupq_n_u8(4), nine = vdupq_n_u8(9), twentyFive = vdupq_n_u8(25);
+    while (end - pos >= 16) {
+      const uint8x16_t v = vld1q_u8(pos);
+      const uint8x16_t prev = vld1q_u8(pos - 1);
+      // keyword candidates are only those not preceded by [A-Za-z0-9_$.]
+      const uint8x16_t word = vorrq_u8(
+        vorrq_u8(vcleq_u8(vsubq_u8(vorrq_u8(prev, lower), a), twentyFive), vcleq_u8(vsubq_u8(prev, zero), nine)),
+        vorrq_u8(vceqq_u8(prev, underscore), vorrq_u8(vceqq_u8(prev, dollar), vceqq_u8(prev, dot)))
+      );
+      const uint8x16_t keyword = vbicq_u8(vorrq_u8(
+        vorrq_u8(vceqq_u8(v, e), vceqq_u8(v, i)),
+        vorrq_u8(vceqq_u8(v, r), vceqq_u8(v, c))
+      ), word);
+      const uint8x16_t token = vorrq_u8(keyword, vorrq_u8(
+        vorrq_u8(vorrq_u8(vceqq_u8(v, lparen), vceqq_u8(v, rparen)), vorrq_u8(vceqq_u8(v, lbrace), vceqq_u8(v, rbrace))),
+        vorrq_u8(vorrq_u8(vceqq_u8(v, squote), vceqq_u8(v, dquote)), vorrq_u8(vceqq_u8(v, slash), vceqq_u8(v, tick)))
+      ));
+      // 9 - 13, 32
+      const uint8x16_t ws = vorrq_u8(vceqq_u8(v, sp), vcleq_u8(vsubq_u8(v, tab), four));
+      const uint64_t tokenMask = neonMask(token);
+      uint64_t nonWsMask = ~neonMask(ws);
+      if (tokenMask) {
+        const uint32_t idx = __builtin_ctzll(tokenMask) >> 2;
+        nonWsMask &= (1ull << (idx << 2)) - 1;
+        if (nonWsMask)
+          lastToken = pos + ((63 - __builtin_clzll(nonWsMask)) >> 2);
+        *lastTokenPos = lastToken;
+        return pos + idx;
+      }
+      if (nonWsMask)
+        lastToken = pos + ((63 - __builtin_clzll(nonWsMask)) >> 2);
+      pos += 16;
+    }
+  }
+#elif defined(__wasm_simd128__)
+  {
+    const v128_t e = wasm_i8x16_splat('e'), i = wasm_i8x16_splat('i'), r = wasm_i8x16_splat('r'), c = wasm_i8x16_splat('c'),
+        lparen = wasm_i8x16_splat('('), rparen = wasm_i8x16_splat(')'), lbrace = wasm_i8x16_splat('{'), rbrace = wasm_i8x16_splat('}'),
+        squote = wasm_i8x16_splat('\''), dquote = wasm_i8x16_splat('"'), slash = wasm_i8x16_splat('/'), tick = wasm_i8x16_splat('`'),
+        lower = wasm_i8x16_splat(0x20), a = wasm_i8x16_splat('a'), zero = wasm_i8x16_splat('0'), underscore = wasm_i8x16_splat('_'),
+        dollar = wasm_i8x16_splat('$'), dot = wasm_i8x16_splat('.'), sp = wasm_i8x16_splat(32), tab = wasm_i8x16_splat(9),
+        four = wasm_i8x16_splat(4), nine = wasm_i8x16_splat(9), twentyFive = wasm_i8x16_splat(25);
+    while (end - pos >= 16) {
+      const v128_t v = wasm_v128_load(pos);
+      const v128_t prev = wasm_v128_load(pos - 1);
+      // keyword candidates are only those not preceded by [A-Za-z0-9_$.]
+      const v128_t word = wasm_v128_or(
+        wasm_v128_or(wasm_u8x16_le(wasm_i8x16_sub(wasm_v128_or(prev, lower), a), twentyFive), wasm_u8x16_le(wasm_i8x16_sub(prev, zero), nine)),
+        wasm_v128_or(wasm_i8x16_eq(prev, underscore), wasm_v128_or(wasm_i8x16_eq(prev, dollar), wasm_i8x16_eq(prev, dot)))
+      );
+      const v128_t keyword = wasm_v128_andnot(wasm_v128_or(
+        wasm_v128_or(wasm_i8x16_eq(v, e), wasm_i8x16_eq(v, i)),
+        wasm_v128_or(wasm_i8x16_eq(v, r), wasm_i8x16_eq(v, c))
+      ), word);
+      const v128_t token = wasm_v128_or(keyword, wasm_v128_or(
+        wasm_v128_or(wasm_v128_or(wasm_i8x16_eq(v, lparen), wasm_i8x16_eq(v, rparen)), wasm_v128_or(wasm_i8x16_eq(v, lbrace), wasm_i8x16_eq(v, rbrace))),
+        wasm_v128_or(wasm_v128_or(wasm_i8x16_eq(v, squote), wasm_i8x16_eq(v, dquote)), wasm_v128_or(wasm_i8x16_eq(v, slash), wasm_i8x16_eq(v, tick)))
+      ));
+      // 9 - 13, 32
+      const v128_t ws = wasm_v128_or(wasm_i8x16_eq(v, sp), wasm_u8x16_le(wasm_i8x16_sub(v, tab), four));
+      const uint32_t tokenMask = wasm_i8x16_bitmask(token);
+      uint32_t nonWsMask = ~wasm_i8x16_bitmask(ws) & 0xffff;
+      if (tokenMask) {
+        const uint32_t idx = __builtin_ctz(tokenMask);
+        nonWsMask &= (1u << idx) - 1;
+        if (nonWsMask)
+          lastToken = pos + 31 - __builtin_clz(nonWsMask);
+        *lastTokenPos = lastToken;
+        return pos + idx;
+      }
+      if (nonWsMask)
+        lastToken = pos + 31 - __builtin_clz(nonWsMask);
+      pos += 16;
+    }
+  }
+#endif
+  while (pos < end) {
+    const char16_t ch = *pos;
+    switch (ch) {
+      case 'e':
+      case 'i':
+      case 'r':
+      case 'c':
+        if (keywordBoundary(source, pos)) {
+          *lastTokenPos = lastToken;
+          return pos;
+        }
+        break;
+      case '(':
+      case ')':
+      case '{':
+      case '}':
+      case '\'':
+      case '"':
+      case '/':
+      case '`':
+        *lastTokenPos = lastToken;
+        return pos;
+    }
+    if (!(ch == 32 || ch < 14 && ch > 8))
+      lastToken = pos;
+    pos++;
+  }
+  *lastTokenPos = lastToken;
+  return pos;
+}
+
+// Line starts
+#if defined(__SSE2__) || defined(__wasm_simd128__)
+// Bit i set when pos[i] is '\n', for the 64 bytes at pos
+static inline uint64_t newlineMask (const char16_t* pos) {
+#if defined(__AVX2__)
+  const __m256i nl = _mm256_set1_epi8('\n');
+  return (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)pos), nl)) |
+      (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(pos + 32)), nl)) << 32;
+#elif defined(__SSE2__)
+  const __m128i nl = _mm_set1_epi8('\n');
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; i++)
+    mask |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(pos + 16 * i)), nl)) << 16 * i;
+  return mask;
+#else
+  const v128_t nl = wasm_i8x16_splat('\n');
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; i++)
+    mask |= (uint64_t)wasm_i8x16_bitmask(wasm_i8x16_eq(wasm_v128_load(pos + 16 * i), nl)) << 16 * i;
+  return mask;
+#endif
+}
+#endif
+
+// Doubles the capacity of the line starts array, keeping its first count
+static uint32_t* growLineStarts (State *state, uint32_t* starts, uint32_t count, uint32_t* capacity) {
+  uint32_t grown = *capacity * 2;
+  uint32_t* next = grown <= UINT32_MAX / sizeof(uint32_t) ? lexAlloc(state, grown * sizeof(uint32_t)) : NULL;
+  if (next != NULL) {
+    memcpy(next, starts, count * sizeof(uint32_t));
+    *capacity = grown;
+  }
+  return next;
+}
+
+// Records the offset at which each line starts, 0 for the first and then the
+// byte after each '\n', in one pass before lexing so that they are also there
+// for a parse error. Masks cover 64 bytes, as most hold a newline or two, and
+// one loop over the bits of each is cheaper than one per 16 bytes.
+static bool collectLineStarts (State *state, uint32_t sourceLen) {
+  const char16_t* source = state->source;
+  const char16_t* pos = source;
+  const char16_t* end = source + sourceLen;
+  uint32_t capacity = 256, count = 1;
+  uint32_t* starts = lexAlloc(state, capacity * sizeof(uint32_t));
+  if (starts == NULL)
+    return false;
+  starts[0] = 0;
+#if defined(__SSE2__) || defined(__wasm_simd128__)
+  while (end - pos >= 64) {
+    if (capacity - count < 64 && !(starts = growLineStarts(state, starts, count, &capacity)))
+      return false;
+    uint64_t mask = newlineMask(pos);
+    const uint32_t next = (uint32_t)(pos - source) + 1;
+    for (; mask; mask &= mask - 1)
+      starts[count++] = next + __builtin_ctzll(mask);
+    pos += 64;
+  }
+#elif defined(__ARM_NEON)
+  {
+    const uint8x16_t nl = vdupq_n_u8('\n');
+    while (end - pos >= 16) {
+      if (capacity - count < 16 && !(starts = growLineStarts(state, starts, count, &capacity)))
+        return false;
+      // one bit per lane
+      uint64_t mask = neonMask(vceqq_u8(vld1q_u8(pos), nl)) & 0x8888888888888888ull;
+      const uint32_t next = (uint32_t)(pos - source) + 1;
+      for (; mask; mask &= mask - 1)
+        starts[count++] = next + (__builtin_ctzll(mask) >> 2);
+      pos += 16;
+    }
+  }
+#endif
+  for (; pos < end; pos++) {
+    if (*pos != '\n')
+      continue;
+    if (count == capacity && !(starts = growLineStarts(state, starts, count, &capacity)))
+      return false;
+    starts[count++] = (uint32_t)(pos - source) + 1;
+  }
+  state->result->line_starts = starts;
+  state->result->line_count = count;
+  return true;
+}
+
+// The token stacks start small and grow through the allocator. Instead of
+// checking every push, the parse loops reserve STACK_GUARD free slots once per
+// iteration: a single dispatch pushes at most three open tokens (import( `${)
+// and one dynamic import.
+#define STACK_GUARD 4
+
+static inline bool reserveStacks (State *state) {
+#ifdef LEXER_STATS
+  LexStats *stats = &state->result->stats;
+  if (state->openTokenDepth > stats->max_open_token_depth)
+    stats->max_open_token_depth = state->openTokenDepth;
+  if (state->dynamicImportStackDepth > stats->max_dynamic_import_depth)
+    stats->max_dynamic_import_depth = state->dynamicImportStackDepth;
+#endif
+  if (state->openTokenDepth + STACK_GUARD <= state->openTokenCapacity &&
+      state->dynamicImportStackDepth + STACK_GUARD <= state->dynamicImportStackCapacity)
+    return true;
+  return growStacks(state);
+}
+
+bool growStacks (State *state) {
+  if (state->openTokenDepth + STACK_GUARD > state->openTokenCapacity) {
+    uint32_t capacity = state->openTokenCapacity * 2;
+    OpenToken* stack = capacity <= UINT32_MAX / sizeof(OpenToken) ? lexAlloc(state, capacity * sizeof(OpenToken)) : NULL;
+    if (stack == NULL)
+      return syntaxError(state), false;
+    memcpy(stack, state->openTokenStack, state->openTokenCapacity * sizeof(OpenToken));
+    memset(stack + state->openTokenCapacity, 0, (capacity - state->openTokenCapacity) * sizeof(OpenToken));
+    state->openTokenStack = stack;
+    state->openTokenCapacity = capacity;
+  }
+  if (state->dynamicImportStackDepth + STACK_GUARD > state->dynamicImportStackCapacity) {
+    uint32_t capacity = state->dynamicImportStackCapacity * 2;
+    Import** stack = capacity <= UINT32_MAX / sizeof(Import*) ? lexAlloc(state, capacity * sizeof(Import*)) : NULL;
+    if (stack == NULL)
+      return syntaxError(state), false;
+    memcpy(stack, state->dynamicImportStack, state->dynamicImportStackCapacity * sizeof(Import*));
+    state->dynamicImportStack = stack;
+    state->dynamicImportStackCapacity = capacity;
+  }
+  return true;
+}
+
+static inline bool saveCheckpoint (State *state, State *checkpoint) {
+  if (state->reachedEnd || state->has_error)
+    return false;
+  *checkpoint = *state;
+  checkpoint->pos--;
+  return true;
+}
+
+static void restoreCheckpoint (State *state, State *checkpoint) {
+  // unlink records added since the checkpoint, relinking an import that a
+  // following '{' may have dropped
+  Import* import = checkpoint->import_write_head;
+  if (import == NULL)
+    state->result->first_import = NULL;
+  else {
+    if (checkpoint->import_write_head_last == NULL)
+      state->result->first_import = import;
+    else if (checkpoint->import_write_head_last != import)
+      checkpoint->import_write_head_last->next = import;
+    import->next = NULL;
+  }
+  if (checkpoint->export_write_head == NULL)
+    state->result->first_export = NULL;
+  else
+    checkpoint->export_write_head->next = NULL;
+  state->result->parse_error = 0;
+  *state = *checkpoint;
+}
+
+// Incremental lexing records a sync point at most every SYNC_INTERVAL bytes,
+// at open token depths up to SYNC_DEPTH. Apart from the runs that the horizon
+// and clearBehind account for, lexing at a position reads at most SYNC_MARGIN
+// bytes ahead of or behind it.
+#define SYNC_INTERVAL 1024
+#define SYNC_DEPTH 16
+#define SYNC_MARGIN 32
+#define NO_OFFSET UINT32_MAX
+
+static inline uint32_t offsetOf (State *state, const char16_t* p) {
+  return p == NULL || p == EMPTY_CHAR ? NO_OFFSET : (uint32_t)(p - state->source);
+}
+
+// Maps an offset of the previous run into the edited source, failing for
+// offsets within the replaced bytes.
+static inline bool mapOffset (SyncLog *sync, uint32_t offset, uint32_t *mapped) {
+  if (offset == NO_OFFSET || offset < sync->editStart)
+    *mapped = offset;
+  else if (offset >= sync->oldEnd)
+    *mapped = offset - sync->oldEnd + sync->newEnd;
+  else
+    return false;
+  return true;
+}
+
+// Whether the reads behind p stay clear of the edit: keyword lookbehind, and
+// the identifier and whitespace run that the break/continue check walks
+// back over.
+static bool clearBehind (State *state, uint32_t p) {
+  const char16_t* limit = state->source + state->sync->newEnd + SYNC_MARGIN;
+  const char16_t* pos = state->source + p;
+  while (pos > limit && !isBrOrWsOrPunctuatorNotDot(*pos))
+    pos--;
+  while (pos > limit && isWsNotBr(*pos))
+    pos--;
+  return pos > limit;
+}
+
+// Whether a position of the current state matches one of the previous run,
+// with the reads around it unaffected by the edit.
+static inline bool samePosition (State *state, uint32_t pos, uint32_t previous) {
+  uint32_t mapped;
+  return mapOffset(state->sync, previous, &mapped) && mapped == pos &&
+      (pos == NO_OFFSET || pos < state->sync->editStart || clearBehind(state, pos));
+}
+
+// Whether lexing on from the current state reproduces the previous run from
+// target: the state agrees once mapped, and everything lexing may still read
+// behind it is either before the edit or after it.
+static bool convergesWith (State *state, const SyncPoint *target) {
+  if (target->facade != state->facade ||
+      target->lastSlashWasDivision != state->lastSlashWasDivision ||
+      target->nextBraceIsClass != state->nextBraceIsClass ||
+      target->openTokenDepth != state->openTokenDepth ||
+      !samePosition(state, offsetOf(state, state->lastTokenPos), target->lastTokenPos) ||
+      !clearBehind(state, state->pos - state->source - 1))
+    return false;
+  const SyncToken *tokens = &state->sync->targetTokens[target->stack];
+  for (uint32_t i = 0; i <= state->openTokenDepth; i++) {
+    if (tokens[i].token != state->openTokenStack[i].token ||
+        !samePosition(state, offsetOf(state, state->openTokenStack[i].pos), tokens[i].pos))
+      return false;
+  }
+  return true;
+}
+
+static bool growSyncLog (State *state) {
+  SyncLog *sync = state->sync;
+  if (sync->len == sync->capacity) {
+    uint32_t capacity = sync->capacity ? sync->capacity * 2 : 64;
+    SyncPoint* points = capacity <= UINT32_MAX / sizeof(SyncPoint) ? lexAlloc(state, capacity * sizeof(SyncPoint)) : NULL;
+    if (points == NULL)
+      return false;
+    if (sync->len)
+      memcpy(points, sync->points, sync->len * sizeof(SyncPoint));
+    sync->points = points;
+    sync->capacity = capacity;
+  }
+  if (sync->tokensLen + SYNC_DEPTH + 1 > sync->tokensCapacity) {
+    uint32_t capacity = sync->tokensCapacity ? sync->tokensCapacity * 2 : 256;
+    SyncToken* tokens = capacity <= UINT32_MAX / sizeof(SyncToken) ? lexAlloc(state, capacity * sizeof(SyncToken)) : NULL;
+    if (tokens == NULL)
+      return false;
+    if (sync->tokensLen)
+      memcpy(tokens, sync->tokens, sync->tokensLen * sizeof(SyncToken));
+    sync->tokens = tokens;
+    sync->tokensCapacity = capacity;
+  }
+  return true;
+}
+
+// Called at the start of every dispatch of an incremental run. Returns false
+// when the state has converged with the previous run, so lexing can stop.
+static bool syncPoint (State *state) {
+  // a following '{' may still drop the last import
+  if (state->openTokenDepth > SYNC_DEPTH || state->dynamicImportStackDepth ||
+      state->import_write_head && state->import_write_head->end == state->lastTokenPos)
+    return true;
+  SyncLog *sync = state->sync;
+  uint32_t pos = state->pos - state->source;
+
+  if (sync->targetIndex < sync->targetLen && pos >= sync->newEnd + SYNC_MARGIN) {
+    uint32_t targetPos;
+    while (sync->targetIndex < sync->targetLen) {
+      const SyncPoint *target = &sync->target[sync->targetIndex];
+      if (!mapOffset(sync, target->pos, &targetPos) || targetPos < pos) {
+        sync->targetIndex++;
+        continue;
+      }
+      if (targetPos == pos && convergesWith(state, target)) {
+        sync->converged = true;
+        return false;
+      }
+      break;
+    }
+  }
+
+  if (pos < sync->next)
+    return true;
+  if (!growSyncLog(state)) {
+    // stop recording, the points so far remain valid
+    sync->next = NO_OFFSET;
+    return true;
+  }
+  const char16_t* horizon = state->readHorizon > state->pos ? state->readHorizon : state->pos;
+  sync->points[sync->len++] = (SyncPoint){
+    .pos = pos,
+    .horizon = (uint32_t)(horizon - state->source) + SYNC_MARGIN,
+    .lastTokenPos = offsetOf(state, state->lastTokenPos),
+    .importCount = state->importCount,
+    .exportCount = state->exportCount,
+    .openTokenDepth = state->openTokenDepth,
+    .stack = sync->tokensLen,
+    .facade = state->facade,
+    .lastSlashWasDivision = state->lastSlashWasDivision,
+    .nextBraceIsClass = state->nextBraceIsClass,
+  };
+  for (uint32_t i = 0; i <= state->openTokenDepth; i++)
+    sync->tokens[sync->tokensLen++] = (SyncToken){ offsetOf(state, state->openTokenStack[i].pos), state->openTokenStack[i].token };
+  sync->next = pos + SYNC_INTERVAL;
+  return true;
+}
+
+static bool lexWith (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_data, ParseResult *result, const LexOptions *options, SyncLog *sync, const SyncPoint *from);
 
 // Note: parsing is based on the _assumption_ that the source is already valid
 bool parse (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_data, ParseResult *result) {
-  // stack allocations
+  return lexWith(source, sourceLen, alloc, user_data, result, NULL, NULL, NULL);
+}
+
+// Like parse, lexing only for what options asks for. The lexing itself is
+// unchanged, so every record returned is the one a full parse would return.
+bool parse_options (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_data, ParseResult *result, const LexOptions *options) {
+  return lexWith(source, sourceLen, alloc, user_data, result, options, NULL, NULL);
+}
+
+// Like parse, recording sync points into sync when given. Resuming from a
+// sync point of a previous run, whose open tokens are in sync's targetTokens,
+// restores its state and lexes from there, with the records before it left to
+// the caller; lexing then stops early once the state converges with one of
+// sync's targets.
+bool parse_incremental (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_data, ParseResult *result, SyncLog *sync, const SyncPoint *from) {
+  return lexWith(source, sourceLen, alloc, user_data, result, NULL, sync, from);
+}
+
+static bool lexWith (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_data, ParseResult *result, const LexOptions *options, SyncLog *sync, const SyncPoint *from) {
+  // initial stack allocations, grown through alloc on deeper nesting
   // these are done here to avoid data section \0\0\0 repetition bloat
-  // (while gzip fixes this, still better to have ~10KiB ungzipped over ~20KiB)
-  OpenToken openTokenStack_[1024];
-  Import* dynamicImportStack_[512];
+  // open token slots start zeroed, as the slot above the deepest push can
+  // still be read as the opener of a ) or } that a statement parser consumed
+  OpenToken openTokenStack_[64] = { 0 };
+  Import* dynamicImportStack_[32];
 
   State state = {
     .facade = true,
@@ -46,54 +770,121 @@ bool parse (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_da
     .lastSlashWasDivision = false,
     .has_error = false,
     .openTokenStack = &openTokenStack_[0],
+    .openTokenCapacity = sizeof(openTokenStack_) / sizeof(OpenToken),
     .dynamicImportStack = &dynamicImportStack_[0],
+    .dynamicImportStackCapacity = sizeof(dynamicImportStack_) / sizeof(Import*),
     .nextBraceIsClass = false,
     .source = source,
     .alloc = alloc,
     .user_data = user_data,
     .result = result,
+    .sync = sync,
+    .flags = options ? options->flags : 0,
+    .importLimit = options && options->maxImports ? options->maxImports : UINT32_MAX,
   };
 
   state.pos = (char16_t*)(source - 1);
-  char16_t ch = '\0';
   state.end = state.pos + sourceLen;
+  STAT(result->stats = (LexStats){ 0 });
+  result->line_starts = NULL;
+  result->line_count = 0;
+  if (state.flags & LineStarts && !collectLineStarts(&state, sourceLen)) {
+    bail(&state, 0);
+    return false;
+  }
+
+  if (from) {
+    state.pos += from->pos;
+    state.lastTokenPos = from->lastTokenPos == NO_OFFSET ? (char16_t*)EMPTY_CHAR : source + from->lastTokenPos;
+    state.openTokenDepth = from->openTokenDepth;
+    for (uint32_t i = 0; i <= from->openTokenDepth; i++) {
+      const SyncToken *token = &sync->targetTokens[from->stack + i];
+      openTokenStack_[i].token = token->token;
+      openTokenStack_[i].pos = token->pos == NO_OFFSET ? NULL : source + token->pos;
+    }
+    state.importCount = from->importCount;
+    state.exportCount = from->exportCount;
+    state.facade = from->facade;
+    state.lastSlashWasDivision = from->lastSlashWasDivision;
+    state.nextBraceIsClass = from->nextBraceIsClass;
+    sync->next = from->pos + SYNC_INTERVAL;
+  }
+
+  bool success = lexSource(&state, NULL);
+  result->facade = state.facade;
+  return success;
+}
+
+// Runs the facade and main parse loops from state->pos up to state->end.
+//
+// When streaming, a checkpoint is taken before every dispatch. Once the loops
+// reach the end of the data received so far, the last dispatch is rolled back
+// (it may have depended on bytes not yet seen) and true is returned so that
+// lexing can resume from the checkpoint when more data arrives.
+//
+// Lexing is O(n) in the source length. Every byte is scanned a bounded number
+// of times: statement lookahead only backtracks over the whitespace, comments
+// and tokens it read after its keyword, which the main loop then reads once
+// more; the regex / division checks look back over at most a keyword or the
+// token before the slash; and parse_feed only lexes again from a checkpoint
+// once at least as much data has been fed as that rollback repeats.
+bool lexSource (State *state, State *checkpoint) {
+  char16_t ch = '\0';
+
+
+  if (!state->facade)
+    goto mainparse;
 
   // start with a pure "module-only" parser
-  while (state.pos++ < state.end) {
-    ch = *state.pos;
+  while (state->pos++ < state->end) {
+    if (!reserveStacks(state))
+      return false;
+    if (checkpoint && !saveCheckpoint(state, checkpoint))
+      break;
+    if (state->sync && !syncPoint(state))
+      return true;
+    state->pos = skipWhitespace(state->pos, state->end, true);
+    ch = *state->pos;
 
     if (ch == 32 || ch < 14 && ch > 8)
       continue;
 
     switch (ch) {
       case 'e':
-        if (state.openTokenDepth == 0 && keywordStart(&state) && memcmp(state.pos + 1, &XPORT[0], 5 * sizeof(char16_t)) == 0) {
-          tryParseExportStatement(&state);
+        if (state->openTokenDepth == 0 && keywordStart(state) && matchAhead(state, state->pos + 1, KW_XPORT)) {
+          tryParseExportStatement(state);
+          if (importLimitReached(state))
+            return true;
           // export might have been a non-pure declaration
-          if (!state.facade) {
-            state.lastTokenPos = state.pos;
+          if (!state->facade) {
+            if (state->flags & FacadeOnly)
+              return true;
+            state->lastTokenPos = state->pos;
             goto mainparse;
           }
         }
         break;
       case 'i':
-        if (keywordStart(&state) && memcmp(state.pos + 1, &MPORT[0], 5 * sizeof(char16_t)) == 0)
-          tryParseImportStatement(&state);
+        if (keywordStart(state) && matchAhead(state, state->pos + 1, KW_MPORT)) {
+          tryParseImportStatement(state);
+          if (importLimitReached(state))
+            return true;
+        }
         break;
       case 'r':
-        tryParseRequire(&state);
+        tryParseRequire(state);
         break;
       case ';':
         break;
       case '/': {
-        char16_t next_ch = *(state.pos + 1);
+        char16_t next_ch = peekChar(state, state->pos + 1);
         if (next_ch == '/') {
-          lineComment(&state);
+          lineComment(state);
           // dont update lastToken
           continue;
         }
         else if (next_ch == '*') {
-          blockComment(&state, true);
+          blockComment(state, true);
           // dont update lastToken
           continue;
         }
@@ -101,91 +892,111 @@ bool parse (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_da
       }
       default:
         // as soon as we hit a non-module token, we go to main parser
-        state.facade = false;
-        state.pos--;
+        state->facade = false;
+        if (state->flags & FacadeOnly)
+          return true;
+        state->pos--;
         goto mainparse; // oh yeahhh
     }
-    state.lastTokenPos = state.pos;
+    state->lastTokenPos = state->pos;
   }
 
-  if (state.has_error)
+  if (checkpoint)
+    return restoreCheckpoint(state, checkpoint), true;
+
+  if (state->has_error)
     return false;
 
-  mainparse: while (state.pos++ < state.end) {
-    ch = *state.pos;
+  mainparse: while (state->pos++ < state->end) {
+    if (!reserveStacks(state))
+      return false;
+    if (checkpoint && !saveCheckpoint(state, checkpoint))
+      break;
+    if (state->sync && !syncPoint(state))
+      return true;
+    state->pos = scanToToken(state->pos, state->end, state->source, &state->lastTokenPos);
+    ch = *state->pos;
 
     if (ch == 32 || ch < 14 && ch > 8)
       continue;
 
     switch (ch) {
       case 'e':
-        if (state.openTokenDepth == 0 && keywordStart(&state) && memcmp(state.pos + 1, &XPORT[0], 5 * sizeof(char16_t)) == 0)
-          tryParseExportStatement(&state);
+        if (state->openTokenDepth == 0 && keywordStart(state) && matchAhead(state, state->pos + 1, KW_XPORT)) {
+          tryParseExportStatement(state);
+          if (importLimitReached(state))
+            return true;
+        }
         break;
       case 'i':
-        if (keywordStart(&state) && memcmp(state.pos + 1, &MPORT[0], 5 * sizeof(char16_t)) == 0)
-          tryParseImportStatement(&state);
+        if (keywordStart(state) && matchAhead(state, state->pos + 1, KW_MPORT)) {
+          tryParseImportStatement(state);
+          if (importLimitReached(state))
+            return true;
+        }
         break;
       case 'r':
-        tryParseRequire(&state);
+        tryParseRequire(state);
         break;
       case 'c':
-        if (keywordStart(&state) && memcmp(state.pos + 1, &LASS[0], 4 * sizeof(char16_t)) == 0 && isBrOrWs(*(state.pos + 5)))
-          state.nextBraceIsClass = true;
+        if (keywordStart(state) && matchAhead(state, state->pos + 1, KW_LASS) && isBrOrWs(peekChar(state, state->pos + 5)))
+          state->nextBraceIsClass = true;
         break;
       case '(':
-        state.openTokenStack[state.openTokenDepth].token = AnyParen;
-        state.openTokenStack[state.openTokenDepth++].pos = state.lastTokenPos;
+        state->openTokenStack[state->openTokenDepth].token = AnyParen;
+        state->openTokenStack[state->openTokenDepth++].pos = state->lastTokenPos;
         break;
       case ')':
-        if (state.openTokenDepth == 0)
-          return syntaxError(&state), false;
-        state.openTokenDepth--;
-        if (state.dynamicImportStackDepth > 0 && state.dynamicImportStack[state.dynamicImportStackDepth - 1]->dynamic == state.openTokenStack[state.openTokenDepth].pos) {
-          Import* cur_dynamic_import = state.dynamicImportStack[state.dynamicImportStackDepth - 1];
+        if (state->openTokenDepth == 0)
+          return syntaxError(state), false;
+        state->openTokenDepth--;
+        if (state->dynamicImportStackDepth > 0 && state->dynamicImportStack[state->dynamicImportStackDepth - 1]->dynamic == state->openTokenStack[state->openTokenDepth].pos) {
+          Import* cur_dynamic_import = state->dynamicImportStack[state->dynamicImportStackDepth - 1];
           if (cur_dynamic_import->end == 0)
-            cur_dynamic_import->end = state.pos;
-          cur_dynamic_import->statement_end = state.pos + 1;
-          state.dynamicImportStackDepth--;
+            cur_dynamic_import->end = state->pos;
+          cur_dynamic_import->statement_end = state->pos + 1;
+          state->dynamicImportStackDepth--;
         }
         break;
       case '{':
         // dynamic import followed by { is not a dynamic import (so remove)
         // this is a sneaky way to get around { import () {} } v { import () }
         // block / object ambiguity without a parser (assuming source is valid)
-        if (*state.lastTokenPos == ')' && state.import_write_head && state.import_write_head->end == state.lastTokenPos) {
-          state.import_write_head = state.import_write_head_last;
-          if (state.import_write_head)
-            state.import_write_head->next = NULL;
+        if (*state->lastTokenPos == ')' && state->import_write_head && state->import_write_head->end == state->lastTokenPos) {
+          STAT(state->result->stats.dynamic_import_removals++);
+          state->import_write_head = state->import_write_head_last;
+          state->importCount--;
+          if (state->import_write_head)
+            state->import_write_head->next = NULL;
           else
-            state.result->first_import = NULL;
+            state->result->first_import = NULL;
         }
-        state.openTokenStack[state.openTokenDepth].token = state.nextBraceIsClass ? ClassBrace : AnyBrace;
-        state.openTokenStack[state.openTokenDepth++].pos = state.lastTokenPos;
-        state.nextBraceIsClass = false;
+        state->openTokenStack[state->openTokenDepth].token = state->nextBraceIsClass ? ClassBrace : AnyBrace;
+        state->openTokenStack[state->openTokenDepth++].pos = state->lastTokenPos;
+        state->nextBraceIsClass = false;
         break;
       case '}':
-        if (state.openTokenDepth == 0)
-          return syntaxError(&state), false;
-        if (state.openTokenStack[--state.openTokenDepth].token == TemplateBrace) {
-          templateString(&state);
+        if (state->openTokenDepth == 0)
+          return syntaxError(state), false;
+        if (state->openTokenStack[--state->openTokenDepth].token == TemplateBrace) {
+          templateString(state);
         }
         break;
       case '\'':
-        stringLiteral(&state, ch);
+        stringLiteral(state, ch);
         break;
       case '"':
-        stringLiteral(&state, ch);
+        stringLiteral(state, ch);
         break;
       case '/': {
-        char16_t next_ch = *(state.pos + 1);
+        char16_t next_ch = peekChar(state, state->pos + 1);
         if (next_ch == '/') {
-          lineComment(&state);
+          lineComment(state);
           // dont update lastToken
           continue;
         }
         else if (next_ch == '*') {
-          blockComment(&state, true);
+          blockComment(state, true);
           // dont update lastToken
           continue;
         }
@@ -194,50 +1005,196 @@ bool parse (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_da
           // - what token came previously (lastToken)
           // - if a closing brace or paren, what token came before the corresponding
           //   opening brace or paren (lastOpenTokenIndex)
-          char16_t lastToken = *state.lastTokenPos;
+          char16_t lastToken = *state->lastTokenPos;
           if (isExpressionPunctuator(lastToken) &&
-              !(lastToken == '.' && (*(state.lastTokenPos - 1) >= '0' && *(state.lastTokenPos - 1) <= '9')) &&
-              !(lastToken == '+' && *(state.lastTokenPos - 1) == '+') && !(lastToken == '-' && *(state.lastTokenPos - 1) == '-') ||
-              lastToken == ')' && isParenKeyword(&state, state.openTokenStack[state.openTokenDepth].pos) ||
-              lastToken == '}' && (isExpressionTerminator(&state, state.openTokenStack[state.openTokenDepth].pos) || state.openTokenStack[state.openTokenDepth].token == ClassBrace) ||
-              isExpressionKeyword(&state, state.lastTokenPos) ||
-              lastToken == '/' && state.lastSlashWasDivision ||
+              !(state->lastTokenPos > state->source && (
+                lastToken == '.' && (*(state->lastTokenPos - 1) >= '0' && *(state->lastTokenPos - 1) <= '9') ||
+                lastToken == '+' && *(state->lastTokenPos - 1) == '+' || lastToken == '-' && *(state->lastTokenPos - 1) == '-')) ||
+              lastToken == ')' && state->openTokenStack[state->openTokenDepth].pos && isParenKeyword(state, state->openTokenStack[state->openTokenDepth].pos) ||
+              lastToken == '}' && state->openTokenStack[state->openTokenDepth].pos && (isExpressionTerminator(state, state->openTokenStack[state->openTokenDepth].pos) || state->openTokenStack[state->openTokenDepth].token == ClassBrace) ||
+              isExpressionKeyword(state, state->lastTokenPos) ||
+              lastToken == '/' && state->lastSlashWasDivision ||
               !lastToken) {
-            regularExpression(&state);
-            state.lastSlashWasDivision = false;
+            STAT(state->result->stats.regex_decisions++);
+            regularExpression(state);
+            state->lastSlashWasDivision = false;
           }
           else {
             // Final check - if the last token was "break x" or "continue x"
-            while (state.lastTokenPos > source && !isBrOrWsOrPunctuatorNotDot(*(--state.lastTokenPos)));
-            if (isWsNotBr(*state.lastTokenPos)) {
-              while (state.lastTokenPos > source && isWsNotBr(*(--state.lastTokenPos)));
-              if (isBreakOrContinue(&state, state.lastTokenPos)) {
-                regularExpression(&state);
-                state.lastSlashWasDivision = false;
+            while (state->lastTokenPos > state->source && !isBrOrWsOrPunctuatorNotDot(*(--state->lastTokenPos)));
+            if (isWsNotBr(*state->lastTokenPos)) {
+              while (state->lastTokenPos > state->source && isWsNotBr(*(--state->lastTokenPos)));
+              if (isBreakOrContinue(state, state->lastTokenPos)) {
+                STAT(state->result->stats.regex_decisions++);
+                regularExpression(state);
+                state->lastSlashWasDivision = false;
                 break;
               }
             }
-            state.lastSlashWasDivision = true;
+            STAT(state->result->stats.division_decisions++);
+            state->lastSlashWasDivision = true;
           }
         }
         break;
       }
       case '`':
-        state.openTokenStack[state.openTokenDepth].pos = state.lastTokenPos;
-        state.openTokenStack[state.openTokenDepth++].token = Template;
-        templateString(&state);
+        state->openTokenStack[state->openTokenDepth].pos = state->lastTokenPos;
+        state->openTokenStack[state->openTokenDepth++].token = Template;
+        templateString(state);
         break;
     }
-    state.lastTokenPos = state.pos;
+    state->lastTokenPos = state->pos;
   }
 
-  if (state.openTokenDepth || state.has_error || state.dynamicImportStackDepth)
+  if (checkpoint)
+    return restoreCheckpoint(state, checkpoint), true;
+
+  if (state->openTokenDepth || state->has_error || state->dynamicImportStackDepth)
     return false;
 
   // succeess
   return true;
 }
 
+#define STREAM_PAD 32
+// feeds lex this far short of the data received, so that keyword lookahead
+// near the provisional end rarely forces a rollback
+#define STREAM_LOOKAHEAD 16
+
+static void rebaseStream (Stream *stream, char16_t *oldBase, char16_t *oldLimit, ptrdiff_t delta) {
+  #define REBASE(p) if ((char16_t*)(p) >= oldBase && (char16_t*)(p) < oldLimit) (p) += delta
+  State *state = &stream->state;
+  REBASE(state->source);
+  REBASE(state->pos);
+  REBASE(state->end);
+  REBASE(state->lastTokenPos);
+  uint32_t depth = state->openTokenDepth < state->openTokenCapacity ? state->openTokenDepth + 1 : state->openTokenCapacity;
+  for (uint32_t i = 0; i < depth; i++)
+    REBASE(state->openTokenStack[i].pos);
+  for (Import* import = state->result->first_import; import != NULL; import = import->next) {
+    REBASE(import->start);
+    REBASE(import->end);
+    REBASE(import->statement_start);
+    REBASE(import->statement_end);
+    REBASE(import->assert_index);
+    REBASE(import->dynamic);
+  }
+  for (Export* exprt = state->result->first_export; exprt != NULL; exprt = exprt->next) {
+    REBASE(exprt->start);
+    REBASE(exprt->end);
+    REBASE(exprt->local_start);
+    REBASE(exprt->local_end);
+  }
+  #undef REBASE
+  stream->checkpoint = *state;
+}
+
+static bool growStream (Stream *stream, uint32_t minCapacity) {
+  uint64_t capacity = stream->capacity ? stream->capacity : 4096;
+  while (capacity < minCapacity)
+    capacity *= 2;
+  if (capacity > UINT32_MAX - 2 * STREAM_PAD)
+    capacity = minCapacity;
+  if (capacity > UINT32_MAX - 2 * STREAM_PAD)
+    return false;
+  char16_t* alloc = lexAlloc(&stream->state, capacity + 2 * STREAM_PAD);
+  if (alloc == NULL)
+    return false;
+  char16_t* buffer = alloc + STREAM_PAD;
+  memset(alloc, 0, STREAM_PAD);
+  memset(buffer + stream->len, 0, capacity - stream->len + STREAM_PAD);
+  if (stream->buffer) {
+    memcpy(buffer, stream->buffer, stream->len);
+    rebaseStream(stream, stream->buffer - STREAM_PAD, stream->buffer + stream->capacity + STREAM_PAD, buffer - stream->buffer);
+  }
+  stream->buffer = buffer;
+  stream->capacity = capacity;
+  return true;
+}
+
+// Streaming entry points: parse_begin, then parse_feed for each chunk and
+// parse_end once the input is complete. Lexing progresses as chunks arrive,
+// suspending at the last token boundary that does not depend on unseen input.
+// The whole source is retained, as results and lookbehind point into it.
+Stream* parse_begin (Allocator alloc, void *user_data, ParseResult *result) {
+  Stream* stream = alloc(sizeof(Stream), user_data);
+  if (stream == NULL)
+    return NULL;
+  result->first_import = NULL;
+  result->first_export = NULL;
+  result->parse_error = 0;
+  result->facade = true;
+#ifdef LEXER_STATS
+  result->stats = (LexStats){ 0 };
+  result->stats.allocations = 1;
+  result->stats.allocated_bytes = sizeof(Stream);
+#endif
+  stream->buffer = NULL;
+  stream->len = 0;
+  stream->capacity = 0;
+  stream->resume = 0;
+  memset(stream->openTokenStack_, 0, sizeof(stream->openTokenStack_));
+  stream->state = (State){
+    .facade = true,
+    .lastTokenPos = (char16_t*)EMPTY_CHAR,
+    .openTokenStack = &stream->openTokenStack_[0],
+    .openTokenCapacity = sizeof(stream->openTokenStack_) / sizeof(OpenToken),
+    .dynamicImportStack = &stream->dynamicImportStack_[0],
+    .dynamicImportStackCapacity = sizeof(stream->dynamicImportStack_) / sizeof(Import*),
+    .alloc = alloc,
+    .user_data = user_data,
+    .result = result,
+    .importLimit = UINT32_MAX,
+  };
+  if (!growStream(stream, 0))
+    return NULL;
+  stream->state.source = stream->buffer;
+  stream->state.pos = stream->buffer - 1;
+  stream->state.end = stream->buffer - 1;
+  stream->checkpoint = stream->state;
+  return stream;
+}
+
+bool parse_feed (Stream *stream, const char16_t *chunk, uint32_t len) {
+  State *state = &stream->state;
+  if (state->has_error)
+    return false;
+  if (len > stream->capacity - stream->len) {
+    if (len > UINT32_MAX - stream->len || !growStream(stream, stream->len + len)) {
+      state->pos = stream->buffer + stream->len;
+      return syntaxError(state), false;
+    }
+  }
+  memcpy(stream->buffer + stream->len, chunk, len);
+  stream->len += len;
+  if (stream->len <= STREAM_LOOKAHEAD || stream->len < stream->resume)
+    return true;
+  state->end = stream->buffer + stream->len - 1 - STREAM_LOOKAHEAD;
+  bool success = lexSource(state, &stream->checkpoint);
+  // everything after the checkpoint is lexed again by the next lex, so wait
+  // for at least as much new data first. Rescanning a long token chunk by
+  // chunk would otherwise be quadratic, where this bounds the rescans by
+  // twice the data fed.
+  uint32_t pending = stream->buffer + stream->len - state->pos;
+  stream->resume = pending > UINT32_MAX - stream->len ? UINT32_MAX : stream->len + pending;
+  return success;
+}
+
+bool parse_end (Stream *stream) {
+  State *state = &stream->state;
+  if (state->has_error)
+    return false;
+  state->end = stream->buffer + stream->len - 1;
+  bool success = lexSource(state, NULL);
+  state->result->facade = state->facade;
+  return success;
+}
+
+const char16_t* parse_stream_source (Stream *stream, uint32_t *len) {
+  *len = stream->len;
+  return stream->buffer;
+}
+
 void tryParseImportStatement (State *state) {
   char16_t* startPos = state->pos;
 
@@ -257,8 +1214,8 @@ void tryParseImportStatement (State *state) {
       // try parse a string, to record a safe dynamic import string
       state->pos++;
       ch = commentWhitespace(state, true);
-      addImport(state, startPos, state->pos, 0, dynamicPos);
-      state->dynamicImportStack[state->dynamicImportStackDepth++] = state->import_write_head;
+      Import* import = addImport(state, startPos, state->pos, 0, dynamicPos);
+      state->dynamicImportStack[state->dynamicImportStackDepth++] = import;
       if (ch == '\'' || ch == '"') {
         stringLiteral(state, ch);
       } else if (ch == '`') {
@@ -275,16 +1232,18 @@ void tryParseImportStatement (State *state) {
       if (ch == ',') {
         state->pos++;
         ch = commentWhitespace(state, true);
-        state->import_write_head->end = endPos;
-        state->import_write_head->assert_index = state->pos;
-        state->import_write_head->safe = true;
+        import->end = endPos;
+        import->assert_index = state->pos;
+        import->safe = true;
+        import->escaped = hasEscape(import->start + 1, endPos - 1, *import->start == '`');
         state->pos--;
       }
       else if (ch == ')') {
         state->openTokenDepth--;
-        state->import_write_head->end = endPos;
-        state->import_write_head->statement_end = state->pos + 1;
-        state->import_write_head->safe = true;
+        import->end = endPos;
+        import->statement_end = state->pos + 1;
+        import->safe = true;
+        import->escaped = hasEscape(import->start + 1, endPos - 1, *import->start == '`');
         state->dynamicImportStackDepth--;
       }
       else {
@@ -296,7 +1255,7 @@ void tryParseImportStatement (State *state) {
       state->pos++;
       ch = commentWhitespace(state, true);
       // import.meta indicated by d == -2
-      if (ch == 'm' && memcmp(state->pos + 1, &ETA[0], 3 * sizeof(char16_t)) == 0 && *state->lastTokenPos != '.')
+      if (ch == 'm' && matchAhead(state, state->pos + 1, KW_ETA) && *state->lastTokenPos != '.')
         addImport(state, startPos, startPos, state->pos + 4, IMPORT_META);
       return;
 
@@ -347,7 +1306,7 @@ void tryParseImportStatement (State *state) {
       }
 
       ch = commentWhitespace(state, true);
-      if (memcmp(state->pos, &FROM[0], 4 * sizeof(char16_t)) != 0) {
+      if (!matchAhead(state, state->pos, KW_FROM)) {
         syntaxError(state);
         break;
       }
@@ -369,7 +1328,7 @@ void tryParseImportStatement (State *state) {
 void tryParseRequire (State *state) {
   char16_t* startPos = state->pos;
   // require('...')
-  if (keywordStart(state) && memcmp(state->pos + 1, &EQUIRE[0], 6 * sizeof(char16_t)) == 0) {
+  if (keywordStart(state) && matchAhead(state, state->pos + 1, KW_EQUIRE)) {
     state->pos += 7;
     uint16_t ch = commentWhitespace(state, true);
     if (ch == '(') {
@@ -378,8 +1337,8 @@ void tryParseRequire (State *state) {
       char16_t* dynamicPos = state->pos;
       state->pos++;
       ch = commentWhitespace(state, true);
-      addImport(state, startPos, state->pos, 0, dynamicPos);
-      state->dynamicImportStack[state->dynamicImportStackDepth++] = state->import_write_head;
+      Import* import = addImport(state, startPos, state->pos, 0, dynamicPos);
+      state->dynamicImportStack[state->dynamicImportStackDepth++] = import;
       if (ch == '\'' || ch == '"') {
         stringLiteral(state, ch);
       } else if (ch == '`') {
@@ -395,18 +1354,21 @@ void tryParseRequire (State *state) {
       ch = commentWhitespace(state, true);
       if (ch == ')') {
         state->openTokenDepth--;
-        state->import_write_head->end = endPos;
-        state->import_write_head->statement_end = state->pos + 1;
-        state->import_write_head->safe = true;
+        import->end = endPos;
+        import->statement_end = state->pos + 1;
+        import->safe = true;
+        import->escaped = hasEscape(import->start + 1, endPos - 1, *import->start == '`');
         state->dynamicImportStackDepth--;
       } else {
         state->pos--;
       }
       return;
-    } else if (ch != ':' && ch != '.' && !isIdentifierChar(nextChar(state))) {
+    } else if (ch != ':' && ch != '.' &&
+        // ASCII is classified without decoding, stepping over it as nextChar would
+        !isIdentifierChar(ch < 0x80 ? (state->pos++, ch) : nextChar(state))) {
       addImport(state, startPos, state->pos, state->pos, state->pos);
     }
-    state->pos = startPos;
+    backtrack(state, startPos);
   }
 }
 
@@ -482,11 +1444,11 @@ void tryParseExportStatement (State *state) {
         ch = commentWhitespace(state, true);
         bool localName = false;
         // export default async? function*? name? (){}
-        if (ch == 'a' && keywordStart(state) &&  memcmp(state->pos + 1, &SYNC[0], 4 * sizeof(char16_t)) == 0 && isWsNotBr(*(state->pos + 5))) {
+        if (ch == 'a' && keywordStart(state) &&  matchAhead(state, state->pos + 1, KW_SYNC) && isWsNotBr(peekChar(state, state->pos + 5))) {
           state->pos += 5;
           ch = commentWhitespace(state, false);
         }
-        if (ch == 'f' && keywordStart(state) && memcmp(state->pos + 1, &UNCTION[0], 7 * sizeof(char16_t)) == 0 && (isBrOrWs(*(state->pos + 8)) || *(state->pos + 8) == '*' || *(state->pos + 8) == '(')) {
+        if (ch == 'f' && keywordStart(state) && matchAhead(state, state->pos + 1, KW_UNCTION) && (isBrOrWs(peekChar(state, state->pos + 8)) || peekChar(state, state->pos + 8) == '*' || peekChar(state, state->pos + 8) == '(')) {
           state->pos += 8;
           ch = commentWhitespace(state, true);
           if (ch == '*') {
@@ -495,18 +1457,18 @@ void tryParseExportStatement (State *state) {
           }
           if (ch == '(') {
             addExport(state, startPos, startPos + 7, NULL, NULL);
-            state->pos = (char16_t*)(startPos + 6);
+            backtrack(state, startPos + 6);
             return;
           }
           localName = true;
         }
         // export default class name? {}
-        if (ch == 'c' && keywordStart(state) && memcmp(state->pos + 1, &LASS[0], 4 * sizeof(char16_t)) == 0 && (isBrOrWs(*(state->pos + 5)) || *(state->pos + 5) == '{')) {
+        if (ch == 'c' && keywordStart(state) && matchAhead(state, state->pos + 1, KW_LASS) && (isBrOrWs(peekChar(state, state->pos + 5)) || peekChar(state, state->pos + 5) == '{')) {
           state->pos += 5;
           ch = commentWhitespace(state, true);
           if (ch == '{') {
             addExport(state, startPos, startPos + 7, NULL, NULL);
-            state->pos = (char16_t*)(startPos + 6);
+            backtrack(state, startPos + 6);
             return;
           }
           localName = true;
@@ -519,7 +1481,7 @@ void tryParseExportStatement (State *state) {
         }
         else {
           addExport(state, startPos, startPos + 7, NULL, NULL);
-          state->pos = (char16_t*)(startPos + 6);
+          backtrack(state, startPos + 6);
         }
         return;
       }
@@ -543,7 +1505,7 @@ void tryParseExportStatement (State *state) {
 
       // export class name ...
       case 'c':
-        if (memcmp(state->pos + 1, &LASS[0], 4 * sizeof(char16_t)) == 0 && isBrOrWsOrPunctuatorNotDot(*(state->pos + 5))) {
+        if (matchAhead(state, state->pos + 1, KW_LASS) && isBrOrWsOrPunctuatorNotDot(peekChar(state, state->pos + 5))) {
           state->pos += 5;
           ch = commentWhitespace(state, true);
           const char16_t* startPos = state->pos;
@@ -588,13 +1550,14 @@ void tryParseExportStatement (State *state) {
   }
 
   // from ...
-  if (ch == 'f' && memcmp(state->pos + 1, &FROM[1], 3 * sizeof(char16_t)) == 0) {
+  if (ch == 'f' && matchAhead(state, state->pos + 1, KW_ROM)) {
     state->pos += 4;
     readImportString(state, sStartPos, commentWhitespace(state, true));
 
     // There were no local names.
     for (Export* exprt = prev_export_write_head == NULL ? state->result->first_export : prev_export_write_head->next; exprt != NULL; exprt = exprt->next) {
       exprt->local_start = exprt->local_end = NULL;
+      exprt->local_escaped = false;
     }
   }
   else {
@@ -603,7 +1566,7 @@ void tryParseExportStatement (State *state) {
 }
 
 char16_t readExportAs (State *state, char16_t* startPos, char16_t* endPos) {
-  char16_t ch = *state->pos;
+  char16_t ch = peekChar(state, state->pos);
   char16_t* localStartPos = startPos == endPos ? NULL : startPos;
   char16_t* localEndPos = startPos == endPos ? NULL : endPos;
 
@@ -649,10 +1612,11 @@ void readImportString (State *state, const char16_t* ss, char16_t ch) {
     syntaxError(state);
     return;
   }
-  addImport(state, ss, startPos, state->pos, STANDARD_IMPORT);
+  Import* import = addImport(state, ss, startPos, state->pos, STANDARD_IMPORT);
+  import->escaped = hasEscape(startPos, state->pos, false);
   state->pos++;
   ch = commentWhitespace(state, false);
-  if (ch != 'a' || memcmp(state->pos + 1, &SSERT[0], 5 * sizeof(char16_t)) != 0) {
+  if (ch != 'a' || !matchAhead(state, state->pos + 1, KW_SSERT)) {
     state->pos--;
     return;
   }
@@ -660,7 +1624,7 @@ void readImportString (State *state, const char16_t* ss, char16_t ch) {
   state->pos += 6;
   ch = commentWhitespace(state, true);
   if (ch != '{') {
-    state->pos = assertIndex;
+    backtrack(state, assertIndex);
     return;
   }
   const char16_t* assertStart = state->pos;
@@ -681,7 +1645,7 @@ void readImportString (State *state, const char16_t* ss, char16_t ch) {
       ch = readToWsOrPunctuator(state, ch);
     }
     if (ch != ':') {
-      state->pos = assertIndex;
+      backtrack(state, assertIndex);
       return;
     }
     state->pos++;
@@ -693,7 +1657,7 @@ void readImportString (State *state, const char16_t* ss, char16_t ch) {
       stringLiteral(state, ch);
     }
     else {
-      state->pos = assertIndex;
+      backtrack(state, assertIndex);
       return;
     }
     state->pos++;
@@ -707,19 +1671,32 @@ void readImportString (State *state, const char16_t* ss, char16_t ch) {
     }
     if (ch == '}')
       break;
-    state->pos = assertIndex;
+    backtrack(state, assertIndex);
     return;
   } while (true);
-  state->import_write_head->assert_index = assertStart;
-  state->import_write_head->statement_end = state->pos + 1;
+  import->assert_index = assertStart;
+  import->statement_end = state->pos + 1;
 }
 
+#ifdef LEXER_STATS
+// Runs the scan, counting the call and the bytes it advanced over
+#define COUNT_SCAN(stat, scan) do { \
+    const char16_t* scanStart = state->pos; \
+    scan; \
+    state->result->stats.stat.calls++; \
+    state->result->stats.stat.bytes += state->pos > scanStart ? state->pos - scanStart : 0; \
+  } while (0)
+#else
+#define COUNT_SCAN(stat, scan) scan
+#endif
+
 char16_t commentWhitespace (State *state, bool br) {
   char16_t ch;
   do {
-    ch = *state->pos;
+    state->pos = skipWhitespace(state->pos, state->end, br);
+    ch = peekChar(state, state->pos);
     if (ch == '/') {
-      char16_t next_ch = *(state->pos + 1);
+      char16_t next_ch = peekChar(state, state->pos + 1);
       if (next_ch == '/')
         lineComment(state);
       else if (next_ch == '*')
@@ -731,13 +1708,15 @@ char16_t commentWhitespace (State *state, bool br) {
       return ch;
     }
   } while (state->pos++ < state->end);
+  state->reachedEnd = true;
   return ch;
 }
 
-void templateString (State *state) {
+static inline void scanTemplateString (State *state) {
   while (state->pos++ < state->end) {
+    state->pos = scanToAny(state->pos, state->end, '$', '`', '\\', '$', '$');
     char16_t ch = *state->pos;
-    if (ch == '$' && *(state->pos + 1) == '{') {
+    if (ch == '$' && peekChar(state, state->pos + 1) == '{') {
       state->pos++;
       state->openTokenStack[state->openTokenDepth].token = TemplateBrace;
       state->openTokenStack[state->openTokenDepth++].pos = state->pos;
@@ -754,35 +1733,52 @@ void templateString (State *state) {
   syntaxError(state);
 }
 
-void blockComment (State *state, bool br) {
+void templateString (State *state) {
+  COUNT_SCAN(template_string, scanTemplateString(state));
+}
+
+static inline void scanBlockComment (State *state, bool br) {
   state->pos++;
   while (state->pos++ < state->end) {
+    state->pos = br ? scanToAny(state->pos, state->end, '*', '*', '*', '*', '*') : scanToAny(state->pos, state->end, '*', '\n', '\r', '*', '*');
     char16_t ch = *state->pos;
     if (!br && isBr(ch))
       return;
-    if (ch == '*' && *(state->pos + 1) == '/') {
+    if (ch == '*' && peekChar(state, state->pos + 1) == '/') {
       state->pos++;
       return;
     }
   }
+  state->reachedEnd = true;
 }
 
-void lineComment (State *state) {
+void blockComment (State *state, bool br) {
+  COUNT_SCAN(block_comment, scanBlockComment(state, br));
+}
+
+static inline void scanLineComment (State *state) {
   while (state->pos++ < state->end) {
+    state->pos = scanToAny(state->pos, state->end, '\n', '\r', '\n', '\n', '\n');
     char16_t ch = *state->pos;
     if (ch == '\n' || ch == '\r')
       return;
   }
+  state->reachedEnd = true;
 }
 
-void stringLiteral (State *state, char16_t quote) {
+void lineComment (State *state) {
+  COUNT_SCAN(line_comment, scanLineComment(state));
+}
+
+static inline void scanStringLiteral (State *state, char16_t quote) {
   while (state->pos++ < state->end) {
+    state->pos = scanToAny(state->pos, state->end, quote, '\\', '\n', '\r', quote);
     char16_t ch = *state->pos;
     if (ch == quote)
       return;
     if (ch == '\\') {
-      ch = *++state->pos;
-      if (ch == '\r' && *(state->pos + 1) == '\n')
+      ch = peekChar(state, ++state->pos);
+      if (ch == '\r' && peekChar(state, state->pos + 1) == '\n')
         state->pos++;
     }
     else if (isBr(ch))
@@ -791,8 +1787,179 @@ void stringLiteral (State *state, char16_t quote) {
   syntaxError(state);
 }
 
+void stringLiteral (State *state, char16_t quote) {
+  COUNT_SCAN(string_literal, scanStringLiteral(state, quote));
+}
+
+// Whether string literal contents need unescape_string, which for a template
+// includes normalizing raw line terminators
+bool hasEscape (const char16_t* start, const char16_t* end, bool template) {
+  return scanToAny((char16_t*)start, end, '\\', template ? '\r' : '\\', '\\', '\\', '\\') != end;
+}
+
+static inline int32_t hexValue (char16_t ch) {
+  if (ch >= '0' && ch <= '9')
+    return ch - '0';
+  ch |= 0x20;
+  if (ch >= 'a' && ch <= 'f')
+    return ch - 'a' + 10;
+  return -1;
+}
+
+// Reads the code unit or code point of a \u escape, after the "u"
+static bool readUnicodeEscape (const char16_t** pos, const char16_t* end, uint32_t* value) {
+  const char16_t* p = *pos;
+  uint32_t cp = 0;
+  if (p < end && *p == '{') {
+    const char16_t* digits = ++p;
+    for (; p < end && *p != '}'; p++) {
+      int32_t digit = hexValue(*p);
+      if (digit < 0 || (cp = cp * 16 + digit) > 0x10FFFF)
+        return false;
+    }
+    if (p == end || p == digits)
+      return false;
+    p++;
+  }
+  else {
+    if (end - p < 4)
+      return false;
+    for (const char16_t* digitsEnd = p + 4; p < digitsEnd; p++) {
+      int32_t digit = hexValue(*p);
+      if (digit < 0)
+        return false;
+      cp = cp * 16 + digit;
+    }
+  }
+  *pos = p;
+  *value = cp;
+  return true;
+}
+
+// Encodes cp as UTF-8, with surrogates encoded like any other code point
+static inline char16_t* writeCodePoint (char16_t* out, uint32_t cp) {
+  if (cp < 0x80) {
+    *out++ = cp;
+  }
+  else if (cp < 0x800) {
+    *out++ = 0xC0 | cp >> 6;
+    *out++ = 0x80 | (cp & 0x3F);
+  }
+  else if (cp < 0x10000) {
+    *out++ = 0xE0 | cp >> 12;
+    *out++ = 0x80 | (cp >> 6 & 0x3F);
+    *out++ = 0x80 | (cp & 0x3F);
+  }
+  else {
+    *out++ = 0xF0 | cp >> 18;
+    *out++ = 0x80 | (cp >> 12 & 0x3F);
+    *out++ = 0x80 | (cp >> 6 & 0x3F);
+    *out++ = 0x80 | (cp & 0x3F);
+  }
+  return out;
+}
+
+// Decodes the string literal contents [start, end) into out, giving the value
+// a JS engine would: escapes including legacy octal and line continuations,
+// or for a template the template rules, under which octal escapes are invalid
+// and raw CR and CRLF read as LF. Returns the length written, at most end -
+// start, or UINT32_MAX for an invalid escape. out may be start, decoding in
+// place. Escaped lone surrogates are written as three byte sequences (WTF-8),
+// and pairs escaped separately are combined.
+uint32_t unescape_string (const char16_t* start, const char16_t* end, bool template, char16_t* out) {
+  char16_t* outStart = out;
+  const char16_t* p = start;
+  while (true) {
+    const char16_t* next = scanToAny((char16_t*)p, end, '\\', template ? '\r' : '\\', '\\', '\\', '\\');
+    memmove(out, p, next - p);
+    out += next - p;
+    p = next;
+    if (p == end)
+      break;
+    if (*p++ == '\r') {
+      if (p < end && *p == '\n')
+        p++;
+      *out++ = '\n';
+      continue;
+    }
+    if (p == end)
+      return UINT32_MAX;
+    char16_t ch = *p++;
+    uint32_t cp;
+    switch (ch) {
+      case 'n': *out++ = '\n'; continue;
+      case 'r': *out++ = '\r'; continue;
+      case 't': *out++ = '\t'; continue;
+      case 'b': *out++ = '\b'; continue;
+      case 'v': *out++ = '\v'; continue;
+      case 'f': *out++ = '\f'; continue;
+      // line continuations
+      case '\r':
+        if (p < end && *p == '\n')
+          p++;
+        continue;
+      case '\n':
+        continue;
+      case 0xE2:
+        // U+2028, U+2029
+        if (end - p >= 2 && p[0] == 0x80 && (p[1] == 0xA8 || p[1] == 0xA9)) {
+          p += 2;
+          continue;
+        }
+        *out++ = ch;
+        continue;
+      case 'x': {
+        int32_t hi = p < end ? hexValue(*p) : -1, lo = end - p >= 2 ? hexValue(p[1]) : -1;
+        if (hi < 0 || lo < 0)
+          return UINT32_MAX;
+        p += 2;
+        cp = hi * 16 + lo;
+        break;
+      }
+      case 'u':
+        if (!readUnicodeEscape(&p, end, &cp))
+          return UINT32_MAX;
+        if (cp >= 0xD800 && cp <= 0xDBFF && end - p >= 2 && p[0] == '\\' && p[1] == 'u') {
+          const char16_t* low = p + 2;
+          uint32_t lowCp;
+          if (readUnicodeEscape(&low, end, &lowCp) && lowCp >= 0xDC00 && lowCp <= 0xDFFF) {
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lowCp - 0xDC00);
+            p = low;
+          }
+        }
+        break;
+      case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+        cp = ch - '0';
+        if (template) {
+          if (cp != 0 || (p < end && *p >= '0' && *p <= '9'))
+            return UINT32_MAX;
+          break;
+        }
+        // \0 - \377
+        if (p < end && *p >= '0' && *p <= '7') {
+          cp = cp * 8 + *p++ - '0';
+          if (ch <= '3' && p < end && *p >= '0' && *p <= '7')
+            cp = cp * 8 + *p++ - '0';
+        }
+        break;
+      case '8': case '9':
+        if (template)
+          return UINT32_MAX;
+        *out++ = ch;
+        continue;
+      default:
+        // the trailing bytes of a multibyte character are copied as they are
+        *out++ = ch;
+        continue;
+    }
+    out = writeCodePoint(out, cp);
+  }
+  return (uint32_t)(out - outStart);
+}
+
 char16_t regexCharacterClass (State *state) {
   while (state->pos++ < state->end) {
+    state->pos = scanToAny(state->pos, state->end, ']', '\\', '\n', '\r', ']');
     char16_t ch = *state->pos;
     if (ch == ']')
       return ch;
@@ -805,8 +1972,9 @@ char16_t regexCharacterClass (State *state) {
   return '\0';
 }
 
-void regularExpression (State *state) {
+static inline void scanRegularExpression (State *state) {
   while (state->pos++ < state->end) {
+    state->pos = scanToAny(state->pos, state->end, '/', '[', '\\', '\n', '\r');
     char16_t ch = *state->pos;
     if (ch == '/')
       return;
@@ -820,11 +1988,15 @@ void regularExpression (State *state) {
   syntaxError(state);
 }
 
+void regularExpression (State *state) {
+  COUNT_SCAN(regular_expression, scanRegularExpression(state));
+}
+
 char16_t readToWsOrPunctuator (State *state, char16_t ch) {
   do {
-    if (isBrOrWs(ch) || isPunctuator(ch))
+    if (isBrOrWs(ch) || isPunctuator(ch) || isNbsp(state->pos, state->end))
       return ch;
-  } while (ch = *(++state->pos));
+  } while (ch = peekChar(state, ++state->pos));
   return ch;
 }
 
@@ -835,15 +2007,15 @@ bool isBr (char16_t c) {
 }
 
 bool isWsNotBr (char16_t c) {
-  return c == 9 || c == 11 || c == 12 || c == 32 || c == 160;
+  return c == 9 || c == 11 || c == 12 || c == 32;
 }
 
 bool isBrOrWs (char16_t c) {
-  return c > 8 && c < 14 || c == 32 || c == 160;
+  return c > 8 && c < 14 || c == 32;
 }
 
 bool isBrOrWsOrPunctuatorNotDot (char16_t c) {
-  return c > 8 && c < 14 || c == 32 || c == 160 || isPunctuator(c) && c != '.';
+  return c > 8 && c < 14 || c == 32 || isPunctuator(c) && c != '.';
 }
 
 bool isQuote (char16_t ch) {
@@ -851,38 +2023,45 @@ bool isQuote (char16_t ch) {
 }
 
 bool keywordStart (State *state) {
-  return state->pos == state->source || isBrOrWsOrPunctuatorNotDot(*(state->pos - 1));
+  return keywordBoundary(state->source, state->pos);
 }
 
 bool readPrecedingKeyword1 (State *state, char16_t* pos, char16_t c1) {
   if (pos < state->source) return false;
-  return *pos == c1 && (pos == state->source || isBrOrWsOrPunctuatorNotDot(*(pos - 1)));
+  return *pos == c1 && keywordBoundary(state->source, pos);
 }
 
-bool readPrecedingKeywordn (State *state, char16_t* pos, const char16_t* compare, size_t n) {
+bool readPrecedingKeywordn (State *state, char16_t* pos, uint64_t word, size_t n) {
   if (pos - n + 1 < state->source) return false;
-  return memcmp(pos - n + 1, compare, n * sizeof(char16_t)) == 0 && (pos - n + 1 == state->source || isBrOrWsOrPunctuatorNotDot(*(pos - n)));
+  return loadWord(pos - n + 1, n) == word && keywordBoundary(state->source, pos - n + 1);
+}
+
+// The byte k before pos, or 0 where that is before the start of the source,
+// which the keyword lookbehinds must not read
+static inline char16_t charBefore (State *state, const char16_t* pos, size_t k) {
+  return pos - state->source >= (ptrdiff_t)k ? *(pos - k) : 0;
 }
 
 // Detects one of case, debugger, delete, do, else, in, instanceof, new,
 //   return, throw, typeof, void, yield ,await
 bool isExpressionKeyword (State *state, char16_t* pos) {
+  STAT(state->result->stats.expression_keyword_checks++);
   switch (*pos) {
     case 'd':
-      switch (*(pos - 1)) {
+      switch (charBefore(state, pos, 1)) {
         case 'i':
           // void
-          return readPrecedingKeywordn(state, pos - 2, &VO[0], 2);
+          return readPrecedingKeywordn(state, pos - 2, KW_VO);
         case 'l':
           // yield
-          return readPrecedingKeywordn(state, pos - 2, &YIE[0], 3);
+          return readPrecedingKeywordn(state, pos - 2, KW_YIE);
         default:
           return false;
       }
     case 'e':
-      switch (*(pos - 1)) {
+      switch (charBefore(state, pos, 1)) {
         case 's':
-          switch (*(pos - 2)) {
+          switch (charBefore(state, pos, 2)) {
             case 'l':
               // else
               return readPrecedingKeyword1(state, pos - 3, 'e');
@@ -894,49 +2073,49 @@ bool isExpressionKeyword (State *state, char16_t* pos) {
           }
         case 't':
           // delete
-          return readPrecedingKeywordn(state, pos - 2, &DELE[0], 4);
+          return readPrecedingKeywordn(state, pos - 2, KW_DELE);
         case 'u':
           // continue
-          return readPrecedingKeywordn(state, pos - 2, &CONTIN[0], 6);
+          return readPrecedingKeywordn(state, pos - 2, KW_CONTIN);
         default:
           return false;
       }
     case 'f':
-      if (*(pos - 1) != 'o' || *(pos - 2) != 'e')
+      if (charBefore(state, pos, 1) != 'o' || charBefore(state, pos, 2) != 'e')
         return false;
-      switch (*(pos - 3)) {
+      switch (charBefore(state, pos, 3)) {
         case 'c':
           // instanceof
-          return readPrecedingKeywordn(state, pos - 4, &INSTAN[0], 6);
+          return readPrecedingKeywordn(state, pos - 4, KW_INSTAN);
         case 'p':
           // typeof
-          return readPrecedingKeywordn(state, pos - 4, &TY[0], 2);
+          return readPrecedingKeywordn(state, pos - 4, KW_TY);
         default:
           return false;
       }
     case 'k':
       // break
-      return readPrecedingKeywordn(state, pos - 1, &BREA[0], 4);
+      return readPrecedingKeywordn(state, pos - 1, KW_BREA);
     case 'n':
       // in, return
-      return readPrecedingKeyword1(state, pos - 1, 'i') || readPrecedingKeywordn(state, pos - 1, &RETUR[0], 5);
+      return readPrecedingKeyword1(state, pos - 1, 'i') || readPrecedingKeywordn(state, pos - 1, KW_RETUR);
     case 'o':
       // do
       return readPrecedingKeyword1(state, pos - 1, 'd');
     case 'r':
       // debugger
-      return readPrecedingKeywordn(state, pos - 1, &DEBUGGE[0], 7);
+      return readPrecedingKeywordn(state, pos - 1, KW_DEBUGGE);
     case 't':
       // await
-      return readPrecedingKeywordn(state, pos - 1, &AWAI[0], 4);
+      return readPrecedingKeywordn(state, pos - 1, KW_AWAI);
     case 'w':
-      switch (*(pos - 1)) {
+      switch (charBefore(state, pos, 1)) {
         case 'e':
           // new
           return readPrecedingKeyword1(state, pos - 2, 'n');
         case 'o':
           // throw
-          return readPrecedingKeywordn(state, pos - 2, &THR[0], 3);
+          return readPrecedingKeywordn(state, pos - 2, KW_THR);
         default:
           return false;
       }
@@ -945,9 +2124,9 @@ bool isExpressionKeyword (State *state, char16_t* pos) {
 }
 
 bool isParenKeyword (State *state, char16_t* curPos) {
-  return readPrecedingKeywordn(state, curPos, &WHILE[0], 5) ||
-      readPrecedingKeywordn(state, curPos, &FOR[0], 3) ||
-      readPrecedingKeywordn(state, curPos, &IF[0], 2);
+  return readPrecedingKeywordn(state, curPos, KW_WHILE) ||
+      readPrecedingKeywordn(state, curPos, KW_FOR) ||
+      readPrecedingKeywordn(state, curPos, KW_IF);
 }
 
 bool isPunctuator (char16_t ch) {
@@ -968,10 +2147,10 @@ bool isExpressionPunctuator (char16_t ch) {
 bool isBreakOrContinue (State *state, char16_t* curPos) {
   switch (*curPos) {
     case 'k':
-      return readPrecedingKeywordn(state, curPos - 1, &BREA[0], 4);
+      return readPrecedingKeywordn(state, curPos - 1, KW_BREA);
     case 'e':
-      if (*(curPos - 1) == 'u')
-        return readPrecedingKeywordn(state, curPos - 2, &CONTIN[0], 6);
+      if (charBefore(state, curPos, 1) == 'u')
+        return readPrecedingKeywordn(state, curPos - 2, KW_CONTIN);
   }
   return false;
 }
@@ -982,104 +2161,44 @@ bool isExpressionTerminator (State *state, char16_t* curPos) {
   // as all of these followed by a { will indicate a statement brace
   switch (*curPos) {
     case '>':
-      return *(curPos - 1) == '=';
+      return charBefore(state, curPos, 1) == '=';
     case ';':
     case ')':
       return true;
     case 'h':
-      return readPrecedingKeywordn(state, curPos - 1, &CATC[0], 4);
+      return readPrecedingKeywordn(state, curPos - 1, KW_CATC);
     case 'y':
-      return readPrecedingKeywordn(state, curPos - 1, &FINALL[0], 6);
+      return readPrecedingKeywordn(state, curPos - 1, KW_FINALL);
     case 'e':
-      return readPrecedingKeywordn(state, curPos - 1, &ELS[0], 3);
-  }
-  return false;
-}
-
-// Identifier detection, ported from Acorn
-// ## Character categories
-
-// Big ugly regular expressions that match characters in the
-// whitespace, identifier, and identifier-start categories. These
-// are only applied when a character is found to actually have a
-// code point above 128.
-// Generated by `bin/generate-identifier-regex.js`.
-
-bool isNonASCIIidentifierStartChar (uint32_t ch) {
-  return ch == 0xaa || ch == 0xb5 || ch == 0xba || ch >= 0xc0 && ch <= 0xd6 || ch >= 0xd8 && ch <= 0xf6 || ch >= 0xf8 && ch <= 0x02c1 ||
-      ch >= 0x02c6 && ch <= 0x02d1 || ch >= 0x02e0 && ch <= 0x02e4 || ch == 0x02ec || ch == 0x02ee || ch >= 0x0370 && ch <= 0x0374 || ch == 0x0376 || ch == 0x0377 || ch >= 0x037a && ch <= 0x037d || ch == 0x037f || ch == 0x0386 || ch >= 0x0388 && ch <= 0x038a || ch == 0x038c || ch >= 0x038e && ch <= 0x03a1 || ch >= 0x03a3 && ch <= 0x03f5 || ch >= 0x03f7 && ch <= 0x0481 || ch >= 0x048a && ch <= 0x052f || ch >= 0x0531 && ch <= 0x0556 || ch == 0x0559 || ch >= 0x0560 && ch <= 0x0588 || ch >= 0x05d0 && ch <= 0x05ea || ch >= 0x05ef && ch <= 0x05f2 || ch >= 0x0620 && ch <= 0x064a || ch == 0x066e || ch == 0x066f || ch >= 0x0671 && ch <= 0x06d3 || ch == 0x06d5 || ch == 0x06e5 || ch == 0x06e6 || ch == 0x06ee || ch == 0x06ef || ch >= 0x06fa && ch <= 0x06fc || ch == 0x06ff || ch == 0x0710 || ch >= 0x0712 && ch <= 0x072f || ch >= 0x074d && ch <= 0x07a5 || ch == 0x07b1 || ch >= 0x07ca && ch <= 0x07ea || ch == 0x07f4 || ch == 0x07f5 || ch == 0x07fa || ch >= 0x0800 && ch <= 0x0815 || ch == 0x081a || ch == 0x0824 || ch == 0x0828 || ch >= 0x0840 && ch <= 0x0858 || ch >= 0x0860 && ch <= 0x086a || ch >= 0x08a0 && ch <= 0x08b4 || ch >= 0x08b6 && ch <= 0x08bd || ch >= 0x0904 && ch <= 0x0939 || ch == 0x093d || ch == 0x0950 || ch >= 0x0958 && ch <= 0x0961 || ch >= 0x0971 && ch <= 0x0980 || ch >= 0x0985 && ch <= 0x098c || ch == 0x098f || ch == 0x0990 || ch >= 0x0993 && ch <= 0x09a8 || ch >= 0x09aa && ch <= 0x09b0 || ch == 0x09b2 || ch >= 0x09b6 && ch <= 0x09b9 || ch == 0x09bd || ch == 0x09ce || ch == 0x09dc || ch == 0x09dd || ch >= 0x09df && ch <= 0x09e1 || ch == 0x09f0 || ch == 0x09f1 || ch == 0x09fc || ch >= 0x0a05 && ch <= 0x0a0a || ch == 0x0a0f || ch == 0x0a10 || ch >= 0x0a13 && ch <= 0x0a28 || ch >= 0x0a2a && ch <= 0x0a30 || ch == 0x0a32 || ch == 0x0a33 || ch == 0x0a35 || ch == 0x0a36 || ch == 0x0a38 || ch == 0x0a39 || ch >= 0x0a59 && ch <= 0x0a5c || ch == 0x0a5e || ch >= 0x0a72 && ch <= 0x0a74 || ch >= 0x0a85 && ch <= 0x0a8d || ch >= 0x0a8f && ch <= 0x0a91 || ch >= 0x0a93 && ch <= 0x0aa8 || ch >= 0x0aaa && ch <= 0x0ab0 || ch == 0x0ab2 || ch == 0x0ab3 || ch >= 0x0ab5 && ch <= 0x0ab9 || ch == 0x0abd || ch == 0x0ad0 || ch == 0x0ae0 || ch == 0x0ae1 || ch == 0x0af9 || ch >= 0x0b05 && ch <= 0x0b0c || ch == 0x0b0f || ch == 0x0b10 || ch >= 0x0b13 && ch <= 0x0b28 || ch >= 0x0b2a && ch <= 0x0b30 || ch == 0x0b32 || ch == 0x0b33 || ch >= 0x0b35 && ch <= 0x0b39 || ch == 0x0b3d || ch == 0x0b5c || ch == 0x0b5d || ch >= 0x0b5f && ch <= 0x0b61 || ch == 0x0b71 || ch == 0x0b83 || ch >= 0x0b85 && ch <= 0x0b8a || ch >= 0x0b8e && ch <= 0x0b90 || ch >= 0x0b92 && ch <= 0x0b95 || ch == 0x0b99 || ch == 0x0b9a || ch == 0x0b9c || ch == 0x0b9e || ch == 0x0b9f || ch == 0x0ba3 || ch == 0x0ba4 || ch >= 0x0ba8 && ch <= 0x0baa || ch >= 0x0bae && ch <= 0x0bb9 || ch == 0x0bd0 || ch >= 0x0c05 && ch <= 0x0c0c || ch >= 0x0c0e && ch <= 0x0c10 || ch >= 0x0c12 && ch <= 0x0c28 || ch >= 0x0c2a && ch <= 0x0c39 || ch == 0x0c3d || ch >= 0x0c58 && ch <= 0x0c5a || ch == 0x0c60 || ch == 0x0c61 || ch == 0x0c80 || ch >= 0x0c85 && ch <= 0x0c8c || ch >= 0x0c8e && ch <= 0x0c90 || ch >= 0x0c92 && ch <= 0x0ca8 || ch >= 0x0caa && ch <= 0x0cb3 || ch >= 0x0cb5 && ch <= 0x0cb9 || ch == 0x0cbd || ch == 0x0cde || ch == 0x0ce0 || ch == 0x0ce1 || ch == 0x0cf1 || ch == 0x0cf2 || ch >= 0x0d05 && ch <= 0x0d0c || ch >= 0x0d0e && ch <= 0x0d10 || ch >= 0x0d12 && ch <= 0x0d3a || ch == 0x0d3d || ch == 0x0d4e || ch >= 0x0d54 && ch <= 0x0d56 || ch >= 0x0d5f && ch <= 0x0d61 || ch >= 0x0d7a && ch <= 0x0d7f || ch >= 0x0d85 && ch <= 0x0d96 || ch >= 0x0d9a && ch <= 0x0db1 || ch >= 0x0db3 && ch <= 0x0dbb || ch == 0x0dbd || ch >= 0x0dc0 && ch <= 0x0dc6 || ch >= 0x0e01 && ch <= 0x0e30 || ch == 0x0e32 || ch == 0x0e33 || ch >= 0x0e40 && ch <= 0x0e46 || ch == 0x0e81 || ch == 0x0e82 || ch == 0x0e84 || ch == 0x0e87 || ch == 0x0e88 || ch == 0x0e8a || ch == 0x0e8d || ch >= 0x0e94 && ch <= 0x0e97 || ch >= 0x0e99 && ch <= 0x0e9f || ch >= 0x0ea1 && ch <= 0x0ea3 || ch == 0x0ea5 || ch == 0x0ea7 || ch == 0x0eaa || ch == 0x0eab || ch >= 0x0ead && ch <= 0x0eb0 || ch == 0x0eb2 || ch == 0x0eb3 || ch == 0x0ebd || ch >= 0x0ec0 && ch <= 0x0ec4 || ch == 0x0ec6 || ch >= 0x0edc && ch <= 0x0edf || ch == 0x0f00 || ch >= 0x0f40 && ch <= 0x0f47 || ch >= 0x0f49 && ch <= 0x0f6c || ch >= 0x0f88 && ch <= 0x0f8c || ch >= 0x1000 && ch <= 0x102a || ch == 0x103f || ch >= 0x1050 && ch <= 0x1055 || ch >= 0x105a && ch <= 0x105d || ch == 0x1061 || ch == 0x1065 || ch == 0x1066 || ch >= 0x106e && ch <= 0x1070 || ch >= 0x1075 && ch <= 0x1081 || ch == 0x108e || ch >= 0x10a0 && ch <= 0x10c5 || ch == 0x10c7 || ch == 0x10cd || ch >= 0x10d0 && ch <= 0x10fa || ch >= 0x10fc && ch <= 0x1248 || ch >= 0x124a && ch <= 0x124d || ch >= 0x1250 && ch <= 0x1256 || ch == 0x1258 || ch >= 0x125a && ch <= 0x125d || ch >= 0x1260 && ch <= 0x1288 || ch >= 0x128a && ch <= 0x128d || ch >= 0x1290 && ch <= 0x12b0 || ch >= 0x12b2 && ch <= 0x12b5 || ch >= 0x12b8 && ch <= 0x12be || ch == 0x12c0 || ch >= 0x12c2 && ch <= 0x12c5 || ch >= 0x12c8 && ch <= 0x12d6 || ch >= 0x12d8 && ch <= 0x1310 || ch >= 0x1312 && ch <= 0x1315 || ch >= 0x1318 && ch <= 0x135a || ch >= 0x1380 && ch <= 0x138f || ch >= 0x13a0 && ch <= 0x13f5 || ch >= 0x13f8 && ch <= 0x13fd || ch >= 0x1401 && ch <= 0x166c || ch >= 0x166f && ch <= 0x167f || ch >= 0x1681 && ch <= 0x169a || ch >= 0x16a0 && ch <= 0x16ea || ch >= 0x16ee && ch <= 0x16f8 || ch >= 0x1700 && ch <= 0x170c || ch >= 0x170e && ch <= 0x1711 || ch >= 0x1720 && ch <= 0x1731 || ch >= 0x1740 && ch <= 0x1751 || ch >= 0x1760 && ch <= 0x176c || ch >= 0x176e && ch <= 0x1770 || ch >= 0x1780 && ch <= 0x17b3 || ch == 0x17d7 || ch == 0x17dc || ch >= 0x1820 && ch <= 0x1878 || ch >= 0x1880 && ch <= 0x18a8 || ch == 0x18aa || ch >= 0x18b0 && ch <= 0x18f5 || ch >= 0x1900 && ch <= 0x191e || ch >= 0x1950 && ch <= 0x196d || ch >= 0x1970 && ch <= 0x1974 || ch >= 0x1980 && ch <= 0x19ab || ch >= 0x19b0 && ch <= 0x19c9 || ch >= 0x1a00 && ch <= 0x1a16 || ch >= 0x1a20 && ch <= 0x1a54 || ch == 0x1aa7 || ch >= 0x1b05 && ch <= 0x1b33 || ch >= 0x1b45 && ch <= 0x1b4b || ch >= 0x1b83 && ch <= 0x1ba0 || ch == 0x1bae || ch == 0x1baf || ch >= 0x1bba && ch <= 0x1be5 || ch >= 0x1c00 && ch <= 0x1c23 || ch >= 0x1c4d && ch <= 0x1c4f || ch >= 0x1c5a && ch <= 0x1c7d || ch >= 0x1c80 && ch <= 0x1c88 || ch >= 0x1c90 && ch <= 0x1cba || ch >= 0x1cbd && ch <= 0x1cbf || ch >= 0x1ce9 && ch <= 0x1cec || ch >= 0x1cee && ch <= 0x1cf1 || ch == 0x1cf5 || ch == 0x1cf6 || ch >= 0x1d00 && ch <= 0x1dbf || ch >= 0x1e00 && ch <= 0x1f15 || ch >= 0x1f18 && ch <= 0x1f1d || ch >= 0x1f20 && ch <= 0x1f45 || ch >= 0x1f48 && ch <= 0x1f4d || ch >= 0x1f50 && ch <= 0x1f57 || ch == 0x1f59 || ch == 0x1f5b || ch == 0x1f5d || ch >= 0x1f5f && ch <= 0x1f7d || ch >= 0x1f80 && ch <= 0x1fb4 || ch >= 0x1fb6 && ch <= 0x1fbc || ch == 0x1fbe || ch >= 0x1fc2 && ch <= 0x1fc4 || ch >= 0x1fc6 && ch <= 0x1fcc || ch >= 0x1fd0 && ch <= 0x1fd3 || ch >= 0x1fd6 && ch <= 0x1fdb || ch >= 0x1fe0 && ch <= 0x1fec || ch >= 0x1ff2 && ch <= 0x1ff4 || ch >= 0x1ff6 && ch <= 0x1ffc || ch == 0x2071 || ch == 0x207f || ch >= 0x2090 && ch <= 0x209c || ch == 0x2102 || ch == 0x2107 || ch >= 0x210a && ch <= 0x2113 || ch == 0x2115 || ch >= 0x2118 && ch <= 0x211d || ch == 0x2124 || ch == 0x2126 || ch == 0x2128 || ch >= 0x212a && ch <= 0x2139 || ch >= 0x213c && ch <= 0x213f || ch >= 0x2145 && ch <= 0x2149 || ch == 0x214e || ch >= 0x2160 && ch <= 0x2188 || ch >= 0x2c00 && ch <= 0x2c2e || ch >= 0x2c30 && ch <= 0x2c5e || ch >= 0x2c60 && ch <= 0x2ce4 || ch >= 0x2ceb && ch <= 0x2cee || ch == 0x2cf2 || ch == 0x2cf3 || ch >= 0x2d00 && ch <= 0x2d25 || ch == 0x2d27 || ch == 0x2d2d || ch >= 0x2d30 && ch <= 0x2d67 || ch == 0x2d6f || ch >= 0x2d80 && ch <= 0x2d96 || ch >= 0x2da0 && ch <= 0x2da6 || ch >= 0x2da8 && ch <= 0x2dae || ch >= 0x2db0 && ch <= 0x2db6 || ch >= 0x2db8 && ch <= 0x2dbe || ch >= 0x2dc0 && ch <= 0x2dc6 || ch >= 0x2dc8 && ch <= 0x2dce || ch >= 0x2dd0 && ch <= 0x2dd6 || ch >= 0x2dd8 && ch <= 0x2dde || ch >= 0x3005 && ch <= 0x3007 || ch >= 0x3021 && ch <= 0x3029 || ch >= 0x3031 && ch <= 0x3035 || ch >= 0x3038 && ch <= 0x303c || ch >= 0x3041 && ch <= 0x3096 || ch >= 0x309b && ch <= 0x309f || ch >= 0x30a1 && ch <= 0x30fa || ch >= 0x30fc && ch <= 0x30ff || ch >= 0x3105 && ch <= 0x312f || ch >= 0x3131 && ch <= 0x318e || ch >= 0x31a0 && ch <= 0x31ba || ch >= 0x31f0 && ch <= 0x31ff || ch >= 0x3400 && ch <= 0x4db5 || ch >= 0x4e00 && ch <= 0x9fef || ch >= 0xa000 && ch <= 0xa48c || ch >= 0xa4d0 && ch <= 0xa4fd || ch >= 0xa500 && ch <= 0xa60c || ch >= 0xa610 && ch <= 0xa61f || ch == 0xa62a || ch == 0xa62b || ch >= 0xa640 && ch <= 0xa66e || ch >= 0xa67f && ch <= 0xa69d || ch >= 0xa6a0 && ch <= 0xa6ef || ch >= 0xa717 && ch <= 0xa71f || ch >= 0xa722 && ch <= 0xa788 || ch >= 0xa78b && ch <= 0xa7b9 || ch >= 0xa7f7 && ch <= 0xa801 || ch >= 0xa803 && ch <= 0xa805 || ch >= 0xa807 && ch <= 0xa80a || ch >= 0xa80c && ch <= 0xa822 || ch >= 0xa840 && ch <= 0xa873 || ch >= 0xa882 && ch <= 0xa8b3 || ch >= 0xa8f2 && ch <= 0xa8f7 || ch == 0xa8fb || ch == 0xa8fd || ch == 0xa8fe || ch >= 0xa90a && ch <= 0xa925 || ch >= 0xa930 && ch <= 0xa946 || ch >= 0xa960 && ch <= 0xa97c || ch >= 0xa984 && ch <= 0xa9b2 || ch == 0xa9cf || ch >= 0xa9e0 && ch <= 0xa9e4 || ch >= 0xa9e6 && ch <= 0xa9ef || ch >= 0xa9fa && ch <= 0xa9fe || ch >= 0xaa00 && ch <= 0xaa28 || ch >= 0xaa40 && ch <= 0xaa42 || ch >= 0xaa44 && ch <= 0xaa4b || ch >= 0xaa60 && ch <= 0xaa76 || ch == 0xaa7a || ch >= 0xaa7e && ch <= 0xaaaf || ch == 0xaab1 || ch == 0xaab5 || ch == 0xaab6 || ch >= 0xaab9 && ch <= 0xaabd || ch == 0xaac0 || ch == 0xaac2 || ch >= 0xaadb && ch <= 0xaadd || ch >= 0xaae0 && ch <= 0xaaea || ch >= 0xaaf2 && ch <= 0xaaf4 || ch >= 0xab01 && ch <= 0xab06 || ch >= 0xab09 && ch <= 0xab0e || ch >= 0xab11 && ch <= 0xab16 || ch >= 0xab20 && ch <= 0xab26 || ch >= 0xab28 && ch <= 0xab2e ||
-      ch >= 0xab30 && ch <= 0xab5a || ch >= 0xab5c && ch <= 0xab65 || ch >= 0xab70 && ch <= 0xabe2 || ch >= 0xac00 && ch <= 0xd7a3 || ch >= 0xd7b0 && ch <= 0xd7c6 || ch >= 0xd7cb && ch <= 0xd7fb || ch >= 0xf900 && ch <= 0xfa6d || ch >= 0xfa70 && ch <= 0xfad9 || ch >= 0xfb00 && ch <= 0xfb06 || ch >= 0xfb13 && ch <= 0xfb17 || ch == 0xfb1d || ch >= 0xfb1f && ch <= 0xfb28 || ch >= 0xfb2a && ch <= 0xfb36 || ch >= 0xfb38 && ch <= 0xfb3c || ch == 0xfb3e || ch == 0xfb40 || ch == 0xfb41 || ch == 0xfb43 || ch == 0xfb44 || ch >= 0xfb46 && ch <= 0xfbb1 || ch >= 0xfbd3 && ch <= 0xfd3d || ch >= 0xfd50 && ch <= 0xfd8f || ch >= 0xfd92 && ch <= 0xfdc7 || ch >= 0xfdf0 && ch <= 0xfdfb || ch >= 0xfe70 && ch <= 0xfe74 || ch >= 0xfe76 && ch <= 0xfefc || ch >= 0xff21 && ch <= 0xff3a || ch >= 0xff41 && ch <= 0xff5a || ch >= 0xff66 && ch <= 0xffbe || ch >= 0xffc2 && ch <= 0xffc7 || ch >= 0xffca && ch <= 0xffcf || ch >= 0xffd2 && ch <= 0xffd7 || ch >= 0xffda && ch <= 0xffdc;
-}
-
-bool isNonASCIIidentifierChar (uint32_t ch) {
-  return isNonASCIIidentifierStartChar(ch) || ch == 0x200c || ch == 0x200d || ch == 0xb7 || ch >= 0x0300 && ch <= 0x036f || ch == 0x0387 || ch >= 0x0483 && ch <= 0x0487 || ch >= 0x0591 && ch <= 0x05bd || ch == 0x05bf || ch == 0x05c1 || ch == 0x05c2 || ch == 0x05c4 || ch == 0x05c5 || ch == 0x05c7 || ch >= 0x0610 && ch <= 0x061a || ch >= 0x064b && ch <= 0x0669 || ch == 0x0670 || ch >= 0x06d6 && ch <= 0x06dc || ch >= 0x06df && ch <= 0x06e4 || ch == 0x06e7 || ch == 0x06e8 || ch >= 0x06ea && ch <= 0x06ed || ch >= 0x06f0 && ch <= 0x06f9 || ch == 0x0711 || ch >= 0x0730 && ch <= 0x074a || ch >= 0x07a6 && ch <= 0x07b0 || ch >= 0x07c0 && ch <= 0x07c9 || ch >= 0x07eb && ch <= 0x07f3 || ch == 0x07fd || ch >= 0x0816 && ch <= 0x0819 || ch >= 0x081b && ch <= 0x0823 || ch >= 0x0825 && ch <= 0x0827 || ch >= 0x0829 && ch <= 0x082d || ch >= 0x0859 && ch <= 0x085b || ch >= 0x08d3 && ch <= 0x08e1 || ch >= 0x08e3 && ch <= 0x0903 || ch >= 0x093a && ch <= 0x093c || ch >= 0x093e && ch <= 0x094f || ch >= 0x0951 && ch <= 0x0957 || ch == 0x0962 || ch == 0x0963 || ch >= 0x0966 && ch <= 0x096f || ch >= 0x0981 && ch <= 0x0983 || ch == 0x09bc || ch >= 0x09be && ch <= 0x09c4 || ch == 0x09c7 || ch == 0x09c8 || ch >= 0x09cb && ch <= 0x09cd || ch == 0x09d7 || ch == 0x09e2 || ch == 0x09e3 || ch >= 0x09e6 && ch <= 0x09ef || ch == 0x09fe || ch >= 0x0a01 && ch <= 0x0a03 || ch == 0x0a3c || ch >= 0x0a3e && ch <= 0x0a42 || ch == 0x0a47 || ch == 0x0a48 || ch >= 0x0a4b && ch <= 0x0a4d || ch == 0x0a51 || ch >= 0x0a66 && ch <= 0x0a71 || ch == 0x0a75 || ch >= 0x0a81 && ch <= 0x0a83 || ch == 0x0abc || ch >= 0x0abe && ch <= 0x0ac5 || ch >= 0x0ac7 && ch <= 0x0ac9 || ch >= 0x0acb && ch <= 0x0acd || ch == 0x0ae2 || ch == 0x0ae3 || ch >= 0x0ae6 && ch <= 0x0aef || ch >= 0x0afa && ch <= 0x0aff || ch >= 0x0b01 && ch <= 0x0b03 || ch == 0x0b3c || ch >= 0x0b3e && ch <= 0x0b44 || ch == 0x0b47 || ch == 0x0b48 || ch >= 0x0b4b && ch <= 0x0b4d || ch == 0x0b56 || ch == 0x0b57 || ch == 0x0b62 || ch == 0x0b63 || ch >= 0x0b66 && ch <= 0x0b6f || ch == 0x0b82 || ch >= 0x0bbe && ch <= 0x0bc2 || ch >= 0x0bc6 && ch <= 0x0bc8 || ch >= 0x0bca && ch <= 0x0bcd || ch == 0x0bd7 || ch >= 0x0be6 && ch <= 0x0bef || ch >= 0x0c00 && ch <= 0x0c04 || ch >= 0x0c3e && ch <= 0x0c44 || ch >= 0x0c46 && ch <= 0x0c48 || ch >= 0x0c4a && ch <= 0x0c4d || ch == 0x0c55 || ch == 0x0c56 || ch == 0x0c62 || ch == 0x0c63 || ch >= 0x0c66 && ch <= 0x0c6f || ch >= 0x0c81 && ch <= 0x0c83 || ch == 0x0cbc || ch >= 0x0cbe && ch <= 0x0cc4 || ch >= 0x0cc6 && ch <= 0x0cc8 || ch >= 0x0cca && ch <= 0x0ccd || ch == 0x0cd5 || ch == 0x0cd6 || ch == 0x0ce2 || ch == 0x0ce3 || ch >= 0x0ce6 && ch <= 0x0cef || ch >= 0x0d00 && ch <= 0x0d03 || ch == 0x0d3b || ch == 0x0d3c || ch >= 0x0d3e && ch <= 0x0d44 || ch >= 0x0d46 && ch <= 0x0d48 || ch >= 0x0d4a && ch <= 0x0d4d || ch == 0x0d57 || ch == 0x0d62 || ch == 0x0d63 || ch >= 0x0d66 && ch <= 0x0d6f || ch == 0x0d82 || ch == 0x0d83 || ch == 0x0dca || ch >= 0x0dcf && ch <= 0x0dd4 || ch == 0x0dd6 || ch >= 0x0dd8 && ch <= 0x0ddf || ch >= 0x0de6 && ch <= 0x0def || ch == 0x0df2 || ch == 0x0df3 || ch == 0x0e31 || ch >= 0x0e34 && ch <= 0x0e3a || ch >= 0x0e47 && ch <= 0x0e4e || ch >= 0x0e50 && ch <= 0x0e59 || ch == 0x0eb1 || ch >= 0x0eb4 && ch <= 0x0eb9 || ch == 0x0ebb || ch == 0x0ebc || ch >= 0x0ec8 && ch <= 0x0ecd || ch >= 0x0ed0 && ch <= 0x0ed9 || ch == 0x0f18 || ch == 0x0f19 || ch >= 0x0f20 && ch <= 0x0f29 || ch == 0x0f35 || ch == 0x0f37 || ch == 0x0f39 || ch == 0x0f3e || ch == 0x0f3f || ch >= 0x0f71 && ch <= 0x0f84 || ch == 0x0f86 || ch == 0x0f87 || ch >= 0x0f8d && ch <= 0x0f97 || ch >= 0x0f99 && ch <= 0x0fbc || ch == 0x0fc6 || ch >= 0x102b && ch <= 0x103e || ch >= 0x1040 && ch <= 0x1049 || ch >= 0x1056 && ch <= 0x1059 || ch >= 0x105e && ch <= 0x1060 || ch >= 0x1062 && ch <= 0x1064 || ch >= 0x1067 && ch <= 0x106d || ch >= 0x1071 && ch <= 0x1074 || ch >= 0x1082 && ch <= 0x108d || ch >= 0x108f && ch <= 0x109d || ch >= 0x135d && ch <= 0x135f || ch >= 0x1369 && ch <= 0x1371 || ch >= 0x1712 && ch <= 0x1714 || ch >= 0x1732 && ch <= 0x1734 || ch == 0x1752 || ch == 0x1753 || ch == 0x1772 || ch == 0x1773 || ch >= 0x17b4 && ch <= 0x17d3 || ch == 0x17dd || ch >= 0x17e0 && ch <= 0x17e9 || ch >= 0x180b && ch <= 0x180d || ch >= 0x1810 && ch <= 0x1819 || ch == 0x18a9 || ch >= 0x1920 && ch <= 0x192b || ch >= 0x1930 && ch <= 0x193b || ch >= 0x1946 && ch <= 0x194f || ch >= 0x19d0 && ch <= 0x19da || ch >= 0x1a17 && ch <= 0x1a1b || ch >= 0x1a55 && ch <= 0x1a5e || ch >= 0x1a60 && ch <= 0x1a7c || ch >= 0x1a7f && ch <= 0x1a89 || ch >= 0x1a90 && ch <= 0x1a99 || ch >= 0x1ab0 && ch <= 0x1abd || ch >= 0x1b00 && ch <= 0x1b04 || ch >= 0x1b34 && ch <= 0x1b44 || ch >= 0x1b50 && ch <= 0x1b59 || ch >= 0x1b6b && ch <= 0x1b73 || ch >= 0x1b80 && ch <= 0x1b82 || ch >= 0x1ba1 && ch <= 0x1bad || ch >= 0x1bb0 && ch <= 0x1bb9 || ch >= 0x1be6 && ch <= 0x1bf3 || ch >= 0x1c24 && ch <= 0x1c37 || ch >= 0x1c40 && ch <= 0x1c49 || ch >= 0x1c50 && ch <= 0x1c59 || ch >= 0x1cd0 && ch <= 0x1cd2 || ch >= 0x1cd4 && ch <= 0x1ce8 || ch == 0x1ced || ch >= 0x1cf2 && ch <= 0x1cf4 || ch >= 0x1cf7 && ch <= 0x1cf9 || ch >= 0x1dc0 && ch <= 0x1df9 || ch >= 0x1dfb && ch <= 0x1dff || ch == 0x203f || ch == 0x2040 || ch == 0x2054 || ch >= 0x20d0 && ch <= 0x20dc || ch == 0x20e1 || ch >= 0x20e5 && ch <= 0x20f0 || ch >= 0x2cef && ch <= 0x2cf1 || ch == 0x2d7f || ch >= 0x2de0 && ch <= 0x2dff || ch >= 0x302a && ch <= 0x302f || ch == 0x3099 || ch == 0x309a || ch >= 0xa620 && ch <= 0xa629 || ch == 0xa66f || ch >= 0xa674 && ch <= 0xa67d || ch == 0xa69e || ch == 0xa69f || ch == 0xa6f0 || ch == 0xa6f1 || ch == 0xa802 || ch == 0xa806 || ch == 0xa80b || ch >= 0xa823 && ch <= 0xa827 || ch == 0xa880 || ch == 0xa881 || ch >= 0xa8b4 && ch <= 0xa8c5 || ch >= 0xa8d0 && ch <= 0xa8d9 || ch >= 0xa8e0 && ch <= 0xa8f1 || ch >= 0xa8ff && ch <= 0xa909 || ch >= 0xa926 && ch <= 0xa92d || ch >= 0xa947 && ch <= 0xa953 || ch >= 0xa980 && ch <= 0xa983 || ch >= 0xa9b3 && ch <= 0xa9c0 || ch >= 0xa9d0 && ch <= 0xa9d9 || ch == 0xa9e5 || ch >= 0xa9f0 && ch <= 0xa9f9 || ch >= 0xaa29 && ch <= 0xaa36 || ch == 0xaa43 || ch == 0xaa4c || ch == 0xaa4d || ch >= 0xaa50 && ch <= 0xaa59 || ch >= 0xaa7b && ch <= 0xaa7d || ch == 0xaab0 || ch >= 0xaab2 && ch <= 0xaab4 || ch == 0xaab7 || ch == 0xaab8 || ch == 0xaabe || ch == 0xaabf || ch == 0xaac1 || ch >= 0xaaeb && ch <= 0xaaef || ch == 0xaaf5 || ch == 0xaaf6 || ch >= 0xabe3 && ch <= 0xabea || ch == 0xabec || ch == 0xabed || ch >= 0xabf0 && ch <= 0xabf9 || ch == 0xfb1e || ch >= 0xfe00 && ch <= 0xfe0f || ch >= 0xfe20 && ch <= 0xfe2f || ch == 0xfe33 || ch == 0xfe34 || ch >= 0xfe4d && ch <= 0xfe4f || ch >= 0xff10 && ch <= 0xff19 || ch == 0xff3f;
-}
-
-// These are a run-length and offset encoded representation of the
-// >0xffff code points that are a valid part of identifiers. The
-// offset starts at 0x10000, and each pair of numbers represents an
-// offset to the next range, and then a size of the range. They were
-// generated by bin/generate-identifier-regex.js
-
-static uint32_t astralIdentifierStartCodes[] = { 0,11,2,25,2,18,2,1,2,14,3,13,35,122,70,52,268,28,4,48,48,31,14,29,6,37,11,29,3,35,5,7,2,4,43,157,19,35,5,35,5,39,9,51,157,310,10,21,11,7,153,5,3,0,2,43,2,1,4,0,3,22,11,22,10,30,66,18,2,1,11,21,11,25,71,55,7,1,65,0,16,3,2,2,2,28,43,28,4,28,36,7,2,27,28,53,11,21,11,18,14,17,111,72,56,50,14,50,14,35,349,41,7,1,79,28,11,0,9,21,107,20,28,22,13,52,76,44,33,24,27,35,30,0,3,0,9,34,4,0,13,47,15,3,22,0,2,0,36,17,2,24,85,6,2,0,2,3,2,14,2,9,8,46,39,7,3,1,3,21,2,6,2,1,2,4,4,0,19,0,13,4,159,52,19,3,21,2,31,47,21,1,2,0,185,46,42,3,37,47,21,0,60,42,14,0,72,26,230,43,117,63,32,7,3,0,3,7,2,1,2,23,16,0,2,0,95,7,3,38,17,0,2,0,29,0,11,39,8,0,22,0,12,45,20,0,35,56,264,8,2,36,18,0,50,29,113,6,2,1,2,37,22,0,26,5,2,1,2,31,15,0,328,18,190,0,80,921,103,110,18,195,2749,1070,4050,582,8634,568,8,30,114,29,19,47,17,3,32,20,6,18,689,63,129,74,6,0,67,12,65,1,2,0,29,6135,9,1237,43,8,8952,286,50,2,18,3,9,395,2309,106,6,12,4,8,8,9,5991,84,2,70,2,1,3,0,3,1,3,3,2,11,2,0,2,6,2,64,2,3,3,7,2,6,2,27,2,3,2,4,2,0,4,6,2,339,3,24,2,24,2,30,2,24,2,30,2,24,2,30,2,24,2,30,2,24,2,7,2357,44,11,6,17,0,370,43,1301,196,60,67,8,0,1205,3,2,26,2,1,2,0,3,0,2,9,2,3,2,0,2,0,7,0,5,0,2,0,2,0,2,2,2,1,2,0,3,0,2,0,2,0,2,0,2,0,2,1,2,0,3,3,2,6,2,3,2,3,2,0,2,9,2,16,6,2,2,4,2,16,4421,42717,35,4148,12,221,3,5761,15,7472,3104,541,1507,4938 };
-
-static uint32_t astralIdentifierCodes[] = { 509,0,227,0,150,4,294,9,1368,2,2,1,6,3,41,2,5,0,166,1,574,3,9,9,370,1,154,10,176,2,54,14,32,9,16,3,46,10,54,9,7,2,37,13,2,9,6,1,45,0,13,2,49,13,9,3,2,11,83,11,7,0,161,11,6,9,7,3,56,1,2,6,3,1,3,2,10,0,11,1,3,6,4,4,193,17,10,9,5,0,82,19,13,9,214,6,3,8,28,1,83,16,16,9,82,12,9,9,84,14,5,9,243,14,166,9,71,5,2,1,3,3,2,0,2,1,13,9,120,6,3,6,4,0,29,9,41,6,2,3,9,0,10,10,47,15,406,7,2,7,17,9,57,21,2,13,123,5,4,0,2,1,2,6,2,0,9,9,49,4,2,1,2,4,9,9,330,3,19306,9,135,4,60,6,26,9,1014,0,2,54,8,3,82,0,12,1,19628,1,5319,4,4,5,9,7,3,6,31,3,149,2,1418,49,513,54,5,49,9,0,15,0,23,4,2,14,1361,6,2,16,3,6,2,1,2,4,262,6,10,9,419,13,1495,6,110,6,6,9,4759,9,787719,239 };
-
-// This has a complexity linear to the value of the code. The
-// assumption is that looking up astral identifier characters is
-// rare.
-bool isInAstralIdentifierStartCodes (uint32_t code) {
-  uint32_t cur = 0x10000;
-  for (unsigned int i = 0; i < sizeof(astralIdentifierStartCodes) / sizeof(uint32_t); i += 2) {
-    cur += astralIdentifierStartCodes[i];
-    if (cur > code)
-      return false;
-    cur += astralIdentifierStartCodes[i + 1];
-    if (cur >= code)
-      return true;
-  }
-  return false;
-}
-
-bool isInAstralIdentifierCodes (uint32_t code) {
-  uint32_t cur = 0x10000;
-  for (unsigned int i = 0; i < sizeof(astralIdentifierCodes) / sizeof(uint32_t); i += 2) {
-    cur += astralIdentifierCodes[i];
-    if (cur > code)
-      return false;
-    cur += astralIdentifierCodes[i + 1];
-    if (cur >= code)
-      return true;
+      return readPrecedingKeywordn(state, curPos - 1, KW_ELS);
   }
   return false;
 }
 
 // Test whether a given character code starts an identifier.
-bool isIdentifierStart(uint32_t code) {
-  if (code < 65) return code == 36;
-  if (code < 91) return true;
-  if (code < 97) return code == 95;
-  if (code < 123) return true;
-  if (code <= 0xffff) return code >= 0xaa && isNonASCIIidentifierStartChar(code);
-  return isInAstralIdentifierStartCodes(code);
+bool isIdentifierStart (uint32_t code) {
+  if (code >= IDENTIFIER_BLOCKS << 8) return false;
+  return identifierStartBits[identifierBlocks[code >> 8]][code >> 5 & 7] >> (code & 31) & 1;
 }
 
 // Test whether a given character is part of an identifier.
-
-bool isIdentifierChar(uint32_t code) {
-  if (code < 48) return code == 36;
-  if (code < 58) return true;
-  if (code < 65) return false;
-  if (code < 91) return true;
-  if (code < 97) return code == 95;
-  if (code < 123) return true;
-  if (code <= 0xffff) return code >= 0xaa && isNonASCIIidentifierChar(code);
-  return isInAstralIdentifierStartCodes(code) || isInAstralIdentifierCodes(code);
+bool isIdentifierChar (uint32_t code) {
+  if (code >= IDENTIFIER_BLOCKS << 8) return false;
+  return identifierPartBits[identifierBlocks[code >> 8]][code >> 5 & 7] >> (code & 31) & 1;
 }
 
 uint32_t nextChar(State *state) {
   uint32_t c;
   int e;
+  // utf8_decode always reads four bytes, so decode the last few from a copy
+  if (state->pos > state->end || state->end - state->pos < 3) {
+    unsigned char buf[4] = { 0 };
+    if (state->pos <= state->end)
+      memcpy(buf, state->pos, state->end - state->pos + 1);
+    state->pos += (unsigned char*)utf8_decode(buf, &c, &e) - buf;
+    state->reachedEnd = true;
+    return c;
+  }
   state->pos = utf8_decode(state->pos, &c, &e);
   return c;
 }
@@ -26,6 +26,8 @@ struct Import {
   const char16_t* assert_index;
   const char16_t* dynamic;
   bool safe;
+  // whether the string specifier of a safe import has escapes to decode
+  bool escaped;
   struct Import* next;
 };
 typedef struct Import Import;
@@ -52,20 +54,129 @@ struct Export {
   const char16_t* end;
   const char16_t* local_start;
   const char16_t* local_end;
+  // whether quoted names have escapes to decode
+  bool escaped;
+  bool local_escaped;
   struct Export* next;
 };
 typedef struct Export Export;
 
 typedef void *(*Allocator)(uint32_t bytes, void *user_data);
 
+#ifdef LEXER_STATS
+#define STAT(statement) statement
+
+// The calls of a scanning routine and the bytes it advanced over
+struct ScanStats {
+  uint64_t calls;
+  uint64_t bytes;
+};
+typedef struct ScanStats ScanStats;
+
+// Hot path counters of one parse, kept by builds with LEXER_STATS defined
+struct LexStats {
+  ScanStats line_comment;
+  ScanStats block_comment;
+  ScanStats string_literal;
+  ScanStats template_string;
+  ScanStats regular_expression;
+  uint64_t expression_keyword_checks;
+  // how each / that does not start a comment was read
+  uint64_t regex_decisions;
+  uint64_t division_decisions;
+  // dynamic imports dropped on a following {, as in import () {}
+  uint64_t dynamic_import_removals;
+  uint64_t allocations;
+  uint64_t allocated_bytes;
+  uint32_t max_open_token_depth;
+  uint32_t max_dynamic_import_depth;
+};
+typedef struct LexStats LexStats;
+#else
+#define STAT(statement)
+#endif
+
 struct ParseResult {
   Import *first_import;
   Export *first_export;
   uint32_t parse_error;
+  bool facade;
+  // with LineStarts, the offset at which each line starts, after each '\n'
+  uint32_t *line_starts;
+  uint32_t line_count;
+#ifdef LEXER_STATS
+  LexStats stats;
+#endif
 };
 
 typedef struct ParseResult ParseResult;
 
+// Options for parse_options. Flags drop records the caller does not need,
+// which are then never built, ask for the line starts, and set goals after
+// which lexing stops early, returning the records found so far.
+enum LexFlags {
+  NoImports = 1,
+  NoExports = 2,
+  FacadeOnly = 4, // stop once the source is known not to be a facade
+  LineStarts = 8, // record where each line starts, into line_starts
+};
+
+struct LexOptions {
+  uint32_t flags;
+  // stop after this many static imports, counting export from, 0 for no limit
+  uint32_t maxImports;
+};
+typedef struct LexOptions LexOptions;
+
+// A position that lexing can restart from after an edit: a dispatch at a
+// shallow open token depth, outside any dynamic import, whose state no later
+// token rewrites. Positions are offsets into the source, NO_OFFSET when unset.
+// The horizon is the furthest offset read by the lexing before pos. The open
+// tokens, including the slot above the depth, which may still be read as the
+// opener of a closing lastToken, are stored in the log from index stack.
+struct SyncPoint {
+  uint32_t pos;
+  uint32_t horizon;
+  uint32_t lastTokenPos;
+  uint32_t importCount;
+  uint32_t exportCount;
+  uint32_t openTokenDepth;
+  uint32_t stack;
+  bool facade;
+  bool lastSlashWasDivision;
+  bool nextBraceIsClass;
+};
+typedef struct SyncPoint SyncPoint;
+
+struct SyncToken {
+  uint32_t pos;
+  uint32_t token;
+};
+typedef struct SyncToken SyncToken;
+
+// Sync points recorded during a parse_incremental run. When resuming after an
+// edit, target holds the previous run's points from the end of the edit on,
+// with their open tokens in targetTokens, and lexing stops at the first one
+// that the new state converges with.
+struct SyncLog {
+  SyncPoint* points;
+  uint32_t len;
+  uint32_t capacity;
+  SyncToken* tokens;
+  uint32_t tokensLen;
+  uint32_t tokensCapacity;
+  uint32_t next;
+  const SyncPoint* target;
+  uint32_t targetLen;
+  uint32_t targetIndex;
+  const SyncToken* targetTokens;
+  uint32_t editStart;
+  uint32_t oldEnd;
+  uint32_t newEnd;
+  bool converged;
+};
+typedef struct SyncLog SyncLog;
+
 struct State {
   Allocator alloc;
   void *user_data;
@@ -75,20 +186,51 @@ struct State {
   Export* export_write_head;
   bool facade;
   bool lastSlashWasDivision;
-  uint16_t openTokenDepth;
+  uint32_t openTokenDepth;
   char16_t* lastTokenPos;
   char16_t *source;
   char16_t* pos;
   char16_t* end;
   OpenToken* openTokenStack;
-  uint16_t dynamicImportStackDepth;
+  uint32_t openTokenCapacity;
+  uint32_t dynamicImportStackDepth;
+  uint32_t dynamicImportStackCapacity;
   Import** dynamicImportStack;
   bool nextBraceIsClass;
   bool has_error;
+  // set when a scan stopped at end, which for a stream may not be the final end
+  bool reachedEnd;
+  uint32_t importCount;
+  uint32_t exportCount;
+  // furthest position read before a statement parser backtracked
+  char16_t* readHorizon;
+  SyncLog* sync;
+  uint32_t flags;
+  uint32_t importLimit;
+  uint32_t staticImportCount;
+  // receives the static imports that NoImports drops
+  Import scratchImport;
 };
 
 typedef struct State State;
 
+// Streaming parse state. The source is accumulated in a buffer allocated
+// through the allocator (results point into it), with STREAM_PAD bytes of
+// zeroed padding on both sides.
+struct Stream {
+  State state;
+  State checkpoint;
+  char16_t* buffer;
+  uint32_t len;
+  uint32_t capacity;
+  // len that the next feed has to reach before lexing again
+  uint32_t resume;
+  OpenToken openTokenStack_[64];
+  Import* dynamicImportStack_[32];
+};
+
+typedef struct Stream Stream;
+
 // Memory Structure:
 // -> source
 // -> analysis starts after source
@@ -97,6 +239,17 @@ typedef struct State State;
 // uint32_t sourceLen = 0;
 
 void bail (State *state, uint32_t err);
+bool hasEscape (const char16_t* start, const char16_t* end, bool template);
+
+static inline bool quotedHasEscape (const char16_t* start, const char16_t* end) {
+  return end - start >= 2 && (*start == '\'' || *start == '"') && hasEscape(start + 1, end - 1, false);
+}
+
+static inline void* lexAlloc (State *state, uint32_t bytes) {
+  STAT(state->result->stats.allocations++);
+  STAT(state->result->stats.allocated_bytes += bytes);
+  return state->alloc(bytes, state->user_data);
+}
 
 // allocateSource
 // void sa (uint32_t utf16Len) {
@@ -116,17 +269,30 @@ void bail (State *state, uint32_t err);
   // return source;
 // }
 
-void addImport (State *state, const char16_t* statement_start, const char16_t* start, const char16_t* end, const char16_t* dynamic) {
+Import* addImport (State *state, const char16_t* statement_start, const char16_t* start, const char16_t* end, const char16_t* dynamic) {
   // Import* import = (Import*)(analysis_head);
   // analysis_head = analysis_head + sizeof(Import);
   // Import *import = state->allocImport();
-  Import *import = state->alloc(sizeof(Import), state->user_data);
-  if (state->import_write_head == NULL)
-    state->result->first_import = import;
-  else
-    state->import_write_head->next = import;
-  state->import_write_head_last = state->import_write_head;
-  state->import_write_head = import;
+  Import *import;
+  if (state->flags & NoImports) {
+    // dynamic imports are still needed to match their closing parens
+    if (dynamic == STANDARD_IMPORT || dynamic == IMPORT_META)
+      import = &state->scratchImport;
+    else
+      import = lexAlloc(state, sizeof(Import));
+  }
+  else {
+    import = lexAlloc(state, sizeof(Import));
+    if (state->import_write_head == NULL)
+      state->result->first_import = import;
+    else
+      state->import_write_head->next = import;
+    state->import_write_head_last = state->import_write_head;
+    state->import_write_head = import;
+    state->importCount++;
+  }
+  if (dynamic == STANDARD_IMPORT)
+    state->staticImportCount++;
   import->statement_start = statement_start;
   if (dynamic == IMPORT_META)
     import->statement_end = end;
@@ -139,23 +305,30 @@ void addImport (State *state, const char16_t* statement_start, const char16_t* s
   import->assert_index = 0;
   import->dynamic = dynamic;
   import->safe = dynamic == STANDARD_IMPORT;
+  import->escaped = false;
   import->next = NULL;
+  return import;
 }
 
 void addExport (State *state, const char16_t* start, const char16_t* end, const char16_t* local_start, const char16_t* local_end) {
   // Export* export = (Export*)(analysis_head);
   // analysis_head = analysis_head + sizeof(Export);
   // Export *export = state->allocExport();
-  Export *export = state->alloc(sizeof(Export), state->user_data);
+  if (state->flags & NoExports)
+    return;
+  Export *export = lexAlloc(state, sizeof(Export));
   if (state->export_write_head == NULL)
     state->result->first_export = export;
   else
     state->export_write_head->next = export;
   state->export_write_head = export;
+  state->exportCount++;
   export->start = start;
   export->end = end;
   export->local_start = local_start;
   export->local_end = local_end;
+  export->escaped = quotedHasEscape(start, end);
+  export->local_escaped = local_start != NULL && quotedHasEscape(local_start, local_end);
   export->next = NULL;
 }
 
@@ -239,6 +412,18 @@ void addExport (State *state, const char16_t* start, const char16_t* end, const
 // }
 
 bool parse ();
+bool lexSource (State *state, State *checkpoint);
+bool parse_options (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_data, ParseResult *result, const LexOptions *options);
+bool parse_incremental (char16_t *source, uint32_t sourceLen, Allocator alloc, void *user_data, ParseResult *result, SyncLog *sync, const SyncPoint *from);
+
+Stream* parse_begin (Allocator alloc, void *user_data, ParseResult *result);
+bool parse_feed (Stream *stream, const char16_t *chunk, uint32_t len);
+bool parse_end (Stream *stream);
+const char16_t* parse_stream_source (Stream *stream, uint32_t *len);
+
+uint32_t unescape_string (const char16_t* start, const char16_t* end, bool template, char16_t* out);
+
+bool growStacks (State *state);
 
 void tryParseImportStatement (State *state);
 void tryParseExportStatement (State *state);
@@ -265,7 +450,7 @@ bool isBrOrWsOrPunctuator (char16_t c);
 bool isBrOrWsOrPunctuatorNotDot (char16_t c);
 
 bool readPrecedingKeyword1(State *state, char16_t* pos, char16_t c1);
-bool readPrecedingKeywordn(State *state, char16_t* pos, const char16_t* compare, size_t n);
+bool readPrecedingKeywordn(State *state, char16_t* pos, uint64_t word, size_t n);
 
 bool isBreakOrContinue (State *state, char16_t* curPos);
 
@@ -138,129 +138,189 @@ export interface ExportSpecifier {
   readonly le: number;
 }
 
-const isLE = new Uint8Array(new Uint16Array([1]).buffer)[0] === 1;
+export interface ParseOptions {
+  /**
+   * Also return a `LineIndex` of where each line of the source starts,
+   * recorded by the lexer, to map offsets to lines and columns without
+   * scanning the source again.
+   */
+  lines?: boolean;
+}
+
+/**
+ * A line, counted from 1, and a column, counted from 0.
+ */
+export interface Position {
+  line: number;
+  column: number;
+}
+
+/**
+ * Where each line of a source starts: the first at 0, and then one after each
+ * `\n`, as offsets in the same units as those of the imports and exports.
+ *
+ * @example
+ * const source = `import a from 'a';\nimport('b');`;
+ * const [imports, exports, facade, lines] = parse(source, '@', { lines: true });
+ * lines.position(imports[1].s);
+ * // Returns { line: 2, column: 7 }
+ */
+export class LineIndex {
+  readonly starts: Uint32Array;
+
+  constructor (starts: Uint32Array) {
+    this.starts = starts;
+  }
+
+  /**
+   * The line and column of an offset, by binary search over the line starts
+   */
+  position (offset: number): Position {
+    const starts = this.starts;
+    if (!starts.length)
+      return { line: 1, column: offset };
+    // the first line starting after offset
+    let low = 1, high = starts.length;
+    while (low < high) {
+      const mid = low + high >>> 1;
+      if (starts[mid] <= offset)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    return { line: low, column: offset - starts[low - 1] };
+  }
+}
+
+const encoder = new TextEncoder();
+// names in a byte source are decoded from their byte ranges as they are, byte
+// order mark included
+const decoder = new TextDecoder('utf-8', { ignoreBOM: true });
 
 /**
  * Outputs the list of exports and locations of import specifiers,
  * including dynamic import and import meta handling.
  *
+ * The source is lexed as UTF-8, so that a `Uint8Array` of UTF-8, such as a
+ * `Buffer` read from disk, is lexed as it is. Offsets are UTF-16 indices
+ * into the source text either way.
+ *
  * @param source Source code to parser
  * @param name Optional sourcename
- * @returns Tuple contaning imports list and exports list.
+ * @param options Optional `{ lines: true }` for a `LineIndex` of the source
+ * @returns Tuple contaning imports list and exports list, and the line index
+ * when asked for.
  */
-export function parse (source: string, name = '@'): readonly [
+export function parse (source: string | Uint8Array, name = '@', options: ParseOptions = {}): readonly [
   imports: ReadonlyArray<ImportSpecifier>,
   exports: ReadonlyArray<ExportSpecifier>,
-  facade: boolean
+  facade: boolean,
+  lines?: LineIndex
 ] {
   if (!wasm)
     // actually returns a promise if init hasn't resolved (not type safe).
     // casting to avoid a breaking type change.
-    return init.then(() => parse(source)) as unknown as ReturnType<typeof parse>;
-
-  const len = source.length + 1;
+    return init.then(() => parse(source, name, options)) as unknown as ReturnType<typeof parse>;
 
-  // need 2 bytes per code point plus analysis space so we double again
-  const extraMem = (wasm.__heap_base.value || wasm.__heap_base) as number + len * 4 - wasm.memory.buffer.byteLength;
-  if (extraMem > 0)
-    wasm.memory.grow(Math.ceil(extraMem / 65536));
-
-  const addr = wasm.sa(len - 1);
-  (isLE ? copyLE : copyBE)(source, new Uint16Array(wasm.memory.buffer, addr, len));
+  // sa() may grow memory, so views are taken after it
+  let len: number;
+  if (typeof source === 'string') {
+    // at most three bytes per UTF-16 code unit
+    const capacity = source.length * 3;
+    const addr = wasm.sa(capacity);
+    len = encoder.encodeInto(source, new Uint8Array(wasm.memory.buffer, addr, capacity)).written!;
+  }
+  else {
+    len = source.byteLength;
+    const addr = wasm.sa(len);
+    new Uint8Array(wasm.memory.buffer, addr, len).set(source);
+  }
 
-  if (!wasm.parse())
-    throw Object.assign(new Error(`Parse error ${name}:${source.slice(0, wasm.e()).split('\n').length}:${wasm.e() - source.lastIndexOf('\n', wasm.e() - 1)}`), { idx: wasm.e() });
+  if (!wasm.parse(len, !!options.lines, typeof source !== 'string'))
+    throw Object.assign(new Error(`Parse error ${name}:${wasm.el()}:${wasm.ec() + 1}`), { idx: wasm.e() });
 
+  // [facade, importCount, exportCount, ...imports, ...exports, ...byte ranges, ...decoded strings, ...line starts, lineCount], see src/binding.h
+  const out = new Int32Array(wasm.memory.buffer);
   const imports: ImportSpecifier[] = [], exports: ExportSpecifier[] = [];
-  while (wasm.ri()) {
-    const s = wasm.is(), e = wasm.ie(), a = wasm.ai(), d = wasm.id(), ss = wasm.ss(), se = wasm.se();
-    let n;
-    if (wasm.ip())
-      n = decode(source.slice(d === -1 ? s - 1 : s, d === -1 ? e + 1 : e));
+  let i = wasm.rd() >> 2;
+  const facade = !!out[i], importCount = out[i + 1], exportCount = out[i + 2];
+  i += 3;
+  const bytes = typeof source !== 'string';
+  // names in a byte source are sliced at their byte ranges rather than offsets
+  let range = i + importCount * 7 + exportCount * 5;
+  let strings = bytes ? range + importCount * 2 + exportCount * 4 : range;
+  const slice = typeof source === 'string'
+    ? (s: number, e: number) => source.slice(s, e)
+    : (s: number, e: number) => decoder.decode(source.subarray(s, e));
+  for (const end = i + importCount * 7; i < end; i += 7) {
+    const s = out[i], e = out[i + 1], ss = out[i + 2], se = out[i + 3], d = out[i + 4], a = out[i + 5];
+    const bs = bytes ? out[range++] : s, be = bytes ? out[range++] : e;
+    const n = value(out[i + 6], d === -1 ? bs - 1 : bs, d === -1 ? be + 1 : be);
     imports.push({ n, s, e, ss, se, d, a });
   }
-  while (wasm.re()) {
-    const s = wasm.es(), e = wasm.ee(), ls = wasm.els(), le = wasm.ele();
-    const n = source.slice(s, e), ch = n[0];
-    const ln = ls < 0 ? undefined : source.slice(ls, le), lch = ln ? ln[0] : '';
+  for (const end = i + exportCount * 5; i < end; i += 5) {
+    const s = out[i], e = out[i + 1], ls = out[i + 2], le = out[i + 3], n = out[i + 4];
+    const bs = bytes ? out[range++] : s, be = bytes ? out[range++] : e;
+    const bls = bytes ? out[range++] : ls, ble = bytes ? out[range++] : le;
     exports.push({
       s, e, ls, le,
-      n: (ch === '"' || ch === "'") ? decode(n) : n,
-      ln: (lch === '"' || lch === "'") ? decode(ln) : ln,
+      n: (n & 3) === 0 ? slice(bs, be) : value(n & 3, bs, be) as string,
+      ln: ls < 0 ? undefined : (n >> 2) === 0 ? slice(bls, ble) : value(n >> 2, bls, ble),
     });
   }
 
-  function decode (str: string | undefined) {
-    try {
-      return (0, eval)(str as string) // eval(undefined) -> undefined
+  // the value of the quoted string at [s, e), in bytes for a byte source
+  function value (n: number, s: number, e: number) {
+    if (n === 1)
+      return slice(s + 1, e - 1);
+    if (n === 2) {
+      const len = out[strings];
+      const units = new Uint16Array(out.buffer, (strings + 1) * 4, len);
+      strings += 1 + (len + 1 >> 1);
+      return String.fromCharCode.apply(null, units as unknown as number[]);
     }
-    catch (e) {}
   }
 
-  return [imports, exports, !!wasm.f()];
-}
-
-function copyBE (src: string, outBuf16: Uint16Array) {
-  const len = src.length;
-  let i = 0;
-  while (i < len) {
-    const ch = src.charCodeAt(i);
-    outBuf16[i++] = (ch & 0xff) << 8 | ch >>> 8;
-  }
-}
-
-function copyLE (src: string, outBuf16: Uint16Array) {
-  const len = src.length;
-  let i = 0;
-  while (i < len)
-    outBuf16[i] = src.charCodeAt(i++);
+  if (!options.lines)
+    return [imports, exports, facade];
+  const end = (wasm.rd() >> 2) + wasm.rl() - 1;
+  return [imports, exports, facade, new LineIndex(new Uint32Array(out.subarray(end - out[end], end)))];
 }
 
 let wasm: {
-  __heap_base: {value: number} | number & {value: undefined};
   memory: WebAssembly.Memory;
-  parse(): boolean;
-  /** getAssertIndex */
-  ai(): number;
+  parse(len: number, lines: boolean, bytes: boolean): boolean;
   /** getErr */
   e(): number;
-  /** getExportEnd */
-  ee(): number;
-  /** getExportLocalEnd */
-  ele(): number;
-  /** getExportLocalStart */
-  els(): number;
-  /** getExportStart */
-  es(): number;
-  /** facade */
-  f(): boolean;
-  /** getImportDynamic */
-  id(): number;
-  /** getImportEnd */
-  ie(): number;
-  /** getImportSafeString */
-  ip(): number;
-  /** getImportStart */
-  is(): number;
-  /** readExport */
-  re(): boolean;
-  /** readImport */
-  ri(): boolean;
+  /** getErrLine */
+  el(): number;
+  /** getErrColumn */
+  ec(): number;
+  /** readRecords */
+  rd(): number;
+  /** recordsLength */
+  rl(): number;
   /** allocateSource */
-  sa(utf16Len: number): number;
-  /** getImportStatementEnd */
-  se(): number;
-  /** getImportStatementStart */
-  ss(): number;
+  sa(capacity: number): number;
 };
 
 
+// A module using simd128 instructions, which only validates where they are
+// supported. The SIMD build is then used, with vectorized scanning.
+const simd = WebAssembly.validate(new Uint8Array([0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1, 8, 0, 65, 0, 253, 15, 253, 98, 11]));
+
+/**
+ * The compiled lexer once init has resolved, which `es-module-lexer/pool`
+ * instantiates again in each of its worker threads.
+ */
+export let wasmModule: WebAssembly.Module;
+
 /**
  * Wait for init to resolve before calling `parse`.
  */
 export const init = WebAssembly.compile(
   (binary => typeof Buffer !== 'undefined' ? Buffer.from(binary, 'base64') : Uint8Array.from(atob(binary), x => x.charCodeAt(0)))
-  ('WASM_BINARY')
+  (simd ? 'WASM_SIMD_BINARY' : 'WASM_BINARY')
 )
-.then(WebAssembly.instantiate)
+.then(module => WebAssembly.instantiate(wasmModule = module))
 .then(({ exports }) => { wasm = exports as typeof wasm; });
@@ -1,10 +1,50 @@
 use bumpalo::Bump;
 use core::alloc::Layout;
-use std::{borrow::Cow, ffi::c_void, marker::PhantomData, mem::MaybeUninit, ptr, sync::atomic::AtomicPtr};
+use std::{
+  borrow::Cow,
+  ffi::c_void,
+  marker::PhantomData,
+  mem::MaybeUninit,
+  num::NonZeroUsize,
+  ops::Range,
+  ptr,
+  sync::atomic::{AtomicPtr, AtomicUsize, Ordering},
+  thread,
+};
+
+mod interner;
+pub use interner::{hash_specifier, Interner, Symbol};
+
+#[cfg(feature = "cache")]
+mod cache;
+#[cfg(feature = "cache")]
+pub use cache::{LexCache, DEFAULT_MAX_BYTES};
 
 type Allocate = unsafe extern "C" fn(bytes: u32, user_data: *mut c_void) -> *mut c_void;
 extern "C" {
   fn parse(ptr: *const u8, len: u32, alloc: Allocate, user_data: *mut c_void, result: *mut ParseResult) -> bool;
+  fn parse_options(
+    ptr: *const u8,
+    len: u32,
+    alloc: Allocate,
+    user_data: *mut c_void,
+    result: *mut ParseResult,
+    options: *const RawLexOptions,
+  ) -> bool;
+  fn parse_begin(alloc: Allocate, user_data: *mut c_void, result: *mut ParseResult) -> *mut c_void;
+  fn parse_feed(stream: *mut c_void, chunk: *const u8, len: u32) -> bool;
+  fn parse_end(stream: *mut c_void) -> bool;
+  fn parse_stream_source(stream: *mut c_void, len: *mut u32) -> *const u8;
+  fn unescape_string(start: *const u8, end: *const u8, template: bool, out: *mut u8) -> u32;
+  fn parse_incremental(
+    ptr: *const u8,
+    len: u32,
+    alloc: Allocate,
+    user_data: *mut c_void,
+    result: *mut ParseResult,
+    sync: *mut SyncLog,
+    from: *const SyncPoint,
+  ) -> bool;
 }
 
 #[repr(C)]
@@ -16,6 +56,9 @@ pub struct Import<'a> {
   pub assert_index: *const u8,
   pub dynamic: *const u8,
   pub safe: bool,
+  /// Whether the string specifier has escapes, which
+  /// [`specifier`](Import::specifier) decodes.
+  pub escaped: bool,
   next: *const Import<'a>,
   phantom: PhantomData<&'a ()>,
 }
@@ -32,7 +75,8 @@ pub enum ImportKind {
 
 impl<'a> Import<'a> {
   pub fn specifier(&self) -> Cow<'a, str> {
-    let (start, end) = if self.kind() == ImportKind::DynamicString {
+    let dynamic = self.kind() == ImportKind::DynamicString;
+    let (start, end) = if dynamic {
       unsafe { (self.start.offset(1), self.end.offset(-1)) }
     } else {
       (self.start, self.end)
@@ -40,11 +84,7 @@ impl<'a> Import<'a> {
 
     let s =
       unsafe { std::str::from_utf8_unchecked(std::slice::from_raw_parts(start, end as usize - start as usize)) };
-    if matches!(self.kind(), ImportKind::Standard | ImportKind::DynamicString) {
-      unescape(s).unwrap_or(Cow::Borrowed(s))
-    } else {
-      Cow::Borrowed(s)
-    }
+    specifier_value(s, self.escaped, dynamic && unsafe { *self.start } == b'`')
   }
 
   pub fn statement(&self) -> &'a str {
@@ -69,125 +109,26 @@ impl<'a> Import<'a> {
   }
 }
 
-fn unescape<'a>(s: &'a str) -> Result<Cow<'a, str>, ()> {
-  let mut cow = Cow::Borrowed(s);
-  let bytes = s.as_bytes();
-  let mut i = 0;
-  let mut si = 0;
-  while i < bytes.len() {
-    let start = i;
-    let b = bytes[i];
-    if b == b'\\' && i + 1 < bytes.len() {
-      i += 1;
-      let c = match bytes[i] {
-        b'n' => '\n',
-        b'r' => '\r',
-        b't' => '\t',
-        b'b' => 8 as char,
-        b'v' => 11 as char,
-        b'f' => 12 as char,
-        b'\r' | b'\n' => {
-          // Unicode new line characters after \ get removed from output in both
-          // template literals and strings
-          cow.to_mut().replace_range(si..si + 2, "");
-          i += 1;
-          continue;
-        }
-        b'x' => {
-          i += 1;
-          read_hex(bytes, &mut i, 2)?
-        }
-        b'u' if i + 1 < bytes.len() => {
-          i += 1;
-          if bytes[i] == b'{' {
-            i += 1;
-            if let Some(end) = bytes[i..].iter().position(|c| *c == b'}') {
-              let res = read_hex(bytes, &mut i, end)?;
-              i += 1;
-              res
-            } else {
-              return Err(());
-            }
-          } else {
-            read_hex(bytes, &mut i, 4)?
-          }
-        }
-        c if c >= b'0' && c <= b'7' => {
-          let mut total = c - b'0';
-          i += 1;
-          for _ in 0..2 {
-            if i < bytes.len() && bytes[i] >= b'0' && bytes[i] <= b'7' {
-              if let Some(t) = total.checked_mul(8).and_then(|t| t.checked_add(bytes[i] - b'0')) {
-                total = t;
-                i += 1;
-              } else {
-                break;
-              }
-            } else {
-              break;
-            }
-          }
-          if i < bytes.len() && (bytes[i] == b'8' || bytes[i] == b'9') {
-            return Err(());
-          }
-          total as char
-        }
-        c => c as char,
-      };
-
-      let mut buf = [0; 4];
-      let r = c.encode_utf8(&mut buf);
-      cow.to_mut().replace_range(si..si + i - start, r);
-      si += r.len();
-    } else {
-      si += 1;
-      i += 1;
-    }
+// The value of a string specifier from the contents between its quotes
+fn specifier_value(s: &str, escaped: bool, template: bool) -> Cow<'_, str> {
+  if escaped {
+    unescape(s, template).map(Cow::Owned).unwrap_or(Cow::Borrowed(s))
+  } else {
+    Cow::Borrowed(s)
   }
-
-  Ok(cow)
 }
 
-fn read_hex(bytes: &[u8], pos: &mut usize, len: usize) -> Result<char, ()> {
-  let start = *pos;
-  let mut total: u32 = 0;
-  let mut last_code = 0;
-  for _ in 0..len {
-    let code = bytes[*pos];
-
-    if code == b'_' {
-      if last_code == b'_' {
-        return Err(());
-      }
-      last_code = code;
-      *pos += 1;
-      continue;
-    }
-
-    let val = if code >= b'a' {
-      code - b'a' + 10
-    } else if code >= b'A' {
-      code - b'A' + 10
-    } else if code >= b'0' && code <= b'9' {
-      code - b'0'
-    } else {
-      break;
-    };
-
-    if val >= 16 {
-      break;
-    }
-
-    last_code = code;
-    total = total * 16 + (val as u32);
-    *pos += 1;
-  }
-
-  if last_code == b'_' || *pos - start != len {
+// Decodes with the lexer's unescape_string. Escaped lone surrogates, which
+// have no UTF-8 encoding, fail like invalid escapes.
+fn unescape(s: &str, template: bool) -> Result<String, ()> {
+  let mut out = Vec::with_capacity(s.len());
+  let range = s.as_bytes().as_ptr_range();
+  let len = unsafe { unescape_string(range.start, range.end, template, out.as_mut_ptr()) };
+  if len == u32::MAX {
     return Err(());
   }
-
-  Ok(unsafe { char::from_u32_unchecked(total) })
+  unsafe { out.set_len(len as usize) };
+  String::from_utf8(out).map_err(|_| ())
 }
 
 impl<'a> NextPtr for Import<'a> {
@@ -202,6 +143,11 @@ pub struct Export {
   end: *const u8,
   local_start: *const u8,
   local_end: *const u8,
+  // mirror the C record; quoted names are returned undecoded
+  #[allow(dead_code)]
+  escaped: bool,
+  #[allow(dead_code)]
+  local_escaped: bool,
   next: *const Export,
 }
 
@@ -240,10 +186,64 @@ struct ParseResult<'a> {
   first_import: *const Import<'a>,
   first_export: *const Export,
   parse_error: u32,
+  facade: bool,
+  line_starts: *const u32,
+  line_count: u32,
+  #[cfg(feature = "stats")]
+  stats: LexStats,
+}
+
+impl<'a> ParseResult<'a> {
+  fn lines(&self) -> Option<LineIndex<'a>> {
+    if self.line_starts.is_null() {
+      return None;
+    }
+    Some(LineIndex {
+      starts: unsafe { std::slice::from_raw_parts(self.line_starts, self.line_count as usize) },
+    })
+  }
+}
+
+/// The calls of one of the lexer's scanning routines and the bytes it
+/// advanced over.
+#[cfg(feature = "stats")]
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct ScanStats {
+  pub calls: u64,
+  pub bytes: u64,
+}
+
+/// Counters of the lexer's hot paths over one lex, with the `stats` feature.
+///
+/// Sources that lex slowly show up as many bytes scanned by one routine,
+/// many expression keyword checks for the `/` handling, or deep nesting.
+/// Work redone after a streaming rollback is counted again.
+#[cfg(feature = "stats")]
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct LexStats {
+  pub line_comment: ScanStats,
+  pub block_comment: ScanStats,
+  pub string_literal: ScanStats,
+  pub template_string: ScanStats,
+  pub regular_expression: ScanStats,
+  pub expression_keyword_checks: u64,
+  /// How each `/` that does not start a comment was read.
+  pub regex_decisions: u64,
+  pub division_decisions: u64,
+  /// Dynamic imports dropped on a following `{`, as in `import () {}`.
+  pub dynamic_import_removals: u64,
+  /// Allocations made through the allocator, and their total size.
+  pub allocations: u64,
+  pub allocated_bytes: u64,
+  pub max_open_token_depth: u32,
+  pub max_dynamic_import_depth: u32,
 }
 
 pub struct LexResult<'a> {
-  bump: Bump,
+  // owns the records that first_import and first_export point into
+  _bump: Bump,
   first_import: *const Import<'a>,
   first_export: *const Export,
 }
@@ -297,33 +297,1162 @@ unsafe extern "C" fn alloc(bytes: u32, user_data: *mut c_void) -> *mut c_void {
   bump.alloc_layout(layout).as_ptr() as *mut c_void
 }
 
-pub fn lex<'a>(code: &'a str) -> Result<LexResult<'a>, usize> {
-  let code_ptr = code.as_ptr();
-  let mut res = LexResult {
-    bump: Bump::new(),
-    first_import: ptr::null(),
-    first_export: ptr::null(),
-  };
+fn lex_in<'a>(code: &'a [u8], bump: &mut Bump) -> Result<(*const Import<'a>, *const Export), usize> {
+  let result = parse_in(code, bump, None)?;
+  Ok((result.first_import, result.first_export))
+}
+
+fn parse_in<'a>(code: &'a [u8], bump: &mut Bump, options: Option<&RawLexOptions>) -> Result<ParseResult<'a>, usize> {
   let mut result: ParseResult = unsafe { MaybeUninit::zeroed().assume_init() };
   let success = unsafe {
-    parse(
-      code_ptr,
-      code.len() as u32,
-      alloc,
-      &mut res.bump as *mut Bump as *mut c_void,
-      &mut result as *mut ParseResult,
-    )
+    match options {
+      Some(options) => parse_options(
+        code.as_ptr(),
+        code.len() as u32,
+        alloc,
+        bump as *mut Bump as *mut c_void,
+        &mut result as *mut ParseResult,
+        options as *const RawLexOptions,
+      ),
+      None => parse(
+        code.as_ptr(),
+        code.len() as u32,
+        alloc,
+        bump as *mut Bump as *mut c_void,
+        &mut result as *mut ParseResult,
+      ),
+    }
   };
 
   if success {
-    res.first_import = result.first_import;
-    res.first_export = result.first_export;
-    return Ok(res);
+    return Ok(result);
   }
 
   return Err(result.parse_error as usize);
 }
 
+pub fn lex<'a>(code: &'a str) -> Result<LexResult<'a>, usize> {
+  let mut bump = Bump::new();
+  let (first_import, first_export) = lex_in(code.as_bytes(), &mut bump)?;
+  Ok(LexResult {
+    _bump: bump,
+    first_import,
+    first_export,
+  })
+}
+
+/// Lexes a source given as bytes, such as a mapped file, without validating
+/// all of it as UTF-8. The lexer never reads past the end of `code`, so no
+/// padding is needed. Only the spans that records expose as `&str` are
+/// validated; an invalid one is reported as an error at its first byte.
+pub fn lex_bytes<'a>(code: &'a [u8]) -> Result<LexResult<'a>, usize> {
+  let mut bump = Bump::new();
+  let (first_import, first_export) = lex_in(code, &mut bump)?;
+  validate_spans(code, first_import, first_export)?;
+  Ok(LexResult {
+    _bump: bump,
+    first_import,
+    first_export,
+  })
+}
+
+fn validate_spans(code: &[u8], first_import: *const Import, first_export: *const Export) -> Result<(), usize> {
+  let base = code.as_ptr() as usize;
+  let check = |start: *const u8, end: *const u8| {
+    let (start, end) = (start as usize - base, end as usize - base);
+    // truncated input can leave a keyword-length span running past the end
+    let span = code.get(start..end).ok_or(start)?;
+    std::str::from_utf8(span).map(|_| ()).map_err(|err| start + err.valid_up_to())
+  };
+  let imports = ResultIter {
+    ptr: AtomicPtr::new(first_import as *mut Import),
+    lifetime: PhantomData,
+  };
+  for import in imports {
+    check(import.start, import.end)?;
+    if !import.statement_end.is_null() {
+      check(import.statement_start, import.statement_end)?;
+    }
+  }
+  let exports = ResultIter {
+    ptr: AtomicPtr::new(first_export as *mut Export),
+    lifetime: PhantomData,
+  };
+  for export in exports {
+    check(export.start, export.end)?;
+    if !export.local_start.is_null() {
+      check(export.local_start, export.local_end)?;
+    }
+  }
+  Ok(())
+}
+
+#[derive(Debug)]
+pub enum LexFileError {
+  Io(std::io::Error),
+  /// A parse error, or a record span that is not valid UTF-8, at this offset.
+  Parse(usize),
+}
+
+impl From<std::io::Error> for LexFileError {
+  fn from(err: std::io::Error) -> Self {
+    LexFileError::Io(err)
+  }
+}
+
+/// Lexes a file in place from a read-only memory map, with a sequential
+/// access hint, instead of reading it into a string first.
+///
+/// The file must not be modified while the result is alive.
+pub fn lex_file<P: AsRef<std::path::Path>>(path: P) -> Result<FileLexResult, LexFileError> {
+  let source = FileSource::open(path.as_ref())?;
+  let mut bump = Bump::new();
+  let (first_import, first_export) = {
+    let code = source.as_bytes();
+    let (first_import, first_export) = lex_in(code, &mut bump).map_err(LexFileError::Parse)?;
+    validate_spans(code, first_import, first_export).map_err(LexFileError::Parse)?;
+    (first_import as *const Import<'static>, first_export)
+  };
+  Ok(FileLexResult {
+    first_import,
+    first_export,
+    _bump: bump,
+    source,
+  })
+}
+
+/// The result of [`lex_file`], owning the mapped source.
+pub struct FileLexResult {
+  first_import: *const Import<'static>,
+  first_export: *const Export,
+  _bump: Bump,
+  source: FileSource,
+}
+
+impl FileLexResult {
+  pub fn source(&self) -> &[u8] {
+    self.source.as_bytes()
+  }
+
+  pub fn imports(&self) -> ResultIter<'_, Import<'_>> {
+    ResultIter {
+      ptr: AtomicPtr::new(self.first_import as *mut Import),
+      lifetime: PhantomData,
+    }
+  }
+
+  pub fn exports(&self) -> ResultIter<'_, Export> {
+    ResultIter {
+      ptr: AtomicPtr::new(self.first_export as *mut Export),
+      lifetime: PhantomData,
+    }
+  }
+}
+
+#[cfg(unix)]
+struct FileSource {
+  ptr: *mut c_void,
+  len: usize,
+}
+
+#[cfg(unix)]
+impl FileSource {
+  fn open(path: &std::path::Path) -> std::io::Result<Self> {
+    let source = Self::map(&std::fs::File::open(path)?)?;
+    if source.len != 0 {
+      unsafe { libc::madvise(source.ptr, source.len, libc::MADV_SEQUENTIAL) };
+    }
+    Ok(source)
+  }
+
+  #[cfg(feature = "cache")]
+  fn empty() -> Self {
+    FileSource { ptr: ptr::null_mut(), len: 0 }
+  }
+
+  /// Maps the current length of `file` read-only.
+  fn map(file: &std::fs::File) -> std::io::Result<Self> {
+    use std::os::unix::io::AsRawFd;
+    let len = file.metadata()?.len() as usize;
+    if len == 0 {
+      return Ok(FileSource { ptr: ptr::null_mut(), len });
+    }
+    let ptr = unsafe { libc::mmap(ptr::null_mut(), len, libc::PROT_READ, libc::MAP_PRIVATE, file.as_raw_fd(), 0) };
+    if ptr == libc::MAP_FAILED {
+      return Err(std::io::Error::last_os_error());
+    }
+    Ok(FileSource { ptr, len })
+  }
+
+  fn as_bytes(&self) -> &[u8] {
+    if self.len == 0 {
+      return &[];
+    }
+    unsafe { std::slice::from_raw_parts(self.ptr as *const u8, self.len) }
+  }
+}
+
+#[cfg(unix)]
+impl Drop for FileSource {
+  fn drop(&mut self) {
+    if self.len != 0 {
+      unsafe { libc::munmap(self.ptr, self.len) };
+    }
+  }
+}
+
+#[cfg(not(unix))]
+struct FileSource(Vec<u8>);
+
+#[cfg(not(unix))]
+impl FileSource {
+  fn open(path: &std::path::Path) -> std::io::Result<Self> {
+    std::fs::read(path).map(FileSource)
+  }
+
+  #[cfg(feature = "cache")]
+  fn empty() -> Self {
+    FileSource(Vec::new())
+  }
+
+  fn map(mut file: &std::fs::File) -> std::io::Result<Self> {
+    use std::io::Read;
+    let mut bytes = Vec::new();
+    file.read_to_end(&mut bytes)?;
+    Ok(FileSource(bytes))
+  }
+
+  fn as_bytes(&self) -> &[u8] {
+    &self.0
+  }
+}
+
+/// Lexes a source that arrives in chunks, such as a response body or a pipe.
+///
+/// Each [`LexStream::feed`] lexes as far as the data received so far allows,
+/// so lexing overlaps with I/O. The source is accumulated in the stream's
+/// arena, since the results point into it.
+pub struct LexStream {
+  bump: Box<Bump>,
+  result: Box<ParseResult<'static>>,
+  stream: *mut c_void,
+}
+
+impl LexStream {
+  pub fn new() -> Self {
+    let mut bump = Box::new(Bump::new());
+    let mut result: Box<ParseResult> = Box::new(unsafe { MaybeUninit::zeroed().assume_init() });
+    let stream = unsafe {
+      parse_begin(
+        alloc,
+        &mut *bump as *mut Bump as *mut c_void,
+        &mut *result as *mut ParseResult,
+      )
+    };
+    assert!(!stream.is_null());
+    LexStream { bump, result, stream }
+  }
+
+  /// Appends a chunk of UTF-8 source. Chunks may split characters. On error
+  /// returns the parse error offset, and the stream should be dropped.
+  pub fn feed(&mut self, chunk: &[u8]) -> Result<(), usize> {
+    for chunk in chunk.chunks(u32::MAX as usize) {
+      if !unsafe { parse_feed(self.stream, chunk.as_ptr(), chunk.len() as u32) } {
+        return Err(self.result.parse_error as usize);
+      }
+    }
+    Ok(())
+  }
+
+  /// Completes lexing once all chunks have been fed. A source that is not
+  /// valid UTF-8 is reported as an error at the first invalid byte.
+  pub fn finish(self) -> Result<StreamResult, usize> {
+    if !unsafe { parse_end(self.stream) } {
+      return Err(self.result.parse_error as usize);
+    }
+    let mut len = 0;
+    let source = unsafe { parse_stream_source(self.stream, &mut len) };
+    if let Err(err) = std::str::from_utf8(unsafe { std::slice::from_raw_parts(source, len as usize) }) {
+      return Err(err.valid_up_to());
+    }
+    Ok(StreamResult {
+      source,
+      len: len as usize,
+      first_import: self.result.first_import,
+      first_export: self.result.first_export,
+      _bump: self.bump,
+    })
+  }
+}
+
+impl Default for LexStream {
+  fn default() -> Self {
+    Self::new()
+  }
+}
+
+/// The result of a [`LexStream`], owning the accumulated source.
+pub struct StreamResult {
+  source: *const u8,
+  len: usize,
+  first_import: *const Import<'static>,
+  first_export: *const Export,
+  _bump: Box<Bump>,
+}
+
+impl StreamResult {
+  pub fn source(&self) -> &str {
+    unsafe { std::str::from_utf8_unchecked(std::slice::from_raw_parts(self.source, self.len)) }
+  }
+
+  pub fn imports(&self) -> ResultIter<'_, Import<'_>> {
+    ResultIter {
+      ptr: AtomicPtr::new(self.first_import as *mut Import),
+      lifetime: PhantomData,
+    }
+  }
+
+  pub fn exports(&self) -> ResultIter<'_, Export> {
+    ResultIter {
+      ptr: AtomicPtr::new(self.first_export as *mut Export),
+      lifetime: PhantomData,
+    }
+  }
+}
+
+/// The records of one source lexed by a [`Lexer`] or [`LexBatch`], borrowed
+/// from its arena.
+pub struct Module<'a> {
+  first_import: *const Import<'a>,
+  first_export: *const Export,
+  facade: bool,
+  lines: Option<LineIndex<'a>>,
+  #[cfg(feature = "stats")]
+  stats: LexStats,
+}
+
+unsafe impl<'a> Send for Module<'a> {}
+unsafe impl<'a> Sync for Module<'a> {}
+
+impl<'a> Module<'a> {
+  pub fn imports(&self) -> ResultIter<'a, Import<'a>> {
+    ResultIter {
+      ptr: AtomicPtr::new(self.first_import as *mut Import),
+      lifetime: PhantomData,
+    }
+  }
+
+  pub fn exports(&self) -> ResultIter<'a, Export> {
+    ResultIter {
+      ptr: AtomicPtr::new(self.first_export as *mut Export),
+      lifetime: PhantomData,
+    }
+  }
+
+  /// Whether the source holds nothing but import and export statements, up
+  /// to where lexing stopped.
+  pub fn facade(&self) -> bool {
+    self.facade
+  }
+
+  /// Where each line of the source starts, when lexed with
+  /// [`LexOptions::lines`].
+  pub fn lines(&self) -> Option<LineIndex<'a>> {
+    self.lines
+  }
+
+  /// The lexer's hot path counters for this source.
+  #[cfg(feature = "stats")]
+  pub fn stats(&self) -> &LexStats {
+    &self.stats
+  }
+}
+
+/// A line and column in a source, from [`LineIndex::position`]. Lines count
+/// from 1, and columns from 0 in bytes, like the offsets they map.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct Position {
+  pub line: u32,
+  pub column: u32,
+}
+
+/// The byte offsets at which the lines of a source start, the first at 0 and
+/// then one after each `\n`, collected by a vectorized scan before lexing.
+#[derive(Debug, Clone, Copy)]
+pub struct LineIndex<'a> {
+  starts: &'a [u32],
+}
+
+impl<'a> LineIndex<'a> {
+  pub fn starts(&self) -> &'a [u32] {
+    self.starts
+  }
+
+  /// The line and column of a byte offset, by binary search over the line
+  /// starts. Offsets past the end fall on the last line, and any offset on
+  /// the first when there are no starts.
+  pub fn position(&self, offset: u32) -> Position {
+    let line = self.starts.partition_point(|&start| start <= offset);
+    if line == 0 {
+      return Position { line: 1, column: offset };
+    }
+    Position {
+      line: line as u32,
+      column: offset - self.starts[line - 1],
+    }
+  }
+}
+
+/// What [`Lexer::lex_with`] records, and when it stops.
+///
+/// Lexing decisions do not depend on the options, so every record returned
+/// is the one a full lex returns; records that are not asked for are never
+/// built, and a pass stops as soon as its goal is met.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct LexOptions {
+  pub imports: bool,
+  pub exports: bool,
+  /// Stops as soon as the source is known not to be a facade.
+  pub facade_only: bool,
+  /// Stops after this many static imports, counting `export ... from`, or
+  /// never when 0.
+  pub max_imports: u32,
+  /// Records where each line starts, for [`Module::lines`].
+  pub lines: bool,
+}
+
+impl LexOptions {
+  pub fn imports_only() -> Self {
+    LexOptions {
+      exports: false,
+      ..Default::default()
+    }
+  }
+
+  pub fn exports_only() -> Self {
+    LexOptions {
+      imports: false,
+      ..Default::default()
+    }
+  }
+
+  /// Checks for a facade, recording its exports.
+  pub fn facade_only() -> Self {
+    LexOptions {
+      imports: false,
+      facade_only: true,
+      ..Default::default()
+    }
+  }
+
+  /// Records imports up to the first `n` static ones.
+  pub fn first_imports(n: u32) -> Self {
+    LexOptions {
+      exports: false,
+      max_imports: n,
+      ..Default::default()
+    }
+  }
+
+  fn raw(&self) -> RawLexOptions {
+    let mut flags = 0;
+    if !self.imports {
+      flags |= NO_IMPORTS;
+    }
+    if !self.exports {
+      flags |= NO_EXPORTS;
+    }
+    if self.facade_only {
+      flags |= FACADE_ONLY;
+    }
+    if self.lines {
+      flags |= LINE_STARTS;
+    }
+    RawLexOptions {
+      flags,
+      max_imports: self.max_imports,
+    }
+  }
+}
+
+impl Default for LexOptions {
+  fn default() -> Self {
+    LexOptions {
+      imports: true,
+      exports: true,
+      facade_only: false,
+      max_imports: 0,
+      lines: false,
+    }
+  }
+}
+
+const NO_IMPORTS: u32 = 1;
+const NO_EXPORTS: u32 = 2;
+const FACADE_ONLY: u32 = 4;
+const LINE_STARTS: u32 = 8;
+
+#[repr(C)]
+struct RawLexOptions {
+  flags: u32,
+  max_imports: u32,
+}
+
+/// Marks an absent offset in [`ImportColumns`] and [`ExportColumns`].
+pub const NONE: u32 = u32::MAX;
+
+/// Imports as parallel columns of `u32` byte offsets into the source, one
+/// entry per import in source order.
+///
+/// Absent values (`assert_index` without an assertion, `dynamic_start` for
+/// static and meta imports, `statement_end` of an unterminated dynamic
+/// import) are [`NONE`]. `kind` and `escaped` hold [`Import::kind`] and
+/// [`Import::escaped`].
+#[derive(Debug, Default, Clone, PartialEq, Eq)]
+pub struct ImportColumns {
+  pub start: Vec<u32>,
+  pub end: Vec<u32>,
+  pub statement_start: Vec<u32>,
+  pub statement_end: Vec<u32>,
+  pub assert_index: Vec<u32>,
+  pub dynamic_start: Vec<u32>,
+  pub kind: Vec<ImportKind>,
+  pub escaped: Vec<bool>,
+}
+
+/// Exports as parallel columns of `u32` byte offsets into the source.
+/// `local_start` and `local_end` are [`NONE`] when there is no local name.
+#[derive(Debug, Default, Clone, PartialEq, Eq)]
+pub struct ExportColumns {
+  pub start: Vec<u32>,
+  pub end: Vec<u32>,
+  pub local_start: Vec<u32>,
+  pub local_end: Vec<u32>,
+}
+
+impl ImportColumns {
+  pub fn len(&self) -> usize {
+    self.start.len()
+  }
+
+  pub fn is_empty(&self) -> bool {
+    self.start.is_empty()
+  }
+
+  fn extend_mapped(&mut self, other: &Self, rows: Range<usize>, map: impl Fn(u32) -> u32) {
+    for i in rows {
+      self.start.push(map(other.start[i]));
+      self.end.push(map(other.end[i]));
+      self.statement_start.push(map(other.statement_start[i]));
+      self.statement_end.push(map(other.statement_end[i]));
+      self.assert_index.push(map(other.assert_index[i]));
+      self.dynamic_start.push(map(other.dynamic_start[i]));
+      self.kind.push(other.kind[i]);
+      self.escaped.push(other.escaped[i]);
+    }
+  }
+
+  fn clear(&mut self) {
+    self.start.clear();
+    self.end.clear();
+    self.statement_start.clear();
+    self.statement_end.clear();
+    self.assert_index.clear();
+    self.dynamic_start.clear();
+    self.kind.clear();
+    self.escaped.clear();
+  }
+}
+
+impl ExportColumns {
+  pub fn len(&self) -> usize {
+    self.start.len()
+  }
+
+  pub fn is_empty(&self) -> bool {
+    self.start.is_empty()
+  }
+
+  fn extend_mapped(&mut self, other: &Self, rows: Range<usize>, map: impl Fn(u32) -> u32) {
+    for i in rows {
+      self.start.push(map(other.start[i]));
+      self.end.push(map(other.end[i]));
+      self.local_start.push(map(other.local_start[i]));
+      self.local_end.push(map(other.local_end[i]));
+    }
+  }
+
+  fn clear(&mut self) {
+    self.start.clear();
+    self.end.clear();
+    self.local_start.clear();
+    self.local_end.clear();
+  }
+}
+
+/// The result of [`Lexer::lex_columns`]: columnar records that borrow only
+/// the source, not the lexer's arena.
+#[derive(Debug, Default, Clone, PartialEq, Eq)]
+pub struct ModuleColumns<'a> {
+  source: &'a str,
+  pub imports: ImportColumns,
+  pub exports: ExportColumns,
+}
+
+impl<'a> ModuleColumns<'a> {
+  pub fn source(&self) -> &'a str {
+    self.source
+  }
+
+  /// The specifier of import `i`, unescaped like [`Import::specifier`].
+  pub fn specifier(&self, i: usize) -> Cow<'a, str> {
+    let imports = &self.imports;
+    let kind = imports.kind[i];
+    let (start, end) = (imports.start[i] as usize, imports.end[i] as usize);
+    let (start, end) = if kind == ImportKind::DynamicString {
+      (start + 1, end - 1)
+    } else {
+      (start, end)
+    };
+    let template = kind == ImportKind::DynamicString && self.source.as_bytes()[start - 1] == b'`';
+    specifier_value(&self.source[start..end], imports.escaped[i], template)
+  }
+
+  pub fn statement(&self, i: usize) -> &'a str {
+    &self.source[self.imports.statement_start[i] as usize..self.imports.statement_end[i] as usize]
+  }
+
+  pub fn exported(&self, i: usize) -> &'a str {
+    &self.source[self.exports.start[i] as usize..self.exports.end[i] as usize]
+  }
+
+  pub fn local(&self, i: usize) -> Option<&'a str> {
+    let start = self.exports.local_start[i];
+    if start == NONE {
+      return None;
+    }
+    Some(&self.source[start as usize..self.exports.local_end[i] as usize])
+  }
+
+  fn fill(&mut self, module: &Module<'_>) {
+    let base = self.source.as_ptr() as usize;
+    let offset = |p: *const u8| {
+      if (p as usize) < base {
+        NONE
+      } else {
+        (p as usize - base) as u32
+      }
+    };
+
+    self.imports.clear();
+    for import in module.imports() {
+      let kind = import.kind();
+      let cols = &mut self.imports;
+      cols.start.push(offset(import.start));
+      cols.end.push(offset(import.end));
+      cols.statement_start.push(offset(import.statement_start));
+      cols.statement_end.push(offset(import.statement_end));
+      cols.assert_index.push(offset(import.assert_index));
+      cols.dynamic_start.push(match kind {
+        ImportKind::Standard | ImportKind::Meta => NONE,
+        _ => offset(import.dynamic),
+      });
+      cols.kind.push(kind);
+      cols.escaped.push(import.escaped);
+    }
+
+    self.exports.clear();
+    for export in module.exports() {
+      let cols = &mut self.exports;
+      cols.start.push(offset(export.start));
+      cols.end.push(offset(export.end));
+      cols.local_start.push(offset(export.local_start));
+      cols.local_end.push(offset(export.local_end));
+    }
+  }
+}
+
+/// A change to a source: the bytes at `start..old_end` were replaced by the
+/// bytes now at `start..new_end`.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct Edit {
+  pub start: usize,
+  pub old_end: usize,
+  pub new_end: usize,
+}
+
+impl Edit {
+  /// Maps an offset after the edit into the new source.
+  fn map(&self, offset: u32) -> u32 {
+    if offset == NONE || (offset as usize) < self.start {
+      offset
+    } else {
+      (offset as usize - self.old_end + self.new_end) as u32
+    }
+  }
+}
+
+/// A position that lexing can restart from, mirroring the lexer's SyncPoint.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct SyncPoint {
+  pos: u32,
+  horizon: u32,
+  last_token_pos: u32,
+  import_count: u32,
+  export_count: u32,
+  open_token_depth: u32,
+  stack: u32,
+  facade: bool,
+  last_slash_was_division: bool,
+  next_brace_is_class: bool,
+}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct SyncToken {
+  pos: u32,
+  token: u32,
+}
+
+#[repr(C)]
+struct SyncLog {
+  points: *mut SyncPoint,
+  len: u32,
+  capacity: u32,
+  tokens: *mut SyncToken,
+  tokens_len: u32,
+  tokens_capacity: u32,
+  next: u32,
+  target: *const SyncPoint,
+  target_len: u32,
+  target_index: u32,
+  target_tokens: *const SyncToken,
+  edit_start: u32,
+  old_end: u32,
+  new_end: u32,
+  converged: bool,
+}
+
+impl SyncLog {
+  fn new(targets: &[SyncPoint], target_tokens: &[SyncToken], edit: Edit) -> Self {
+    SyncLog {
+      points: ptr::null_mut(),
+      len: 0,
+      capacity: 0,
+      tokens: ptr::null_mut(),
+      tokens_len: 0,
+      tokens_capacity: 0,
+      next: 0,
+      target: targets.as_ptr(),
+      target_len: targets.len() as u32,
+      target_index: 0,
+      target_tokens: target_tokens.as_ptr(),
+      edit_start: edit.start as u32,
+      old_end: edit.old_end as u32,
+      new_end: edit.new_end as u32,
+      converged: false,
+    }
+  }
+
+  fn points(&self) -> &[SyncPoint] {
+    if self.len == 0 {
+      return &[];
+    }
+    unsafe { std::slice::from_raw_parts(self.points, self.len as usize) }
+  }
+
+  fn tokens(&self) -> &[SyncToken] {
+    if self.tokens_len == 0 {
+      return &[];
+    }
+    unsafe { std::slice::from_raw_parts(self.tokens, self.tokens_len as usize) }
+  }
+}
+
+/// The result of [`Lexer::lex_incremental`]: columns together with the sync
+/// points that let [`Lexer::relex`] update them after an edit.
+#[derive(Debug, Clone)]
+pub struct IncrementalColumns<'a> {
+  pub columns: ModuleColumns<'a>,
+  syncs: Vec<SyncPoint>,
+  sync_tokens: Vec<SyncToken>,
+  relexed: Range<usize>,
+}
+
+impl<'a> IncrementalColumns<'a> {
+  /// The range of the source that was actually lexed to produce this result.
+  pub fn relexed(&self) -> Range<usize> {
+    self.relexed.clone()
+  }
+}
+
+/// Arena capacity kept across resets unless configured otherwise.
+pub const DEFAULT_RETAIN_LIMIT: usize = 4 << 20;
+
+/// Resets an arena for reuse. Bump::reset keeps the largest chunk, so after an
+/// outlier source that chunk is dropped instead when it exceeds the limit.
+fn recycle(bump: &mut Bump, retain_limit: usize) {
+  if bump.allocated_bytes() > retain_limit {
+    *bump = Bump::new();
+  } else {
+    bump.reset();
+  }
+}
+
+/// A long-lived lexing context that reuses one arena across calls.
+///
+/// Results borrow the context, so they must be dropped before the next call
+/// to [`Lexer::lex`] or [`Lexer::reset`], which both recycle the arena.
+pub struct Lexer {
+  bump: Bump,
+  retain_limit: usize,
+  high_water_mark: usize,
+}
+
+impl Lexer {
+  pub fn new() -> Self {
+    Self::with_retain_limit(DEFAULT_RETAIN_LIMIT)
+  }
+
+  /// Creates a context that keeps at most `retain_limit` bytes of arena
+  /// capacity across resets.
+  pub fn with_retain_limit(retain_limit: usize) -> Self {
+    Lexer {
+      bump: Bump::new(),
+      retain_limit,
+      high_water_mark: 0,
+    }
+  }
+
+  pub fn lex<'a>(&'a mut self, code: &'a str) -> Result<Module<'a>, usize> {
+    self.reset();
+    let res = lex_module(code, &mut self.bump);
+    self.high_water_mark = self.high_water_mark.max(self.bump.allocated_bytes());
+    res
+  }
+
+  /// Like [`Lexer::lex`], recording only what `options` asks for.
+  pub fn lex_with<'a>(&'a mut self, code: &'a str, options: LexOptions) -> Result<Module<'a>, usize> {
+    self.reset();
+    let res = parse_in(code.as_bytes(), &mut self.bump, Some(&options.raw())).map(|result| Module {
+      first_import: result.first_import,
+      first_export: result.first_export,
+      facade: result.facade,
+      lines: result.lines(),
+      #[cfg(feature = "stats")]
+      stats: result.stats,
+    });
+    self.high_water_mark = self.high_water_mark.max(self.bump.allocated_bytes());
+    res
+  }
+
+  /// Lexes into columns. The linked records only live in this context's
+  /// arena until they are copied out, so the returned value borrows only
+  /// `code` and the arena is reused by the next call.
+  pub fn lex_columns<'a>(&mut self, code: &'a str) -> Result<ModuleColumns<'a>, usize> {
+    let mut columns = ModuleColumns {
+      source: code,
+      ..Default::default()
+    };
+    self.lex_columns_into(code, &mut columns)?;
+    Ok(columns)
+  }
+
+  /// Like [`Lexer::lex_columns`], reusing the column buffers of `columns`.
+  pub fn lex_columns_into<'a>(&mut self, code: &'a str, columns: &mut ModuleColumns<'a>) -> Result<(), usize> {
+    columns.source = code;
+    let module = self.lex(code)?;
+    columns.fill(&module);
+    Ok(())
+  }
+
+  /// Like [`Lexer::lex_columns`], also recording the sync points that
+  /// [`Lexer::relex`] restarts from.
+  pub fn lex_incremental<'a>(&mut self, code: &'a str) -> Result<IncrementalColumns<'a>, usize> {
+    let mut sync = SyncLog::new(&[], &[], Edit { start: 0, old_end: 0, new_end: 0 });
+    let mut columns = ModuleColumns {
+      source: code,
+      ..Default::default()
+    };
+    self.lex_from(code, None, &mut sync, &mut columns)?;
+    Ok(IncrementalColumns {
+      columns,
+      syncs: sync.points().to_vec(),
+      sync_tokens: sync.tokens().to_vec(),
+      relexed: 0..code.len(),
+    })
+  }
+
+  /// Updates `prev`, the result for a source before `edit`, to `code`, the
+  /// source after it.
+  ///
+  /// Lexing restarts from the last sync point whose lexing read nothing at or
+  /// after the edit, and stops at the first sync point past the edit where
+  /// its state converges with the previous run. The imports and exports
+  /// before and after are reused, shifted by the change in length, so the
+  /// cost follows the size of the edit rather than of the source. An `edit`
+  /// that does not match the two sources' lengths lexes `code` in full.
+  pub fn relex<'a>(
+    &mut self,
+    prev: &IncrementalColumns<'_>,
+    edit: Edit,
+    code: &'a str,
+  ) -> Result<IncrementalColumns<'a>, usize> {
+    let old_len = prev.columns.source.len();
+    if edit.start > edit.old_end
+      || edit.start > edit.new_end
+      || edit.old_end > old_len
+      || edit.new_end > code.len()
+      || old_len - edit.old_end != code.len() - edit.new_end
+    {
+      return self.lex_incremental(code);
+    }
+    let restart = match prev.syncs.iter().rposition(|point| point.horizon as usize <= edit.start) {
+      Some(restart) => restart,
+      None => return self.lex_incremental(code),
+    };
+    let from = prev.syncs[restart];
+    let first_target = prev.syncs.partition_point(|point| (point.pos as usize) < edit.old_end);
+    let targets = &prev.syncs[first_target.max(restart + 1)..];
+
+    let mut sync = SyncLog::new(targets, &prev.sync_tokens, edit);
+    let mut relexed = ModuleColumns {
+      source: code,
+      ..Default::default()
+    };
+    self.lex_from(code, Some(&from), &mut sync, &mut relexed)?;
+
+    let (import_count, export_count) = (from.import_count as usize, from.export_count as usize);
+    let mut columns = ModuleColumns {
+      source: code,
+      ..Default::default()
+    };
+    let same = |offset| offset;
+    columns.imports.extend_mapped(&prev.columns.imports, 0..import_count, same);
+    columns.imports.extend_mapped(&relexed.imports, 0..relexed.imports.len(), same);
+    columns.exports.extend_mapped(&prev.columns.exports, 0..export_count, same);
+    columns.exports.extend_mapped(&relexed.exports, 0..relexed.exports.len(), same);
+    // the points before the restart keep their open tokens, the ones
+    // recorded since have theirs appended
+    let mut syncs = prev.syncs[..=restart].to_vec();
+    let mut sync_tokens = prev.sync_tokens[..(from.stack + from.open_token_depth + 1) as usize].to_vec();
+    let base = sync_tokens.len() as u32;
+    syncs.extend(sync.points().iter().map(|point| SyncPoint {
+      stack: point.stack + base,
+      ..*point
+    }));
+    sync_tokens.extend_from_slice(sync.tokens());
+
+    let mut end = code.len();
+    if sync.converged {
+      let targets = &targets[sync.target_index as usize..];
+      let target = targets[0];
+      let map = |offset| edit.map(offset);
+      let old_imports = target.import_count as usize..prev.columns.imports.len();
+      let old_exports = target.export_count as usize..prev.columns.exports.len();
+      columns.imports.extend_mapped(&prev.columns.imports, old_imports, map);
+      columns.exports.extend_mapped(&prev.columns.exports, old_exports, map);
+      let import_shift = ((import_count + relexed.imports.len()) as u32).wrapping_sub(target.import_count);
+      let export_shift = ((export_count + relexed.exports.len()) as u32).wrapping_sub(target.export_count);
+      for point in targets {
+        let stack = point.stack as usize..(point.stack + point.open_token_depth + 1) as usize;
+        syncs.push(SyncPoint {
+          pos: map(point.pos),
+          horizon: map(point.horizon),
+          last_token_pos: map(point.last_token_pos),
+          import_count: point.import_count.wrapping_add(import_shift),
+          export_count: point.export_count.wrapping_add(export_shift),
+          stack: sync_tokens.len() as u32,
+          ..*point
+        });
+        sync_tokens.extend(prev.sync_tokens[stack].iter().map(|token| SyncToken {
+          pos: map(token.pos),
+          ..*token
+        }));
+      }
+      end = map(target.pos) as usize;
+    }
+
+    Ok(IncrementalColumns {
+      columns,
+      syncs,
+      sync_tokens,
+      relexed: from.pos as usize..end,
+    })
+  }
+
+  fn lex_from<'a>(
+    &mut self,
+    code: &'a str,
+    from: Option<&SyncPoint>,
+    sync: &mut SyncLog,
+    columns: &mut ModuleColumns<'a>,
+  ) -> Result<(), usize> {
+    self.reset();
+    let mut result: ParseResult = unsafe { MaybeUninit::zeroed().assume_init() };
+    let success = unsafe {
+      parse_incremental(
+        code.as_ptr(),
+        code.len() as u32,
+        alloc,
+        &mut self.bump as *mut Bump as *mut c_void,
+        &mut result as *mut ParseResult,
+        sync as *mut SyncLog,
+        from.map_or(ptr::null(), |from| from as *const SyncPoint),
+      )
+    };
+    self.high_water_mark = self.high_water_mark.max(self.bump.allocated_bytes());
+    if !success {
+      return Err(result.parse_error as usize);
+    }
+    columns.fill(&Module {
+      first_import: result.first_import,
+      first_export: result.first_export,
+      facade: result.facade,
+      lines: result.lines(),
+      #[cfg(feature = "stats")]
+      stats: result.stats,
+    });
+    Ok(())
+  }
+
+  /// Releases the previous results, shrinking the arena if it grew past the
+  /// retain limit.
+  pub fn reset(&mut self) {
+    recycle(&mut self.bump, self.retain_limit);
+  }
+
+  /// The largest arena size reached by any call so far.
+  pub fn high_water_mark(&self) -> usize {
+    self.high_water_mark
+  }
+
+  /// The arena size currently held by this context.
+  pub fn allocated_bytes(&self) -> usize {
+    self.bump.allocated_bytes()
+  }
+}
+
+impl Default for Lexer {
+  fn default() -> Self {
+    Self::new()
+  }
+}
+
+/// Lexes many sources at once over a pool of scoped threads.
+///
+/// Each worker owns an arena that is kept between calls to [`LexBatch::lex`]
+/// and reset at the start of the next one. Sources are handed out largest
+/// first from a shared cursor, so a single large bundle is started early
+/// instead of being left for the tail of the batch, and idle workers keep
+/// taking whatever is left.
+pub struct LexBatch {
+  arenas: Vec<Bump>,
+}
+
+impl LexBatch {
+  /// Creates a batch lexer with one worker per available core.
+  pub fn new() -> Self {
+    Self::with_threads(thread::available_parallelism().map_or(1, NonZeroUsize::get))
+  }
+
+  pub fn with_threads(threads: usize) -> Self {
+    LexBatch {
+      arenas: (0..threads.max(1)).map(|_| Bump::new()).collect(),
+    }
+  }
+
+  pub fn threads(&self) -> usize {
+    self.arenas.len()
+  }
+
+  /// Lexes every source, returning the results in input order. On error the
+  /// entry holds the parse error offset, as with [`lex`].
+  pub fn lex<'a>(&'a mut self, sources: &[&'a str]) -> Vec<Result<Module<'a>, usize>> {
+    self.run(sources, lex_module)
+  }
+
+  /// Like [`LexBatch::lex`], also interning the specifiers of each module's
+  /// imports from the worker threads. Each result holds one entry per import,
+  /// as returned by [`Interner::intern_import`].
+  pub fn lex_interned<'a>(
+    &'a mut self,
+    sources: &[&'a str],
+    interner: &Interner,
+  ) -> Vec<Result<(Module<'a>, Vec<Option<Symbol>>), usize>> {
+    self.run(sources, |code, bump| {
+      let module = lex_module(code, bump)?;
+      let symbols = module.imports().map(|import| interner.intern_import(import)).collect();
+      Ok((module, symbols))
+    })
+  }
+
+  fn run<'a, R: Send>(&'a mut self, sources: &[&'a str], lex: impl Fn(&'a str, &mut Bump) -> R + Sync) -> Vec<R> {
+    for bump in &mut self.arenas {
+      recycle(bump, DEFAULT_RETAIN_LIMIT);
+    }
+
+    let threads = self.arenas.len().min(sources.len());
+    if threads <= 1 {
+      let bump = &mut self.arenas[0];
+      return sources.iter().map(|code| lex(code, bump)).collect();
+    }
+
+    let mut order: Vec<usize> = (0..sources.len()).collect();
+    order.sort_unstable_by_key(|&i| std::cmp::Reverse(sources[i].len()));
+    let order = &order;
+    let cursor = &AtomicUsize::new(0);
+
+    let lex = &lex;
+    let mut results: Vec<Option<R>> = (0..sources.len()).map(|_| None).collect();
+    thread::scope(|scope| {
+      let workers: Vec<_> = self.arenas[..threads]
+        .iter_mut()
+        .map(|bump| {
+          scope.spawn(move || {
+            let mut done = Vec::new();
+            loop {
+              let next = cursor.fetch_add(1, Ordering::Relaxed);
+              if next >= order.len() {
+                break;
+              }
+              let i = order[next];
+              done.push((i, lex(sources[i], bump)));
+            }
+            done
+          })
+        })
+        .collect();
+      for worker in workers {
+        for (i, res) in worker.join().unwrap() {
+          results[i] = Some(res);
+        }
+      }
+    });
+
+    results.into_iter().map(Option::unwrap).collect()
+  }
+}
+
+impl Default for LexBatch {
+  fn default() -> Self {
+    Self::new()
+  }
+}
+
+fn lex_module<'a>(code: &'a str, bump: &mut Bump) -> Result<Module<'a>, usize> {
+  let result = parse_in(code.as_bytes(), bump, None)?;
+  Ok(Module {
+    first_import: result.first_import,
+    first_export: result.first_export,
+    facade: result.facade,
+    lines: result.lines(),
+    #[cfg(feature = "stats")]
+    stats: result.stats,
+  })
+}
+
 #[cfg(test)]
 mod tests {
   use super::*;
@@ -437,4 +1566,503 @@ mod tests {
       ]
     );
   }
+
+  #[test]
+  fn batch() {
+    let big = "import a from 'a';\n".repeat(5000);
+    let sources: Vec<String> = (0..64)
+      .map(|i| match i % 4 {
+        0 => format!("import x from './{}.js';\nexport const y = {};", i, i),
+        1 => format!("require('./{}');\nimport('./{}');", i, i),
+        2 => String::from("import ("),
+        _ => big.clone(),
+      })
+      .collect();
+    let sources: Vec<&str> = sources.iter().map(String::as_str).collect();
+
+    let mut batch = LexBatch::with_threads(4);
+    for _ in 0..2 {
+      let results = batch.lex(&sources);
+      assert_eq!(results.len(), sources.len());
+      for (source, res) in sources.iter().zip(results.iter()) {
+        match (lex(source), res) {
+          (Ok(expected), Ok(module)) => {
+            let imports: Vec<_> = module.imports().map(|i| i.specifier().into_owned()).collect();
+            let exports: Vec<_> = module.exports().map(|e| e.exported().to_string()).collect();
+            assert_eq!(imports, expected.imports().map(|i| i.specifier().into_owned()).collect::<Vec<_>>());
+            assert_eq!(exports, expected.exports().map(|e| e.exported().to_string()).collect::<Vec<_>>());
+          }
+          (Err(expected), Err(actual)) => assert_eq!(*actual, expected),
+          _ => panic!("batch result differs from lex()"),
+        }
+      }
+    }
+  }
+
+  #[test]
+  fn lexer_reuse() {
+    let mut lexer = Lexer::with_retain_limit(64 << 10);
+    for i in 0..100 {
+      let source = format!("import a from './{}.js'; export {{ a }};", i);
+      let module = lexer.lex(&source).unwrap();
+      let imports: Vec<_> = module.imports().map(|i| i.specifier().into_owned()).collect();
+      assert_eq!(imports, vec![format!("./{}.js", i)]);
+      assert_eq!(module.exports().map(|e| e.exported().to_string()).collect::<Vec<_>>(), vec!["a"]);
+    }
+    assert!(lexer.lex("import (").is_err());
+
+    let outlier = "import a from 'a';\n".repeat(20000);
+    assert_eq!(lexer.lex(&outlier).unwrap().imports().count(), 20000);
+    let peak = lexer.allocated_bytes();
+    assert!(peak > 64 << 10);
+    assert_eq!(lexer.high_water_mark(), peak);
+
+    lexer.reset();
+    assert!(lexer.allocated_bytes() <= 64 << 10);
+    assert_eq!(lexer.high_water_mark(), peak);
+    assert_eq!(lexer.lex("import 'b';").unwrap().imports().count(), 1);
+  }
+
+  #[test]
+  fn columns() {
+    let source = r#"
+      import a, { b as c } from './a.js' assert { type: 'json' };
+      import.meta.url;
+      import('./\x62.js');
+      require(foo);
+      export { c as d, a };
+      export default a;
+    "#;
+    let mut lexer = Lexer::new();
+    let mut columns = lexer.lex_columns(source).unwrap();
+    let expected = lex(source).unwrap();
+
+    assert_eq!(columns.imports.len(), expected.imports().count());
+    for (i, import) in expected.imports().enumerate() {
+      assert_eq!(columns.specifier(i), import.specifier());
+      assert_eq!(columns.imports.kind[i], import.kind());
+      if import.kind() != ImportKind::DynamicExpression {
+        assert_eq!(columns.statement(i), import.statement());
+      }
+    }
+    assert_eq!(columns.imports.assert_index[0] as usize, source.find("{ type").unwrap());
+    assert_eq!(columns.imports.assert_index[1], NONE);
+    assert_eq!(columns.imports.dynamic_start[0], NONE);
+    assert_eq!(columns.imports.dynamic_start[2] as usize, source.find("('./").unwrap());
+    assert_eq!(columns.specifier(2), "./b.js");
+
+    let exports: Vec<_> = (0..columns.exports.len()).map(|i| (columns.exported(i), columns.local(i))).collect();
+    assert_eq!(exports, vec![("d", Some("c")), ("a", Some("a")), ("default", None)]);
+
+    lexer.lex_columns_into("export var x;", &mut columns).unwrap();
+    assert!(columns.imports.is_empty());
+    assert_eq!(columns.exported(0), "x");
+  }
+
+  #[test]
+  fn deep_nesting() {
+    let depth = 1_000_000;
+    let source = format!("{}import('a'){}", "(".repeat(depth), ")".repeat(depth));
+    let res = lex(&source).unwrap();
+    assert_eq!(res.imports().map(|i| i.specifier().into_owned()).collect::<Vec<_>>(), vec!["a"]);
+
+    let source = format!("x = {}1{};", "[{a:".repeat(depth), "}]".repeat(depth));
+    assert!(lex(&source).is_ok());
+
+    let source = format!("{}x{}", "`${".repeat(depth), "}`".repeat(depth));
+    assert!(lex(&source).is_ok());
+
+    let source = format!("{}'b'{}", "import(".repeat(depth / 10), ")".repeat(depth / 10));
+    assert_eq!(lex(&source).unwrap().imports().count(), depth / 10);
+
+    assert!(lex(&"(".repeat(depth)).is_err());
+  }
+
+  #[test]
+  fn unicode_identifiers() {
+    // 丠 and 𠮷 contain an A0 byte, which is not a no-break space on its own
+    let res = lex("丠import('a');\nexport { 𠮷, ℘x as ゛y };\nx = 1;\u{a0}import('b');").unwrap();
+    assert_eq!(res.imports().map(|i| i.specifier().into_owned()).collect::<Vec<_>>(), vec!["b"]);
+    assert_eq!(res.exports().map(|e| e.exported().to_string()).collect::<Vec<_>>(), vec!["𠮷", "゛y"]);
+
+    let res = lex("export {\u{a0}a\u{a0}as\u{a0}b\u{a0}}").unwrap();
+    let exports: Vec<_> = res.exports().map(|e| (e.exported().to_string(), e.local().map(str::to_string))).collect();
+    assert_eq!(exports, vec![("b".to_string(), Some("a".to_string()))]);
+  }
+
+  #[test]
+  fn stream() {
+    let source = r#"
+      import a, { b as c } from './a.js' assert { type: 'json' };
+      /* comment */ export const x = `template ${import('./\u{1F600}.js')}`;
+      require('./b' /* c */);
+      if (x / 2 / 1) import.meta.url;
+      export { c as d, a } from "./e.js";
+      const re = /[/'"]/g; "string with 'quotes' and ünïcödé";
+      export default class {}
+    "#;
+    let expected = lex(source).unwrap();
+    let expected_imports: Vec<_> = expected.imports().map(|i| (i.specifier().into_owned(), i.statement().to_string())).collect();
+    let expected_exports: Vec<_> = expected.exports().map(|e| (e.exported().to_string(), e.local().map(str::to_string))).collect();
+
+    for size in [1, 2, 3, 7, 16, 64, 4096] {
+      let mut stream = LexStream::new();
+      for chunk in source.as_bytes().chunks(size) {
+        stream.feed(chunk).unwrap();
+      }
+      let res = stream.finish().unwrap();
+      assert_eq!(res.source(), source);
+      let imports: Vec<_> = res.imports().map(|i| (i.specifier().into_owned(), i.statement().to_string())).collect();
+      let exports: Vec<_> = res.exports().map(|e| (e.exported().to_string(), e.local().map(str::to_string))).collect();
+      assert_eq!(imports, expected_imports);
+      assert_eq!(exports, expected_exports);
+    }
+
+    let mut stream = LexStream::new();
+    stream.feed(b"import a from 'a';\n").unwrap();
+    stream.feed(b"})").unwrap();
+    assert!(stream.feed(&[b' '; 64]).is_err());
+
+    let mut stream = LexStream::new();
+    stream.feed(b"import 'unterminated").unwrap();
+    assert!(stream.finish().is_err());
+  }
+
+  #[test]
+  fn bytes_and_files() {
+    // ends without padding in the middle of an identifier, keyword and decode
+    for tail in ["", "requir", "import.met", "export { b }", "x = \u{e9}", "import('a', {"] {
+      let source = format!("import a from 'a';\n{}", tail);
+      let code = source.as_bytes().to_vec().into_boxed_slice();
+      assert_eq!(lex_bytes(&code).map(|r| r.imports().count()), lex(&source).map(|r| r.imports().count()));
+      assert_eq!(lex_bytes(&code).map(|r| r.exports().count()), lex(&source).map(|r| r.exports().count()));
+    }
+
+    let res = lex_bytes(b"import a from './\xff.js';");
+    assert_eq!(res.err(), Some(17));
+    assert_eq!(lex_bytes(b"export defaul").err(), Some(7));
+    let res = lex_bytes(b"/* \xff */ import a from './a.js';").unwrap();
+    assert_eq!(res.imports().next().unwrap().specifier(), "./a.js");
+
+    let dir = std::env::temp_dir().join(format!("es-module-lexer-{}", std::process::id()));
+    std::fs::create_dir_all(&dir).unwrap();
+    let path = dir.join("page.js");
+    let mut source = String::from("export { a } from './a.js';\nconst b = ");
+    source.push_str(&"x".repeat(4096 - source.len()));
+    std::fs::write(&path, &source).unwrap();
+    let res = lex_file(&path).unwrap();
+    assert_eq!(res.source(), source.as_bytes());
+    assert_eq!(res.imports().next().unwrap().specifier(), "./a.js");
+    assert_eq!(res.exports().next().unwrap().exported(), "a");
+
+    std::fs::write(&path, "").unwrap();
+    assert_eq!(lex_file(&path).unwrap().imports().count(), 0);
+    std::fs::write(&path, "import ( 'a'").unwrap();
+    assert!(matches!(lex_file(&path), Err(LexFileError::Parse(_))));
+    assert!(matches!(lex_file(dir.join("missing.js")), Err(LexFileError::Io(_))));
+    std::fs::remove_dir_all(&dir).unwrap();
+  }
+
+  #[test]
+  fn lookbehind_at_start() {
+    // the keyword checks before a `/` must not read before the first byte
+    for source in ["d/x/", "e/x/", "of/x/", "o/x/", "w/x/", "k/x/", "t/x/", ">{}/1", "e{}/1", "h{}/1"] {
+      let code = source.as_bytes().to_vec().into_boxed_slice();
+      assert_eq!(code.len(), source.len());
+      assert!(lex_bytes(&code).is_ok(), "{}", source);
+      assert_eq!(lex_bytes(&code).unwrap().imports().count(), 0);
+    }
+  }
+
+  #[test]
+  fn incremental() {
+    let mut source = String::from("import a from './a.js';\n(function () {\n");
+    for i in 0..2000 {
+      source.push_str(&format!("  const v{0} = import('./m{0}.js');\n  if (x) /re{0}/.test(s);\n", i));
+    }
+    source.push_str("})();\nexport { a };\n");
+    let mut lexer = Lexer::new();
+    let prev = lexer.lex_incremental(&source).unwrap();
+
+    let mut relex = |prev: &IncrementalColumns, start: usize, old_end: usize, insert: &str| {
+      let code = format!("{}{}{}", &source[..start], insert, &source[old_end..]);
+      let edit = Edit {
+        start,
+        old_end,
+        new_end: start + insert.len(),
+      };
+      let res = lexer.relex(prev, edit, &code);
+      let full = Lexer::new().lex_columns(&code);
+      assert_eq!(res.as_ref().map(|res| &res.columns), full.as_ref());
+      res.map(|res| res.relexed())
+    };
+
+    let middle = source.find("const v1000").unwrap();
+    // the cost follows the edit, not the source
+    let relexed = relex(&prev, middle, middle, "import('./b.js');\n").unwrap();
+    assert!(relexed.len() < 4096, "{:?}", relexed);
+    let relexed = relex(&prev, middle + 6, middle + 11, "renamed").unwrap();
+    assert!(relexed.len() < 4096, "{:?}", relexed);
+    // an unterminated template changes everything after it
+    assert!(relex(&prev, middle, middle, "`").is_err());
+    let relexed = relex(&prev, middle, middle, "/*").unwrap_err();
+    assert_eq!(relexed, Lexer::new().lex_columns(&format!("{}/*{}", &source[..middle], &source[middle..])).unwrap_err());
+    // edits at either end
+    relex(&prev, 0, 0, "export var p = 5;\n").unwrap();
+    relex(&prev, source.len(), source.len(), "export { b };\n").unwrap();
+
+    // an edit that does not match the sources lexes in full
+    let edit = Edit {
+      start: 0,
+      old_end: 0,
+      new_end: 5,
+    };
+    assert_eq!(lexer.relex(&prev, edit, &source).unwrap().relexed(), 0..source.len());
+  }
+
+  #[test]
+  fn interner() {
+    let sources: Vec<String> = (0..200)
+      .map(|i| {
+        format!(
+          "import a from 'react';\nimport b from './{}.js';\nexport * from \"node:f\\u0073\";\nimport(x);\nimport.meta;",
+          i % 10
+        )
+      })
+      .collect();
+    let sources: Vec<&str> = sources.iter().map(String::as_str).collect();
+
+    let interner = Interner::new();
+    let mut batch = LexBatch::with_threads(4);
+    let results = batch.lex_interned(&sources, &interner);
+    assert_eq!(interner.len(), 12);
+    let react = interner.get("react").unwrap();
+    let fs = interner.get("node:fs").unwrap();
+    for (i, res) in results.iter().enumerate() {
+      let (module, symbols) = res.as_ref().unwrap();
+      assert_eq!(symbols.len(), module.imports().count());
+      assert_eq!(symbols[0], Some(react));
+      assert_eq!(interner.resolve(symbols[1].unwrap()), format!("./{}.js", i % 10));
+      assert_eq!(&symbols[2..], &[Some(fs), None, None]);
+    }
+    assert_eq!(interner.resolve(fs), "node:fs");
+    assert_eq!(interner.hash(fs), hash_specifier("node:fs"));
+    assert_ne!(hash_specifier("node:fs"), hash_specifier("node:fs\0"));
+
+    // concurrent interning agrees on one symbol per specifier
+    let names: Vec<String> = (0..5000).map(|i| format!("pkg-{}", i)).collect();
+    let symbols: Vec<Vec<Symbol>> = thread::scope(|scope| {
+      let workers: Vec<_> = (0..4)
+        .map(|_| scope.spawn(|| names.iter().map(|name| interner.intern(name)).collect::<Vec<_>>()))
+        .collect();
+      workers.into_iter().map(|worker| worker.join().unwrap()).collect()
+    });
+    assert!(symbols.iter().all(|s| *s == symbols[0]));
+    assert_eq!(interner.len(), 5012);
+    for (name, symbol) in names.iter().zip(&symbols[0]) {
+      assert_eq!(interner.resolve(*symbol), name);
+    }
+  }
+
+  #[test]
+  fn lex_options() {
+    let barrel = "export * from './a.js';\nexport { b } from './b.js';\nimport c from './c.js' assert { type: 'json' };\nexport const d = import('./d.js');\nimport.meta.url;\nexport { c };\n";
+    let mut lexer = Lexer::new();
+    let full = lexer.lex_columns(barrel).unwrap();
+    let columns = |module: &Module| {
+      let mut columns = ModuleColumns {
+        source: barrel,
+        ..Default::default()
+      };
+      columns.fill(module);
+      columns
+    };
+
+    let module = lexer.lex(barrel).unwrap();
+    assert!(!module.facade());
+    let module = lexer.lex_with(barrel, LexOptions::default()).unwrap();
+    assert_eq!(columns(&module), full);
+
+    let module = lexer.lex_with(barrel, LexOptions::imports_only()).unwrap();
+    assert_eq!(module.exports().count(), 0);
+    assert_eq!(columns(&module).imports, full.imports);
+
+    let module = lexer.lex_with(barrel, LexOptions::exports_only()).unwrap();
+    assert_eq!(module.imports().count(), 0);
+    assert_eq!(columns(&module).exports, full.exports);
+
+    // stops at the first non-facade statement, with the exports before it
+    let module = lexer.lex_with(barrel, LexOptions::facade_only()).unwrap();
+    assert!(!module.facade());
+    assert_eq!(module.imports().count(), 0);
+    assert_eq!(module.exports().map(|e| e.exported().to_string()).collect::<Vec<_>>(), vec!["b", "d"]);
+    let module = lexer
+      .lex_with("export * from 'a';\nexport { b } from 'b';", LexOptions::facade_only())
+      .unwrap();
+    assert!(module.facade());
+    assert_eq!(module.exports().count(), 1);
+
+    let module = lexer.lex_with(barrel, LexOptions::first_imports(2)).unwrap();
+    assert_eq!(module.imports().map(|i| i.specifier().into_owned()).collect::<Vec<_>>(), vec!["./a.js", "./b.js"]);
+    let module = lexer.lex_with(barrel, LexOptions::first_imports(3)).unwrap();
+    let imports = columns(&module).imports;
+    assert_eq!(imports.len(), 3);
+    assert_eq!(imports.assert_index[2], full.imports.assert_index[2]);
+    assert_eq!(imports.statement_end[2], full.imports.statement_end[2]);
+  }
+
+  #[test]
+  fn lines() {
+    let source = "import a from 'a';\r\n\n  export { b };\nimport('ü/c')";
+    let mut lexer = Lexer::new();
+    assert!(lexer.lex(source).unwrap().lines().is_none());
+
+    let full = lexer.lex_columns(source).unwrap();
+    let module = lexer.lex_with(source, LexOptions { lines: true, ..Default::default() }).unwrap();
+    let lines = module.lines().unwrap();
+    assert_eq!(lines.starts(), &[0, 20, 21, 37]);
+    let position = |offset| {
+      let Position { line, column } = lines.position(offset);
+      (line, column)
+    };
+    assert_eq!(position(full.imports.start[0]), (1, 15));
+    assert_eq!(position(full.exports.start[0]), (3, 11));
+    assert_eq!(position(full.imports.start[1]), (4, 7));
+    assert_eq!(position(19), (1, 19));
+    assert_eq!(position(20), (2, 0));
+    assert_eq!(position(source.len() as u32), (4, 14));
+    assert_eq!(LineIndex { starts: &[] }.position(5), Position { line: 1, column: 5 });
+
+    // one scan through the vector loops, with a newline in every position
+    let source = "a\n".repeat(100) + &"\n".repeat(70) + "b";
+    let module = lexer.lex_with(&source, LexOptions { lines: true, ..Default::default() }).unwrap();
+    let expected: Vec<u32> = std::iter::once(0).chain(source.match_indices('\n').map(|(i, _)| i as u32 + 1)).collect();
+    assert_eq!(module.lines().unwrap().starts(), &expected[..]);
+  }
+
+  #[test]
+  fn unescape() {
+    let source = r#"
+      import './plain.js';
+      import './\x61b\u{63}\u{1F600}.js';
+      import './\101\0\400\18.js';
+      import './line\
+continued 😀.js';
+      import('./\u{110000}.js');
+      import('./\uD800.js');
+      import(`./\1.js`);
+      import(`./t\u{74}\0.js`);
+      export { a as "\x62" };
+    "#;
+    let module = lex(source).unwrap();
+    let specifiers: Vec<(String, bool)> = module.imports().map(|i| (i.specifier().into_owned(), i.escaped)).collect();
+    assert_eq!(
+      specifiers,
+      vec![
+        ("./plain.js".to_string(), false),
+        ("./abc\u{1F600}.js".to_string(), true),
+        ("./A\0 0\u{1}8.js".to_string(), true),
+        ("./linecontinued \u{1F600}.js".to_string(), true),
+        // invalid and lone surrogate escapes are left undecoded
+        (r"./\u{110000}.js".to_string(), true),
+        (r"./\uD800.js".to_string(), true),
+        (r"./\1.js".to_string(), true),
+        ("./tt\0.js".to_string(), true),
+      ]
+    );
+    let columns = Lexer::new().lex_columns(source).unwrap();
+    for (i, (specifier, escaped)) in specifiers.iter().enumerate() {
+      assert_eq!(columns.specifier(i), specifier.as_str());
+      assert_eq!(columns.imports.escaped[i], *escaped);
+    }
+    let export = module.exports().next().unwrap();
+    assert!(export.escaped && !export.local_escaped);
+  }
+
+  #[cfg(feature = "stats")]
+  #[test]
+  fn stats() {
+    let mut lexer = Lexer::new();
+    let code = r#"
+      // line
+      /* block */
+      import a from 'a';
+      const x = `t ${b}` / 2, y = /re/g;
+      import('c') {}
+      export { a };
+    "#;
+    let stats = *lexer.lex(code).unwrap().stats();
+    assert_eq!(stats.line_comment.calls, 1);
+    assert_eq!(stats.line_comment.bytes, "// line".len() as u64);
+    assert_eq!(stats.block_comment.calls, 1);
+    assert_eq!(stats.string_literal.calls, 2);
+    assert_eq!(stats.template_string.calls, 2);
+    assert_eq!(stats.regular_expression.calls, 1);
+    assert_eq!((stats.regex_decisions, stats.division_decisions), (1, 1));
+    assert_eq!(stats.dynamic_import_removals, 1);
+    assert_eq!(stats.max_open_token_depth, 2);
+    // two imports, one of them dropped, and one export
+    assert_eq!(stats.allocations, 3);
+
+    // deep nesting grows the stacks through the allocator
+    let code = format!("{}{}", "(".repeat(1000), ")".repeat(1000));
+    let stats = *lexer.lex(&code).unwrap().stats();
+    assert_eq!(stats.max_open_token_depth, 1000);
+    assert!(stats.allocations > 0 && stats.allocated_bytes > 1000 * 8);
+
+    // every lex starts from zero
+    assert_eq!(*lexer.lex("").unwrap().stats(), LexStats::default());
+  }
+
+  #[cfg(feature = "cache")]
+  #[test]
+  fn cache() {
+    use std::io::Write;
+
+    let dir = std::env::temp_dir().join(format!("es-module-lexer-cache-{}", std::process::id()));
+    let sources: Vec<String> = (0..50)
+      .map(|i| format!("import a{0} from './a{0}.js';\nexport {{ b{0} as c }};\nimport(`./d${{x}}`);", i))
+      .collect();
+    let bad = "import ( 'a'";
+    let bad_offset = lex(bad).err().unwrap();
+
+    let mut cache = LexCache::open(&dir).unwrap();
+    for code in &sources {
+      assert_eq!(cache.lex(code), Lexer::new().lex_columns(code));
+    }
+    assert_eq!(cache.lex(bad), Err(bad_offset));
+    assert_eq!(cache.len(), 51);
+    drop(cache);
+
+    // a second process sees every result without lexing
+    let cache = LexCache::open(&dir).unwrap();
+    assert_eq!(cache.len(), 51);
+    for code in &sources {
+      assert_eq!(cache.get(code).unwrap(), Lexer::new().lex_columns(code));
+    }
+    assert_eq!(cache.get(bad), Some(Err(bad_offset)));
+    assert_eq!(cache.get("export var p = 5"), None);
+
+    // a torn append is dropped by the next writer, keeping the records before it
+    let mut file = std::fs::OpenOptions::new().append(true).open(dir.join("index")).unwrap();
+    file.write_all(&[0x58, 0x52, 0x45, 0x43, 200, 0, 0]).unwrap();
+    let mut cache = LexCache::open(&dir).unwrap();
+    assert_eq!(cache.len(), 51);
+    cache.lex("export var p = 5").unwrap();
+    cache.flush().unwrap();
+    assert_eq!(LexCache::open(&dir).unwrap().len(), 52);
+    drop(cache);
+
+    // the oldest records are evicted to stay within the bound
+    let index_len = std::fs::metadata(dir.join("index")).unwrap().len();
+    let mut cache = LexCache::with_max_bytes(&dir, index_len).unwrap();
+    cache.lex("export var q = 5").unwrap();
+    cache.flush().unwrap();
+    assert!(std::fs::metadata(dir.join("index")).unwrap().len() <= index_len / 2);
+    assert!(cache.get("export var q = 5").is_some());
+    assert!(cache.get(&sources[0]).is_none());
+    drop(cache);
+
+    std::fs::remove_dir_all(&dir).unwrap();
+  }
 }
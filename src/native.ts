@@ -0,0 +1,132 @@
+import { createRequire } from 'module';
+import { parse as parseWasm, init as initWasm, LineIndex } from './lexer.js';
+import type { ImportSpecifier, ExportSpecifier, ParseOptions, Position } from './lexer.js';
+
+export type { ImportSpecifier, ExportSpecifier, ParseOptions, Position };
+export { LineIndex };
+
+interface Binding {
+  /**
+   * Records as [facade, importCount, exportCount, ...imports, ...exports],
+   * or the parse error offset, line and column
+   */
+  parse(source: string | Uint8Array, lines: boolean): Int32Array | [idx: number, line: number, column: number];
+}
+
+const IMPORT_FIELDS = 7, EXPORT_FIELDS = 5;
+const IMPORT_RANGE_FIELDS = 2, EXPORT_RANGE_FIELDS = 4;
+
+function loadBinding (): Binding | null {
+  const require = createRequire(import.meta.url);
+  for (const path of [
+    `../prebuilds/${process.platform}-${process.arch}/es_module_lexer.node`,
+    '../build/Release/es_module_lexer.node'
+  ]) {
+    try {
+      return require(path);
+    }
+    catch (e) {}
+  }
+  return null;
+}
+
+const binding = loadBinding();
+
+/**
+ * Whether the native addon was loaded. Otherwise `parse` runs on the wasm
+ * build.
+ */
+export const native = binding !== null;
+
+/**
+ * Wait for init to resolve before calling `parse`.
+ */
+export const init: Promise<void> = binding ? Promise.resolve() : initWasm;
+
+// names in a byte source are decoded from their byte ranges as they are, byte
+// order mark included
+const decoder = new TextDecoder('utf-8', { ignoreBOM: true });
+
+/**
+ * Outputs the list of exports and locations of import specifiers,
+ * including dynamic import and import meta handling.
+ *
+ * Sources given as a `Buffer` or `Uint8Array` hold UTF-8 and are lexed
+ * without conversion. Offsets are UTF-16 indices into the source text either
+ * way, on the native addon and the wasm build alike.
+ *
+ * @param source Source code to parser
+ * @param name Optional sourcename
+ * @param options Optional `{ lines: true }` for a `LineIndex` of the source
+ * @returns Tuple contaning imports list and exports list, and the line index
+ * when asked for.
+ */
+export function parse (source: string | Uint8Array, name = '@', options: ParseOptions = {}): readonly [
+  imports: ReadonlyArray<ImportSpecifier>,
+  exports: ReadonlyArray<ExportSpecifier>,
+  facade: boolean,
+  lines?: LineIndex
+] {
+  if (!binding)
+    return parseWasm(source, name, options);
+
+  const result = binding.parse(source, !!options.lines);
+
+  if (!(result instanceof Int32Array)) {
+    const [idx, line, column] = result;
+    throw Object.assign(new Error(`Parse error ${name}:${line}:${column + 1}`), { idx });
+  }
+
+  const out = result;
+  const bytes = typeof source !== 'string';
+  const slice = typeof source === 'string' ? stringSlicer(source) : bytesSlicer(source);
+
+  const imports: ImportSpecifier[] = [], exports: ExportSpecifier[] = [];
+  const importCount = out[1], exportCount = out[2];
+  // names in a byte source are sliced at their byte ranges rather than offsets
+  let i = 3, range = i + importCount * IMPORT_FIELDS + exportCount * EXPORT_FIELDS;
+  let strings = bytes ? range + importCount * IMPORT_RANGE_FIELDS + exportCount * EXPORT_RANGE_FIELDS : range;
+  for (const end = i + importCount * IMPORT_FIELDS; i < end; i += IMPORT_FIELDS) {
+    const s = out[i], e = out[i + 1], ss = out[i + 2], se = out[i + 3], d = out[i + 4], a = out[i + 5];
+    const bs = bytes ? out[range++] : s, be = bytes ? out[range++] : e;
+    const n = value(out[i + 6], d === -1 ? bs - 1 : bs, d === -1 ? be + 1 : be);
+    imports.push({ n, s, e, ss, se, d, a });
+  }
+  for (const end = i + exportCount * EXPORT_FIELDS; i < end; i += EXPORT_FIELDS) {
+    const s = out[i], e = out[i + 1], ls = out[i + 2], le = out[i + 3], n = out[i + 4];
+    const bs = bytes ? out[range++] : s, be = bytes ? out[range++] : e;
+    const bls = bytes ? out[range++] : ls, ble = bytes ? out[range++] : le;
+    exports.push({
+      s, e, ls, le,
+      n: (n & 3) === 0 ? slice(bs, be) : value(n & 3, bs, be) as string,
+      ln: ls < 0 ? undefined : (n >> 2) === 0 ? slice(bls, ble) : value(n >> 2, bls, ble),
+    });
+  }
+
+  // the value of the quoted string at [s, e), in bytes for a byte source, see
+  // src/binding.h
+  function value (n: number, s: number, e: number) {
+    if (n === 1)
+      return slice(s + 1, e - 1);
+    if (n === 2) {
+      const len = out[strings];
+      const units = new Uint16Array(out.buffer, out.byteOffset + (strings + 1) * 4, len);
+      strings += 1 + (len + 1 >> 1);
+      return String.fromCharCode.apply(null, units as unknown as number[]);
+    }
+  }
+
+  if (!options.lines)
+    return [imports, exports, !!out[0]];
+  // the line starts end the records, followed by their count
+  const count = out[out.length - 1];
+  return [imports, exports, !!out[0], new LineIndex(new Uint32Array(out.buffer, out.byteOffset + (out.length - 1 - count) * 4, count))];
+}
+
+function stringSlicer (source: string) {
+  return (s: number, e: number) => source.slice(s, e);
+}
+
+function bytesSlicer (source: Uint8Array) {
+  return (s: number, e: number) => decoder.decode(source.subarray(s, e));
+}
@@ -0,0 +1,37 @@
+import { parentPort, workerData } from 'worker_threads';
+
+// Lexes batches of UTF-8 sources for src/pool.ts, on its own instance of the
+// module compiled by the main thread.
+
+const wasm = new WebAssembly.Instance(workerData as WebAssembly.Module).exports as {
+  memory: WebAssembly.Memory;
+  parse(len: number, lines: boolean, bytes: boolean): boolean;
+  /** getErr */
+  e(): number;
+  /** getErrLine */
+  el(): number;
+  /** getErrColumn */
+  ec(): number;
+  /** readRecords */
+  rd(): number;
+  /** recordsLength */
+  rl(): number;
+  /** allocateSource */
+  sa(capacity: number): number;
+};
+
+// Replies with the records of each source, see src/binding.h, with the byte
+// ranges of the names for the sources given as bytes, or the parse error
+// offset, line and column
+parentPort!.on('message', ([sources, bytes]: [Uint8Array[], boolean[]]) => {
+  const results = sources.map((source, i) => {
+    const len = source.byteLength;
+    const addr = wasm.sa(len);
+    new Uint8Array(wasm.memory.buffer, addr, len).set(source);
+    if (!wasm.parse(len, false, bytes[i]))
+      return [wasm.e(), wasm.el(), wasm.ec()];
+    const start = wasm.rd() >> 2;
+    return new Int32Array(wasm.memory.buffer).slice(start, start + wasm.rl());
+  });
+  parentPort!.postMessage(results, results.filter((r): r is Int32Array => r instanceof Int32Array).map(r => r.buffer));
+});
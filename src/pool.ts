@@ -0,0 +1,215 @@
+import { Worker } from 'worker_threads';
+import { cpus } from 'os';
+import { init, wasmModule } from './lexer.js';
+import type { ImportSpecifier, ExportSpecifier } from './lexer.js';
+
+export type { ImportSpecifier, ExportSpecifier };
+
+export interface ParseManyOptions {
+  /**
+   * Number of worker threads to lex on, by default one per CPU
+   */
+  threads?: number;
+}
+
+const IMPORT_FIELDS = 7, EXPORT_FIELDS = 5;
+const IMPORT_RANGE_FIELDS = 2, EXPORT_RANGE_FIELDS = 4;
+
+// Sources are sent to the workers in batches of at most about this many
+// bytes, and at least a few batches per worker, so that a worker finishing
+// early picks up the next batch
+const BATCH_BYTES = 1 << 20;
+const BATCHES_PER_WORKER = 4;
+
+// the offset, line and column of a parse error
+type ParseError = [idx: number, line: number, column: number];
+
+const encoder = new TextEncoder();
+// names in a byte source are decoded from their byte ranges as they are, byte
+// order mark included
+const decoder = new TextDecoder('utf-8', { ignoreBOM: true });
+
+/**
+ * The result of lexing one source with `parseMany`, holding its records as
+ * one `Int32Array`. Imports and exports are only read out of them when first
+ * accessed, which is when a parse error is thrown as by `parse`.
+ *
+ * @example
+ * const [module] = await parseMany([`import a from 'a'`]);
+ * module.imports[0].n;
+ * // Returns "a"
+ */
+export class ParsedModule {
+  private records: Int32Array | ParseError;
+  private source: string | Uint8Array;
+  private read: readonly [ReadonlyArray<ImportSpecifier>, ReadonlyArray<ExportSpecifier>] | undefined;
+
+  constructor (source: string | Uint8Array, records: Int32Array | ParseError) {
+    this.source = source;
+    this.records = records;
+  }
+
+  get imports (): ReadonlyArray<ImportSpecifier> {
+    return (this.read || (this.read = this.readRecords()))[0];
+  }
+
+  get exports (): ReadonlyArray<ExportSpecifier> {
+    return (this.read || (this.read = this.readRecords()))[1];
+  }
+
+  get facade (): boolean {
+    if (!(this.records instanceof Int32Array))
+      this.readRecords();
+    return !!(this.records as Int32Array)[0];
+  }
+
+  private readRecords (): readonly [ImportSpecifier[], ExportSpecifier[]] {
+    const out = this.records;
+    if (!(out instanceof Int32Array)) {
+      const [idx, line, column] = out;
+      throw Object.assign(new Error(`Parse error @:${line}:${column + 1}`), { idx });
+    }
+
+    const source = this.source;
+    const bytes = typeof source !== 'string';
+    const slice = typeof source === 'string'
+      ? (s: number, e: number) => source.slice(s, e)
+      : (s: number, e: number) => decoder.decode(source.subarray(s, e));
+
+    const imports: ImportSpecifier[] = [], exports: ExportSpecifier[] = [];
+    const importCount = out[1], exportCount = out[2];
+    // names in a byte source are sliced at their byte ranges rather than offsets
+    let i = 3, range = i + importCount * IMPORT_FIELDS + exportCount * EXPORT_FIELDS;
+    let strings = bytes ? range + importCount * IMPORT_RANGE_FIELDS + exportCount * EXPORT_RANGE_FIELDS : range;
+    for (const end = i + importCount * IMPORT_FIELDS; i < end; i += IMPORT_FIELDS) {
+      const s = out[i], e = out[i + 1], ss = out[i + 2], se = out[i + 3], d = out[i + 4], a = out[i + 5];
+      const bs = bytes ? out[range++] : s, be = bytes ? out[range++] : e;
+      const n = value(out[i + 6], d === -1 ? bs - 1 : bs, d === -1 ? be + 1 : be);
+      imports.push({ n, s, e, ss, se, d, a });
+    }
+    for (const end = i + exportCount * EXPORT_FIELDS; i < end; i += EXPORT_FIELDS) {
+      const s = out[i], e = out[i + 1], ls = out[i + 2], le = out[i + 3], n = out[i + 4];
+      const bs = bytes ? out[range++] : s, be = bytes ? out[range++] : e;
+      const bls = bytes ? out[range++] : ls, ble = bytes ? out[range++] : le;
+      exports.push({
+        s, e, ls, le,
+        n: (n & 3) === 0 ? slice(bs, be) : value(n & 3, bs, be) as string,
+        ln: ls < 0 ? undefined : (n >> 2) === 0 ? slice(bls, ble) : value(n >> 2, bls, ble),
+      });
+    }
+
+    // the value of the quoted string at [s, e), in bytes for a byte source,
+    // see src/binding.h
+    function value (n: number, s: number, e: number) {
+      if (n === 1)
+        return slice(s + 1, e - 1);
+      if (n === 2) {
+        const len = (out as Int32Array)[strings];
+        const units = new Uint16Array((out as Int32Array).buffer, (strings + 1) * 4, len);
+        strings += 1 + (len + 1 >> 1);
+        return String.fromCharCode.apply(null, units as unknown as number[]);
+      }
+    }
+
+    return [imports, exports];
+  }
+}
+
+interface PoolWorker {
+  worker: Worker;
+  // replies arrive in the order the batches were sent
+  pending: { resolve (results: (Int32Array | ParseError)[]): void, reject (err: Error): void }[];
+}
+
+const pool: PoolWorker[] = [];
+
+function spawn (): PoolWorker {
+  const worker = new Worker(new URL('./pool-worker.js', import.meta.url), { workerData: wasmModule });
+  const poolWorker: PoolWorker = { worker, pending: [] };
+  // idle workers do not keep the process alive
+  worker.unref();
+  worker.on('message', results => {
+    poolWorker.pending.shift()!.resolve(results);
+    if (!poolWorker.pending.length)
+      worker.unref();
+  });
+  // a worker that crashed or exited fails its batches in flight, and leaves
+  // the pool so that the next call spawns a new one in its place
+  const fail = (err: Error) => {
+    const index = pool.indexOf(poolWorker);
+    if (index !== -1)
+      pool.splice(index, 1);
+    for (const { reject } of poolWorker.pending.splice(0))
+      reject(err);
+  };
+  worker.on('error', fail);
+  worker.on('exit', code => fail(new Error(`Lexer worker exited with code ${code}`)));
+  return poolWorker;
+}
+
+// bytes says which sources were given as bytes, whose names are read from
+// their byte ranges
+function run (poolWorker: PoolWorker, sources: Uint8Array[], bytes: boolean[]): Promise<(Int32Array | ParseError)[]> {
+  return new Promise((resolve, reject) => {
+    if (!poolWorker.pending.length)
+      poolWorker.worker.ref();
+    poolWorker.pending.push({ resolve, reject });
+    poolWorker.worker.postMessage([sources, bytes], sources.map(source => source.buffer));
+  });
+}
+
+/**
+ * Lexes many sources at once on a pool of worker threads, each with its own
+ * instance of the wasm build.
+ *
+ * Sources are handed to the workers as UTF-8, with strings encoded and byte
+ * sources copied, and offsets are UTF-16 indices as with `parse`. The workers
+ * are kept for later calls, without holding the process open while idle.
+ *
+ * @param sources Source code to parse, as strings or `Uint8Array`s of UTF-8
+ * @returns A lazy `ParsedModule` per source, in order.
+ */
+export async function parseMany (sources: ReadonlyArray<string | Uint8Array>, { threads = cpus().length }: ParseManyOptions = {}): Promise<ParsedModule[]> {
+  await init;
+
+  const size = (source: string | Uint8Array) => typeof source === 'string' ? source.length : source.byteLength;
+  let total = 0;
+  for (const source of sources)
+    total += size(source);
+  const batchBytes = Math.min(BATCH_BYTES, Math.ceil(total / (Math.max(threads, 1) * BATCHES_PER_WORKER)));
+
+  // batches of consecutive sources, as their start indices
+  const batches: number[] = [];
+  for (let i = 0, bytes = batchBytes; i < sources.length; i++) {
+    if (bytes >= batchBytes) {
+      batches.push(i);
+      bytes = 0;
+    }
+    bytes += size(sources[i]);
+  }
+  batches.push(sources.length);
+
+  const workers = Math.min(Math.max(threads, 1), batches.length - 1);
+  while (pool.length < workers)
+    pool.push(spawn());
+
+  const results: ParsedModule[] = new Array(sources.length);
+  let next = 0;
+  await Promise.all(pool.slice(0, workers).map(async poolWorker => {
+    while (next < batches.length - 1) {
+      const start = batches[next], end = batches[++next];
+      const batch: Uint8Array[] = [], bytes: boolean[] = [];
+      for (let i = start; i < end; i++) {
+        const source = sources[i];
+        const encoded = typeof source === 'string' ? encoder.encode(source) : source;
+        // a copy owning its whole buffer, which is then transferred
+        batch.push(encoded !== source && encoded.byteLength === encoded.buffer.byteLength ? encoded : encoded.slice());
+        bytes.push(encoded === source);
+      }
+      const records = await run(poolWorker, batch, bytes);
+      for (let i = start; i < end; i++)
+        results[i] = new ParsedModule(sources[i], records[i - start]);
+    }
+  }));
+  return results;
+}
@@ -0,0 +1,109 @@
+// WebAssembly entry points used by src/lexer.ts.
+//
+// sa(capacity) returns space for a UTF-8 source of up to capacity bytes, of
+// which parse(len, lines, bytes) lexes the first len, recording the line
+// starts when lines is set, and the byte ranges of the names when bytes is set,
+// as for a Uint8Array source. After a successful parse, rd() returns the
+// address of all the records in one int32 region laid out as in binding.h, so
+// that they are read from a typed array instead of through a call per field,
+// and rl() their number of fields. Offsets are UTF-16 indices, mapped from
+// byte offsets only when the source is not ASCII. After a failed parse, e()
+// returns the error index, and el() and ec() its line and column.
+
+// the exported parse() lexes the source from sa()
+#define parse lexer_parse
+#include "lexer.c"
+#undef parse
+#include "binding.h"
+
+static Arena arena;
+static unsigned char* source;
+static size_t sourceCapacity;
+static int32_t* records;
+static size_t recordsCapacity;
+static uint32_t recordsLength;
+static uint32_t parseError;
+static int32_t parseErrorLine;
+static int32_t parseErrorColumn;
+
+static bool reserve (void** buffer, size_t* capacity, size_t bytes) {
+  if (bytes <= *capacity)
+    return true;
+  void* grown = realloc(*buffer, bytes);
+  if (grown == NULL)
+    return false;
+  *buffer = grown;
+  *capacity = bytes;
+  return true;
+}
+
+// allocateSource
+unsigned char* sa (uint32_t capacity) {
+  if (!reserve((void**)&source, &sourceCapacity, (size_t)capacity + 1))
+    return NULL;
+  return source;
+}
+
+bool parse (uint32_t len, bool lines, bool bytes) {
+  arenaReset(&arena);
+  parseErrorLine = 1;
+  parseErrorColumn = 0;
+  ParseResult result = { 0 };
+  LexOptions options = { lines ? LineStarts : 0, 0 };
+  bool success = parse_options(source, len, arenaAlloc, &arena, &result, &options);
+
+  Remap remapStorage;
+  Remap* remap = NULL;
+  if (!isAscii(source, len)) {
+    if (!buildRemap(&arena, &remapStorage, source, len)) {
+      parseError = 0;
+      return false;
+    }
+    remap = &remapStorage;
+  }
+
+  if (!success) {
+    const unsigned char* error = source + (result.parse_error < len ? result.parse_error : len);
+    parseError = offset(remap, source, error);
+    errorPosition(remap, source, error, &parseErrorLine, &parseErrorColumn);
+    return false;
+  }
+
+  uint32_t importCount, exportCount;
+  size_t fields = recordFields(&result, bytes, &importCount, &exportCount);
+  if (!reserve((void**)&records, &recordsCapacity, fields * sizeof(int32_t))) {
+    parseError = 0;
+    return false;
+  }
+  recordsLength = writeRecords(&result, source, remap, bytes, &arena, importCount, exportCount, records);
+  if (recordsLength == 0) {
+    parseError = 0;
+    return false;
+  }
+  return true;
+}
+
+// getErr
+uint32_t e () {
+  return parseError;
+}
+
+// getErrLine
+int32_t el () {
+  return parseErrorLine;
+}
+
+// getErrColumn
+int32_t ec () {
+  return parseErrorColumn;
+}
+
+// readRecords
+int32_t* rd () {
+  return records;
+}
+
+// recordsLength
+uint32_t rl () {
+  return recordsLength;
+}
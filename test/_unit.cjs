@@ -9,6 +9,11 @@ const init = (async () => {
     await m.init;
     parse = m.parse;
   }
+  else if (process.env.NATIVE) {
+    const m = await import('../dist/native.js');
+    await m.init;
+    parse = m.parse;
+  }
   else if (process.env.ASM) {
     ({ parse } = await import('../dist/lexer.asm.js'));
   }
@@ -1345,3 +1350,155 @@ function x() {
   });
 });
 
+
+if (process.env.NATIVE) suite('Native', () => {
+  beforeEach(async () => await init);
+
+  test('Buffer source', () => {
+    const source = `import a from './ä.js';\nexport { a as b, ä as 𠮷 };\nimport('./c.js');`;
+    const buffer = Buffer.from(source);
+    const [imports, exports, facade] = parse(buffer);
+    assert.deepStrictEqual(parse(buffer), parse(source));
+    assert.strictEqual(imports.length, 2);
+    assert.strictEqual(imports[0].n, './ä.js');
+    assert.strictEqual(source.slice(imports[0].s, imports[0].e), './ä.js');
+    assert.strictEqual(source.slice(imports[1].ss, imports[1].se), `import('./c.js')`);
+    assert.strictEqual(exports[0].n, 'b');
+    assert.strictEqual(exports[0].ln, 'a');
+    assert.strictEqual(exports[1].n, '𠮷');
+    assert.strictEqual(exports[1].ln, 'ä');
+    assert.strictEqual(source.slice(exports[1].ls, exports[1].le), 'ä');
+    assert.strictEqual(facade, true);
+
+    // names are decoded from their bytes, past a stray continuation byte
+    const [[impt], [, expt]] = parse(Buffer.concat([Buffer.from('/* '), Buffer.from([0x80]), Buffer.from(' */ '), buffer]));
+    assert.strictEqual(impt.n, './ä.js');
+    assert.strictEqual(expt.n, '𠮷');
+    assert.strictEqual(expt.ln, 'ä');
+  });
+
+  test('Buffer parse error', () => {
+    try {
+      parse(Buffer.from('import ä from "a";\n  export { a'));
+      assert(false, 'Should error');
+    }
+    catch (err) {
+      assert.strictEqual(err.message.startsWith('Parse error @:'), true);
+      assert.strictEqual(typeof err.idx, 'number');
+    }
+  });
+
+  test('Buffer starting in a keyword lookbehind', () => {
+    // lexed in place, so the checks before a `/` must stop at the first byte
+    for (const source of ['d/x/', 'e/x/', 'of/x/', 'o/x/', 'w/x/', 'k/x/', 't/x/', '>{}/1', 'e{}/1', 'h{}/1']) {
+      const buffer = Buffer.allocUnsafeSlow(source.length);
+      buffer.write(source);
+      const [imports, exports] = parse(buffer);
+      assert.strictEqual(imports.length, 0);
+      assert.strictEqual(exports.length, 0);
+    }
+  });
+});
+
+if (process.env.WASM) suite('Wasm', () => {
+  beforeEach(async () => await init);
+
+  test('Uint8Array source', () => {
+    const source = `import a from './ä.js';\n// 𠮷\nexport { a as "𠮷" };\nimport('./c.js');`;
+    const bytes = new TextEncoder().encode(source);
+    const [imports, exports, facade] = parse(bytes);
+    assert.deepStrictEqual(parse(bytes), parse(source));
+    assert.strictEqual(imports.length, 2);
+    assert.strictEqual(imports[0].n, './ä.js');
+    assert.strictEqual(source.slice(imports[0].s, imports[0].e), './ä.js');
+    assert.strictEqual(source.slice(imports[1].ss, imports[1].se), `import('./c.js')`);
+    assert.strictEqual(exports[0].n, '𠮷');
+    assert.strictEqual(source.slice(exports[0].s, exports[0].e), '"𠮷"');
+    assert.strictEqual(facade, true);
+  });
+
+  test('Uint8Array parse error', () => {
+    try {
+      parse(new TextEncoder().encode('import ä from "a";\n  export { a'));
+      assert(false, 'Should error');
+    }
+    catch (err) {
+      assert.strictEqual(err.message, 'Parse error @:2:13');
+      assert.strictEqual(err.idx, 31);
+    }
+  });
+});
+
+if (process.env.WASM || process.env.NATIVE) suite('Lines', () => {
+  beforeEach(async () => await init);
+
+  test('Line index', () => {
+    const source = `import a from './ä.js';\r\n\n  export { b };\nimport('./c.js')`;
+    const [imports, exports, , lines] = parse(source, '@', { lines: true });
+    assert.deepStrictEqual(Array.from(lines.starts), [0, 25, 26, 42]);
+    assert.deepStrictEqual(lines.position(imports[0].s), { line: 1, column: 15 });
+    assert.deepStrictEqual(lines.position(exports[0].s), { line: 3, column: 11 });
+    assert.deepStrictEqual(lines.position(imports[1].ss), { line: 4, column: 0 });
+    assert.deepStrictEqual(lines.position(24), { line: 1, column: 24 });
+    assert.deepStrictEqual(lines.position(source.length), { line: 4, column: 16 });
+    assert.strictEqual(parse(source).length, 3);
+    // an index without starts puts every offset on the first line
+    assert.deepStrictEqual(new lines.constructor(new Uint32Array(0)).position(5), { line: 1, column: 5 });
+
+    // byte sources have UTF-16 offsets too
+    const [[impt], [expt], , byteLines] = parse(new TextEncoder().encode(source), '@', { lines: true });
+    assert.deepStrictEqual(Array.from(byteLines.starts), [0, 25, 26, 42]);
+    assert.strictEqual(impt.s, imports[0].s);
+    assert.strictEqual(expt.s, exports[0].s);
+  });
+});
+
+if (process.env.WASM) suite('Pool', () => {
+  beforeEach(async () => await init);
+
+  test('parseMany', async () => {
+    const { parseMany } = await import('../dist/pool.js');
+    const sources = [
+      `import a from './a.js';\nexport { a as b };`,
+      new TextEncoder().encode(`import('./ä.js');\nexport { a as "\\u{20BB7}" } from '\\x62';`),
+      `export var p = 5;\nimport.meta.url;`,
+      '',
+      'import ä from "a";\n  export { a'
+    ];
+    const results = await parseMany(sources, { threads: 2 });
+    assert.strictEqual(results.length, sources.length);
+    for (let i = 0; i < 4; i++) {
+      const [imports, exports, facade] = parse(sources[i]);
+      assert.deepStrictEqual(results[i].imports, imports);
+      assert.deepStrictEqual(results[i].exports, exports);
+      assert.strictEqual(results[i].facade, facade);
+    }
+    assert.strictEqual(results[1].exports[0].n, '𠮷');
+    assert.strictEqual(results[1].imports[1].n, 'b');
+    // byte sources have UTF-16 offsets, as with parse
+    assert.deepStrictEqual(results[1].imports, parse(new TextDecoder().decode(sources[1]))[0]);
+
+    // a parse error is thrown when the result is read
+    try {
+      results[4].imports;
+      assert(false, 'Should error');
+    }
+    catch (err) {
+      assert.strictEqual(err.message, 'Parse error @:2:13');
+      assert.strictEqual(err.idx, 31);
+    }
+  });
+
+  test('parseMany batches', async () => {
+    const { parseMany } = await import('../dist/pool.js');
+    const sources = [];
+    for (let i = 0; i < 200; i++)
+      sources.push(`import a${i} from './${i}.js';\n`.repeat(i % 7) + `export const x${i} = ${i};`);
+    const results = await parseMany(sources, { threads: 3 });
+    for (let i = 0; i < sources.length; i++) {
+      assert.strictEqual(results[i].imports.length, i % 7);
+      assert.strictEqual(results[i].exports[0].n, `x${i}`);
+    }
+    assert.deepStrictEqual(await parseMany([]), []);
+  });
+});
@@ -8,6 +8,11 @@ const init = (async () => {
     await m.init;
     parse = m.parse;
   }
+  else if (process.env.NATIVE) {
+    const m = await import('../dist/native.js');
+    await m.init;
+    parse = m.parse;
+  }
   else {
     ({ parse } = await import('../dist/lexer.asm.js'));
   }